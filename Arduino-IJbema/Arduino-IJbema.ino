@@ -1,15 +1,28 @@
+#include "buttoninput.h"
+#include "fastlcd.h"
+#include "inputlog.h"
+#include "journal.h"
+#include "prng.h"
+#include "profiler.h"
 #include "quoter.h"
-#include "tetris.h"
+#include "tetrisgame.h"
+#include "textlayer.h"
 #include "utils.h"
 
-#include <LiquidCrystal.h>
-
 ButtonReader buttonReader;
-LiquidCrystal lcd(12, 11, 5, 4, 3, 2);
+ButtonInput buttonInput(buttonReader);
+FastLCD lcd(12, 11, 5, 4, 3, 2);
+TextLayer textLayer(lcd);
+
+InterruptibleDelay interruptibleDelay(buttonInput);
+
+Quoter quoter(lcd, textLayer, interruptibleDelay);
 
-InterruptibleDelay interruptibleDelay(buttonReader);
+// The quotes and each game's bag get seeds of their own derived from this.
+uint32_t baseSeed = 0;
+uint32_t numGames = 0;
 
-Quoter quoter(lcd, interruptibleDelay);
+Journal journal;
 
 // TODO(marten): zorgen dat pin numbers matchen met de hardware
 int const UNCONNECTED_PIN = 0;
@@ -24,21 +37,38 @@ int const B_BUTTON_PIN = 1;
 
 int const POWER_BUTTON_PIN = B_BUTTON_PIN;
 
+#if defined(PROFILE) || defined(RECORD_INPUT)
+// Serial sends on pin 1 then, which would read as presses of the B button.
+#define NO_B_BUTTON
+#endif
+
 void playTetris() {
-  Tetris tetris(15, 10, buttonReader, lcd);
+  numGames++;
+  TetrisGame tetris(15, 10, Random::derive(baseSeed, numGames), buttonInput, lcd, textLayer, journal);
 
   tetris.mapButton(LEFT_BUTTON_PIN, TetrisButton::MOVE_LEFT);
   tetris.mapButton(RIGHT_BUTTON_PIN, TetrisButton::MOVE_RIGHT);
   tetris.mapButton(UP_BUTTON_PIN, TetrisButton::HARD_DROP);
   tetris.mapButton(DOWN_BUTTON_PIN, TetrisButton::SOFT_DROP);
   tetris.mapButton(A_BUTTON_PIN, TetrisButton::ROTATE_LEFT);
+#ifndef NO_B_BUTTON
   tetris.mapButton(B_BUTTON_PIN, TetrisButton::ROTATE_RIGHT);
+#endif
 
   tetris.play();
 }
 
 void setup() {
+#ifdef RECORD_INPUT
+  Serial.begin(RECORD_BAUDRATE);
+#endif
+#ifdef PROFILE
+  Serial.begin(PROFILE_BAUDRATE);
+#endif
+
+#ifndef NO_B_BUTTON
   buttonReader.invertPin(POWER_BUTTON_PIN);
+#endif
 
   // Keep the Arduino on.
   pinMode(POWER_ON_PIN, OUTPUT);
@@ -46,15 +76,30 @@ void setup() {
 
   // Read on unconnected pin to get a somewhat random seed.
   pinMode(UNCONNECTED_PIN, INPUT);
-  randomSeed(analogRead(UNCONNECTED_PIN));
+  baseSeed = readNoiseSeed(UNCONNECTED_PIN);
+  quoter.seed(Random::derive(baseSeed, 0));
+
+  journal.begin();
 
   pinMode(LEFT_BUTTON_PIN, INPUT);
   pinMode(RIGHT_BUTTON_PIN, INPUT);
   pinMode(UP_BUTTON_PIN, INPUT);
   pinMode(DOWN_BUTTON_PIN, INPUT);
   pinMode(A_BUTTON_PIN, INPUT);
+#ifndef NO_B_BUTTON
   pinMode(B_BUTTON_PIN, INPUT);
-  
+#endif
+
+  buttonInput.watchPin(LEFT_BUTTON_PIN);
+  buttonInput.watchPin(RIGHT_BUTTON_PIN);
+  buttonInput.watchPin(UP_BUTTON_PIN);
+  buttonInput.watchPin(DOWN_BUTTON_PIN);
+  buttonInput.watchPin(A_BUTTON_PIN);
+#ifndef NO_B_BUTTON
+  buttonInput.watchPin(B_BUTTON_PIN);
+#endif
+  buttonInput.begin();
+
   lcd.begin(16, 2);
 
   interruptibleDelay.interruptOnPin(LEFT_BUTTON_PIN);
@@ -62,7 +107,9 @@ void setup() {
   interruptibleDelay.interruptOnPin(UP_BUTTON_PIN);
   interruptibleDelay.interruptOnPin(DOWN_BUTTON_PIN);
   interruptibleDelay.interruptOnPin(A_BUTTON_PIN);
+#ifndef NO_B_BUTTON
   interruptibleDelay.interruptOnPin(B_BUTTON_PIN);
+#endif
 }
 
 void shutDown() {
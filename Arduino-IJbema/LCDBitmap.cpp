@@ -6,19 +6,28 @@
 // ---------------------------------------------------------------------------
 
 #include "LCDBitmap.h"
+#include "profiler.h"
 
-#ifndef LiquidCrystal_h // Using the New LiquidCrystal library
-LCDBitmap::LCDBitmap(LCD *lcd, byte x, byte y) {
-#else                   // Using the standard LiquidCrystal library
-LCDBitmap::LCDBitmap(LiquidCrystal *lcd, byte x, byte y) {
-#endif
+// The five bits of a character row in the opposite order: in a row word, the
+// leftmost pixel is the lowest bit, in a character row the highest.
+static const byte REVERSED_ROWS[32] PROGMEM = {
+  0x00, 0x10, 0x08, 0x18, 0x04, 0x14, 0x0C, 0x1C, 0x02, 0x12, 0x0A, 0x1A, 0x06, 0x16, 0x0E, 0x1E,
+  0x01, 0x11, 0x09, 0x19, 0x05, 0x15, 0x0D, 0x1D, 0x03, 0x13, 0x0B, 0x1B, 0x07, 0x17, 0x0F, 0x1F
+};
+
+LCDBitmap::LCDBitmap(FastLCD *lcd, byte x, byte y) {
   bitmap_x = x; 
   bitmap_y = y;
   _lcd = lcd;
 }
 
 void LCDBitmap::updateChar() {
-  for (byte i=0; i<BITMAP_CHAR; i++) _lcd->createChar(i, chr[i]);
+  _lcd->writeGlyphRows(&chr[0][0], BITMAP_CHAR_H, BITMAP_CHAR, dirty);
+  for (byte c=0; c<BITMAP_CHAR; c++) dirty[c] = 0;
+}
+
+void LCDBitmap::markAllDirty() {
+  for (byte c=0; c<BITMAP_CHAR; c++) dirty[c] = (1<<BITMAP_CHAR_H)-1;
 }
 
 void LCDBitmap::drawChar() {
@@ -29,6 +38,34 @@ void LCDBitmap::drawChar() {
   }
 }
 
+void LCDBitmap::plot(byte x, byte y, boolean color) {
+  byte c = (y/BITMAP_CHAR_H)*4 + x/BITMAP_CHAR_W;
+  byte a = y%BITMAP_CHAR_H;
+  byte mask = 0x10 >> (x%BITMAP_CHAR_W);
+  LCDBitmap::store(c, a, color ? chr[c][a] | mask : chr[c][a] & ~mask);
+}
+
+void LCDBitmap::store(byte c, byte a, byte row) {
+  if (row != chr[c][a]) {
+    chr[c][a] = row;
+    dirty[c] |= 1<<a;
+  }
+}
+
+void LCDBitmap::paint(byte y, uint32_t mask, byte color) {
+  byte c = (y/BITMAP_CHAR_H)*4;
+  byte a = y%BITMAP_CHAR_H;
+  for (byte i=0; i<4; i++, c++, mask >>= BITMAP_CHAR_W) {
+    byte bits = pgm_read_byte(&REVERSED_ROWS[mask & 0x1F]);
+    if (!bits) continue;
+    byte row = chr[c][a];
+    if (color == INVERT) row ^= bits;
+    else if (color) row |= bits;
+    else row &= ~bits;
+    LCDBitmap::store(c, a, row);
+  }
+}
+
 #ifdef BITMAP_RANGE_CHK
 void LCDBitmap::rangeCheck(byte &x1, byte &y1, byte &x2, byte &y2) {
   x1 = min(x1, BITMAP_W-1);
@@ -39,14 +76,20 @@ void LCDBitmap::rangeCheck(byte &x1, byte &y1, byte &x2, byte &y2) {
 #endif
 
 void LCDBitmap::begin() {
+  // Whatever the CGRAM holds now gets overwritten.
+  LCDBitmap::markAllDirty();
   LCDBitmap::clear();
   LCDBitmap::updateChar();
   LCDBitmap::drawChar();
 }
 
 void LCDBitmap::clear() {
-  for (byte y=0; y<BITMAP_H; y++) for (byte x=0; x<BITMAP_W; x++) bitmap[x][y]=OFF;
-  for (byte c=0; c<BITMAP_CHAR; c++) for (byte a=0; a<BITMAP_CHAR_H; a++) chr[c][a]=OFF;
+  for (byte c=0; c<BITMAP_CHAR; c++) {
+    for (byte a=0; a<BITMAP_CHAR_H; a++) {
+      if (chr[c][a]) dirty[c] |= 1<<a;
+      chr[c][a]=OFF;
+    }
+  }
   LCDBitmap::updateChar();
 }
 
@@ -59,27 +102,13 @@ void LCDBitmap::home() {
   _lcd->setCursor(0, 0);
 }
 void LCDBitmap::update() {
-  byte shift_x;
-  byte shift_y=0;
-  for (byte c=0; c<BITMAP_CHAR; c++) {
-    if (c<4) shift_x=c*BITMAP_CHAR_W;
-    else shift_x=(c-4)*BITMAP_CHAR_W;
-    if (c==4) shift_y=BITMAP_CHAR_H;
-    for (byte a=0; a<BITMAP_CHAR_H; a++) {
-      chr[c][a]=bitmap[shift_x][shift_y+a]<<4;
-      chr[c][a]+=bitmap[shift_x+1][shift_y+a]<<3;
-      chr[c][a]+=bitmap[shift_x+2][shift_y+a]<<2;
-      chr[c][a]+=bitmap[shift_x+3][shift_y+a]<<1;
-      chr[c][a]+=bitmap[shift_x+4][shift_y+a];
-    }
-  }
+  PROFILE_ZONE(BITMAP_UPDATE);
   LCDBitmap::updateChar();
 }
 
 void LCDBitmap::inverse() {
-  for (byte x=0; x<BITMAP_W; x++) {
-    for (byte y=0; y<BITMAP_H; y++) bitmap[x][y]=bitmap[x][y]^1;
-  }
+  for (byte c=0; c<BITMAP_CHAR; c++) for (byte a=0; a<BITMAP_CHAR_H; a++) chr[c][a]^=0x1F;
+  LCDBitmap::markAllDirty();
   LCDBitmap::update();
 }
 
@@ -95,9 +124,9 @@ void LCDBitmap::move(byte x, byte y) {
 
 void LCDBitmap::pixel(byte x, byte y, boolean color, boolean update) {
 #ifdef BITMAP_RANGE_CHK
-  if (x>=0 && y>=0 && x<BITMAP_W && y<BITMAP_H) bitmap[x][y]=color;
+  if (x>=0 && y>=0 && x<BITMAP_W && y<BITMAP_H) LCDBitmap::plot(x, y, color);
 #else
-  bitmap[x][y]=color;
+  LCDBitmap::plot(x, y, color);
 #endif
   if (update) LCDBitmap::update();
 }
@@ -109,17 +138,13 @@ void LCDBitmap::line(byte x1, byte y1, byte x2, byte y2, boolean color, boolean
   // Vertical line (faster than diagonal line method)
   if (x1==x2) {
     if (y1 < y2) {
-      for (y1=y1; y1<=y2; y1++) bitmap[x1][y1]=color;
+      for (y1=y1; y1<=y2; y1++) LCDBitmap::plot(x1, y1, color);
     } else {
-      for (y2=y2; y2<=y1; y2++) bitmap[x1][y2]=color;
+      for (y2=y2; y2<=y1; y2++) LCDBitmap::plot(x1, y2, color);
     }
   // Horizontal line (faster than diagonal line method)
   } else if (y1==y2) {
-    if (x1 < x2) {
-      for (x1=x1; x1<=x2; x1++) bitmap[x1][y1]=color;
-    } else {
-      for (x2=x2; x2<=x1; x2++) bitmap[x2][y1]=color;
-    }
+    LCDBitmap::span(x1, x2, y1, color, NO_UPDATE);
   // Diagonal line
   } else {
     byte dx, dy;
@@ -131,7 +156,7 @@ void LCDBitmap::line(byte x1, byte y1, byte x2, byte y2, boolean color, boolean
     if (x1 < x2) sx = 1; else sx = -1;
     if (y1 < y2) sy = 1; else sy = -1;
     while (1) {
-      bitmap[x1][y1]=color;
+      LCDBitmap::plot(x1, y1, color);
       if (x1 == x2 && y1 == y2) break;
       e2 = 2*err;
       if (e2 > -dy) { 
@@ -162,20 +187,12 @@ void LCDBitmap::rectFill(byte x1, byte y1, byte x2, byte y2, boolean color, bool
 #ifdef BITMAP_RANGE_CHK
   LCDBitmap::rangeCheck(x1, y1, x2, y2);
 #endif
-  byte y;
-  int8_t sx, sy;
-  if (x1 < x2) sx = 1; else sx = -1;
-  if (y1 < y2) sy = 1; else sy = -1;
-  while (1) {
-    y=y1;
-    while (1) {
-      bitmap[x1][y]=color;
-      if (y == y2) break;
-    y+=sy;
-    }
-    if (x1 == x2) break;
-    x1+=sx;
+  if (y1 > y2) {
+    byte y = y1;
+    y1 = y2;
+    y2 = y;
   }
+  for (byte y=y1; y<=y2; y++) LCDBitmap::span(x1, x2, y, color, NO_UPDATE);
   if (update) LCDBitmap::update();
 }
 
@@ -198,4 +215,76 @@ void LCDBitmap::barGraph(byte bars, byte *graph, boolean color, boolean update)
     }
   }
   if (update) LCDBitmap::update();
-}
\ No newline at end of file
+}
+
+uint32_t LCDBitmap::getRow(byte y) {
+  byte c = (y/BITMAP_CHAR_H)*4;
+  byte a = y%BITMAP_CHAR_H;
+  uint32_t bits = 0;
+  for (byte i=4; i>0; i--) {
+    bits = bits << BITMAP_CHAR_W | pgm_read_byte(&REVERSED_ROWS[chr[c+i-1][a]]);
+  }
+  return bits;
+}
+
+void LCDBitmap::setRow(byte y, uint32_t bits, boolean update) {
+  byte c = (y/BITMAP_CHAR_H)*4;
+  byte a = y%BITMAP_CHAR_H;
+  for (byte i=0; i<4; i++, bits >>= BITMAP_CHAR_W) {
+    LCDBitmap::store(c+i, a, pgm_read_byte(&REVERSED_ROWS[bits & 0x1F]));
+  }
+  if (update) LCDBitmap::update();
+}
+
+void LCDBitmap::span(byte x1, byte x2, byte y, byte color, boolean update) {
+#ifdef BITMAP_RANGE_CHK
+  LCDBitmap::rangeCheck(x1, y, x2, y);
+#endif
+  if (x1 > x2) {
+    byte x = x1;
+    x1 = x2;
+    x2 = x;
+  }
+  LCDBitmap::paint(y, ((uint32_t(2) << (x2-x1)) - 1) << x1, color);
+  if (update) LCDBitmap::update();
+}
+
+void LCDBitmap::blit(byte x, byte y, uint16_t shape, byte color, boolean update) {
+  for (byte r=0; r<4; r++, shape >>= 4) {
+    byte bits = shape & 0x0F;
+    if (bits && y+3-r < BITMAP_H) LCDBitmap::paint(y+3-r, uint32_t(bits) << x, color);
+  }
+  if (update) LCDBitmap::update();
+}
+
+void LCDBitmap::scrollLeft(boolean update) {
+  for (byte y=0; y<BITMAP_H; y++) LCDBitmap::setRow(y, LCDBitmap::getRow(y) >> 1);
+  if (update) LCDBitmap::update();
+}
+
+void LCDBitmap::scrollRight(boolean update) {
+  for (byte y=0; y<BITMAP_H; y++) LCDBitmap::setRow(y, LCDBitmap::getRow(y) << 1);
+  if (update) LCDBitmap::update();
+}
+
+void LCDBitmap::scrollUp(boolean update) {
+  for (byte y=0; y<BITMAP_H; y++) {
+    byte from = y+1;
+    for (byte i=0; i<4; i++) {
+      byte c = (y/BITMAP_CHAR_H)*4 + i;
+      LCDBitmap::store(c, y%BITMAP_CHAR_H, from < BITMAP_H ? chr[(from/BITMAP_CHAR_H)*4 + i][from%BITMAP_CHAR_H] : OFF);
+    }
+  }
+  if (update) LCDBitmap::update();
+}
+
+void LCDBitmap::scrollDown(boolean update) {
+  for (byte y=BITMAP_H; y>0; y--) {
+    byte to = y-1;
+    for (byte i=0; i<4; i++) {
+      byte c = (to/BITMAP_CHAR_H)*4 + i;
+      LCDBitmap::store(c, to%BITMAP_CHAR_H, to > 0 ? chr[((to-1)/BITMAP_CHAR_H)*4 + i][(to-1)%BITMAP_CHAR_H] : OFF);
+    }
+  }
+  if (update) LCDBitmap::update();
+}
@@ -41,11 +41,28 @@
 //   bitmap.rect(x1, y1, x2, y2, color, update) - Draw a rectangle from (x1,y1) to (x2,y2), color & update as in pixel
 //   bitmap.rectFill(x1, y1, x2, y2, color, update) - Draw a filled rectangle from (x1,y1) to (x2,y2), color & update as in pixel
 //   bitmap.barGraph(bars, *graph, color, update) - Draw bar graph, bars is # of bars (1,2,4,5,10,20), *graph is array containing height values, color & update as in pixel
+//   bitmap.getRow(y) - Row y as a word, bit x is pixel x
+//   bitmap.setRow(y, bits, update) - Replace row y by a word as returned by getRow
+//   bitmap.span(x1, x2, y, color, update) - Draw row y from x1 to x2, color is ON, OFF or INVERT
+//   bitmap.blit(x, y, shape, color, update) - Draw the set pixels of a 4x4 shape (bit 4*row+col, bottom row first) with its top left at (x,y), color as in span
+//   bitmap.scrollLeft(update), scrollRight, scrollUp, scrollDown - Move the whole bitmap one pixel, the pixels moving in are OFF
 //
 //   bitmap.lineHor - Deprecated, use bitmap.line instead, old code using this function will continue to work.
 //   bitmap.lineVert - Deprecated, use bitmap.line instead, old code using this function will continue to work.
 //
 // HISTORY:
+// Local changes - The bitmap is kept packed in the custom character rows, a
+//   bit per pixel, so update() no longer has to gather them from 320 booleans
+//   and the whole object takes 76 bytes of RAM instead of 388.
+//   update() only uploads the character rows that changed since the last
+//   one, through FastLCD::writeGlyphRows.
+//   Added getRow, setRow, span, blit and the scroll functions, which work on
+//   whole rows of a character at once; rectFill, horizontal lines and
+//   barGraph now draw with spans.
+//   Talks to the display through the sketch's FastLCD instead of either
+//   LiquidCrystal library.
+//   update() is a zone of the sketch's profiler.
+//
 // 04/01/2015 - Moved repository to Bitbucket, updated other web links.
 //
 // 07/05/2012 v1.6 - BITMAP_RANGE_CHK bug fix.
@@ -94,15 +111,11 @@
   #include <WProgram.h>
 #endif
 
-#include <LiquidCrystal.h>
-#ifndef LiquidCrystal_h // Not using the stock LiquidCrystal library
-	#ifndef _LCD_H_       // Also not using the New LiquidCrystal library
-		#error "You must install New LiquidCrystal library to work with non-4bit projects: http://bitbucket.org/fmalpartida/new-liquidcrystal/wiki/Home"
-	#endif
-#endif
+#include "fastlcd.h"
 
 #define ON 1   // Color ON (LCD pixel active)
 #define OFF 0  // Color OFF (LCD pixel inactive)
+#define INVERT 2 // Color that flips pixels, for span and blit only
 #define UPDATE true
 #define NO_UPDATE false
 
@@ -120,11 +133,7 @@ const byte BITMAP_H = BITMAP_CHAR_H * 2; // Bitmap pixels high (2 character rows
 
 class LCDBitmap {
 	public:
-#ifndef LiquidCrystal_h // Using the New LiquidCrystal library
-		LCDBitmap (LCD *lcd, byte bitmap_x, byte bitmap_y);
-#else                   // Using the standard LiquidCrystal library
-		LCDBitmap (LiquidCrystal *lcd, byte bitmap_x, byte bitmap_y);
-#endif
+		LCDBitmap (FastLCD *lcd, byte bitmap_x, byte bitmap_y);
 		void begin();
 		void clear();
 		void inverse();
@@ -137,21 +146,33 @@ class LCDBitmap {
 		void rect(byte x1, byte y1, byte x2, byte y2, boolean color, boolean update=false);
 		void rectFill(byte x1, byte y1, byte x2, byte y2, boolean color, boolean update=false);
 		void barGraph(byte bars, byte *graph, boolean color, boolean update=false);
+		uint32_t getRow(byte y);
+		void setRow(byte y, uint32_t bits, boolean update=false);
+		void span(byte x1, byte x2, byte y, byte color, boolean update=false);
+		void blit(byte x, byte y, uint16_t shape, byte color, boolean update=false);
+		void scrollLeft(boolean update=false);
+		void scrollRight(boolean update=false);
+		void scrollUp(boolean update=false);
+		void scrollDown(boolean update=false);
 	private:
 		void updateChar();
 		void drawChar();
+		void plot(byte x, byte y, boolean color);
+		void store(byte c, byte a, byte row);
+		void paint(byte y, uint32_t mask, byte color);
+		void markAllDirty();
 #ifdef BITMAP_RANGE_CHK
 		void rangeCheck(byte &x1, byte &y1, byte &x2, byte &y2);
 #endif
 		byte bitmap_x;
 		byte bitmap_y;
-		boolean bitmap[BITMAP_W][BITMAP_H];
+		// The bitmap itself, as the rows of the custom characters: character c
+		// covers x from (c%4)*BITMAP_CHAR_W and y from (c/4)*BITMAP_CHAR_H, and
+		// the leftmost of its pixels is bit 4 of each row.
 		byte chr[BITMAP_CHAR][BITMAP_CHAR_H];
-#ifndef LiquidCrystal_h // Using the New LiquidCrystal library
-		LCD *_lcd;
-#else                   // Using the standard LiquidCrystal library
-		LiquidCrystal *_lcd;
-#endif
+		// For each character, a bit per row that differs from the LCD's CGRAM.
+		byte dirty[BITMAP_CHAR];
+		FastLCD *_lcd;
 };
  
 #endif
\ No newline at end of file
@@ -0,0 +1,90 @@
+#include "buttoninput.h"
+
+#include "utils.h"
+
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <util/atomic.h>
+
+namespace {
+
+ButtonInput *activeInput = nullptr;
+
+}
+
+ISR(PCINT0_vect) {
+  activeInput->handlePinChange();
+}
+
+ISR(PCINT2_vect) {
+  activeInput->handlePinChange();
+}
+
+ButtonInput::ButtonInput(ButtonReader &buttonReader)
+  :
+    buttonReader(buttonReader),
+    watchedPins(0),
+    pressedPins(0),
+    changeTimes{0},
+    head(0),
+    tail(0)
+{
+}
+
+void ButtonInput::watchPin(int pin) {
+  watchedPins |= 1u << pin;
+}
+
+void ButtonInput::begin() {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    activeInput = this;
+    pressedPins = buttonReader.snapshot() & watchedPins;
+    head = tail = 0;
+    PCMSK2 = uint8_t(watchedPins);
+    PCMSK0 = uint8_t(watchedPins >> 8);
+    PCICR |= _BV(PCIE0) | _BV(PCIE2);
+  }
+}
+
+bool ButtonInput::poll(ButtonEvent &event) {
+  // Catches up on pins that settled after bouncing, with interrupts off so
+  // this briefly stands in for the producer.
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    handlePinChange();
+  }
+
+  uint8_t t = tail;
+  if (t == head) {
+    return false;
+  }
+  event = ring[t];
+  tail = (t + 1) & (RING_SIZE - 1);
+  return true;
+}
+
+void ButtonInput::flush() {
+  tail = head;
+}
+
+void ButtonInput::handlePinChange() {
+  uint16_t now = millis();
+  uint16_t changedPins = (buttonReader.snapshot() & watchedPins) ^ pressedPins;
+  for (uint8_t pin = 0; changedPins; pin++, changedPins >>= 1) {
+    if (!(changedPins & 1) || uint16_t(now - changeTimes[pin]) < DEBOUNCE_MILLIS) {
+      continue;
+    }
+    changeTimes[pin] = now;
+    uint16_t pressed = pressedPins ^ (1u << pin);
+    pressedPins = pressed;
+
+    uint8_t h = head;
+    uint8_t next = (h + 1) & (RING_SIZE - 1);
+    // If the consumer has fallen this far behind, the event is lost, but
+    // getPressedPins() stays right.
+    if (next != tail) {
+      ring[h] = ButtonEvent{pin, bool(pressed & (1u << pin)), now};
+      head = next;
+    }
+  }
+}
@@ -0,0 +1,85 @@
+#ifndef BUTTONINPUT_H_
+#define BUTTONINPUT_H_
+
+#include <stdint.h>
+
+class ButtonReader;
+
+/**
+ * Pins 0 to 13: all of port D and the low six bits of port B.
+ */
+uint8_t const NUM_BUTTON_PINS = 14;
+
+/**
+ * A button going down or up.
+ */
+struct ButtonEvent {
+  uint8_t pin;
+  bool pressed;
+  uint16_t time; // Low bits of millis().
+};
+
+/**
+ * Catches button presses and releases with pin change interrupts, so that a
+ * tap is seen even if it ends before anyone gets round to reading the pins.
+ * The interrupt is the only producer of events and the main program the only
+ * consumer, so the ring buffer between them needs no locking.
+ *
+ * A change on a pin within DEBOUNCE_MILLIS of the previous one on the same
+ * pin is contact bounce and is ignored; if the pin settles in a different
+ * state than it was last reported in, that is reported on the next poll().
+ *
+ * There is one set of pin change interrupts, so only one of these can be
+ * begun.
+ */
+class ButtonInput {
+  public:
+    explicit ButtonInput(ButtonReader &buttonReader);
+
+    /**
+     * Reports changes on the pin. Call before begin().
+     */
+    void watchPin(int pin);
+
+    /**
+     * Takes the current state of the watched pins and enables the interrupts.
+     */
+    void begin();
+
+    /**
+     * Takes the oldest event not yet taken. Returns false if there is none.
+     */
+    bool poll(ButtonEvent &event);
+
+    /**
+     * Drops all events not yet taken.
+     */
+    void flush();
+
+    /**
+     * The watched pins that are pressed, one bit per pin.
+     */
+    uint16_t getPressedPins() const { return pressedPins; }
+
+    /**
+     * Called by the interrupt handlers.
+     */
+    void handlePinChange();
+
+  private:
+    // A power of two, so the indices can wrap with a mask.
+    static uint8_t const RING_SIZE = 16;
+    static uint8_t const DEBOUNCE_MILLIS = 5;
+
+    ButtonReader &buttonReader;
+    uint16_t watchedPins;
+
+    volatile uint16_t pressedPins;
+    uint16_t changeTimes[NUM_BUTTON_PINS];
+
+    ButtonEvent ring[RING_SIZE];
+    volatile uint8_t head; // Written only by the producer.
+    volatile uint8_t tail; // Written only by the consumer.
+};
+
+#endif
@@ -1,57 +1,151 @@
 #include "decompress.h"
 
+#include "profiler.h"
+
 #include <avr/pgmspace.h>
 
-Decompressor::Decompressor(char const *start) :
+namespace {
+
+// Word i of the dictionary comes out of either code as the control
+// character i + 1.
+uint8_t const MAX_WORDS = 31;
+
+}
+
+Decompressor::Decompressor(char const *start, HuffmanCode const *huffmanCode, Dictionary const *dictionary) :
+  huffmanCode(huffmanCode),
+  dictionary(dictionary),
   next(start),
-  curBitMask(0),
+  word(nullptr),
+  bitBuffer(0),
+  numBits(0),
   caps(false)
 {}
 
 char Decompressor::getNext() {
-  char code = readBits(5);
-  switch (code) {
-    case 0:
-      return ' ';
-    case 0b11011:
-      caps = true;
-      return getNext();
-    case 0b11100:
-      caps = false;
-      return getNext();
-    case 0b11101:
-      return '?'; // Reserved.
-    case 0b11110:
-      return readBits(8);
-    case 0b11111:
-      return '\0';
-    default:
-      if (caps) {
-        return 'A' + code - 1;
-      } else {
-        return 'a' + code - 1;
-      }
-  }
-}
-
-char Decompressor::readBits(int num) {
-  char out = 0;
-  for (int i = num - 1; i >= 0; i--) {
-    out <<= 1;
-    if (readBit()) {
-      out |= 1;
+  PROFILE_ZONE(DECOMPRESS);
+  return decodeChar();
+}
+
+uint8_t Decompressor::decodeInto(char *buffer, uint8_t size) {
+  PROFILE_ZONE(DECOMPRESS);
+  uint8_t length = 0;
+  while (length < size) {
+    char c = decodeChar();
+    if (!c) {
+      break;
     }
+    buffer[length++] = c;
+  }
+  return length;
+}
+
+void Decompressor::skip() {
+  // Words don't need to be read out to be skipped.
+  word = nullptr;
+  while (decodeSymbol() != '\0') {
   }
-  return out;
 }
 
-bool Decompressor::readBit() {
-  if (!curBitMask) {
-    curByte = pgm_read_byte_near(next);
+char Decompressor::decodeChar() {
+  if (word) {
+    char c = pgm_read_byte_near(word);
+    if (c) {
+      word++;
+      return c;
+    }
+    word = nullptr;
+  }
+
+  char c = decodeSymbol();
+  if (c == '\0' || uint8_t(c) > MAX_WORDS) {
+    return c;
+  }
+  if (!dictionary) {
+    return '?';
+  }
+  // Words are never empty.
+  word = dictionary->text + pgm_read_word_near(dictionary->offsets + c - 1);
+  return pgm_read_byte_near(word++);
+}
+
+char Decompressor::decodeFiveBit() {
+  // Loops rather than recursing past the caps codes.
+  while (true) {
+    uint8_t code = readBits(5);
+    switch (code) {
+      case 0:
+        return ' ';
+      case 0b11011:
+        caps = true;
+        break;
+      case 0b11100:
+        caps = false;
+        break;
+      case 0b11101:
+        return 1 + readBits(5);
+      case 0b11110:
+        return readBits(8);
+      case 0b11111:
+        // Every text starts with caps off.
+        caps = false;
+        return '\0';
+      default:
+        return (caps ? 'A' : 'a') + code - 1;
+    }
+  }
+}
+
+char Decompressor::decodeHuffman() {
+  fillBits(HUFFMAN_LOOKUP_BITS);
+  uint8_t const *entry = huffmanCode->lookup + 2 * (bitBuffer >> (16 - HUFFMAN_LOOKUP_BITS));
+  uint8_t lookupLength = pgm_read_byte_near(entry);
+  if (lookupLength) {
+    bitBuffer <<= lookupLength;
+    numBits -= lookupLength;
+    return pgm_read_byte_near(entry + 1);
+  }
+  if (huffmanCode->maxLength <= HUFFMAN_LOOKUP_BITS) {
+    return '\0'; // Not a code.
+  }
+
+  // A longer code. The codes of each length are consecutive numbers, and the
+  // first code of a length follows on from the last one of the length
+  // before, doubled. So a code can be told from a longer one's prefix by
+  // comparing it with the first code of its length.
+  uint16_t first = 0;
+  uint16_t index = 0;
+  for (uint8_t length = 0; length < HUFFMAN_LOOKUP_BITS; length++) {
+    uint8_t count = pgm_read_byte_near(huffmanCode->counts + length);
+    index += count;
+    first = (first + count) << 1;
+  }
+  uint16_t code = uint16_t(readBits(HUFFMAN_LOOKUP_BITS)) << 1;
+  for (uint8_t length = HUFFMAN_LOOKUP_BITS; length < huffmanCode->maxLength; length++) {
+    code |= readBits(1);
+    uint8_t count = pgm_read_byte_near(huffmanCode->counts + length);
+    if (code - first < count) {
+      return pgm_read_byte_near(huffmanCode->symbols + index + code - first);
+    }
+    index += count;
+    first = (first + count) << 1;
+    code <<= 1;
+  }
+  return '\0'; // Not a code.
+}
+
+void Decompressor::fillBits(uint8_t num) {
+  while (numBits < num) {
+    bitBuffer |= uint16_t(uint8_t(pgm_read_byte_near(next))) << (8 - numBits);
     next++;
-    curBitMask = 0x80;
+    numBits += 8;
   }
-  bool bit = curByte & curBitMask;
-  curBitMask >>= 1;
-  return bit;
+}
+
+uint8_t Decompressor::readBits(uint8_t num) {
+  fillBits(num);
+  uint8_t bits = bitBuffer >> (16 - num);
+  bitBuffer <<= num;
+  numBits -= num;
+  return bits;
 }
@@ -1,20 +1,87 @@
 #ifndef DECOMPRESS_H_
 #define DECOMPRESS_H_
 
+#include <stdint.h>
+
+/**
+ * Huffman codes of up to this many bits are looked up in one go.
+ */
+uint8_t const HUFFMAN_LOOKUP_BITS = 6;
+
+/**
+ * A canonical Huffman code, as written by quotes_gen.rb --huffman. All
+ * arrays are in flash: the number of codes of each length from 1 bit up to
+ * maxLength, the characters in order of code, and for every value of the
+ * next HUFFMAN_LOOKUP_BITS bits, the length of the code they start with and
+ * its character, or a length of 0 if the code is longer.
+ */
+struct HuffmanCode {
+  uint8_t const *counts;
+  char const *symbols;
+  uint8_t const *lookup;
+  uint8_t maxLength;
+};
+
+/**
+ * Words that a text can refer to instead of spelling them out, as written by
+ * quotes_gen.rb. Both arrays are in flash: where each word starts in text,
+ * and the words, each ended by '\0'.
+ */
+struct Dictionary {
+  uint16_t const *offsets;
+  char const *text;
+};
+
+/**
+ * Reads back a text from flash as coded by quotes_gen.rb: with the fixed
+ * 5-bit code, or with the given Huffman code if there is one. Words from the
+ * dictionary are read out of flash as they go, a character at a time.
+ *
+ * The bits are read from flash a byte at a time into a buffer, and a code is
+ * taken from the top of it with a shift. The end of the data may be read a
+ * byte past.
+ */
 class Decompressor {
   public:
-    Decompressor(char const *start);
+    Decompressor(char const *start, HuffmanCode const *huffmanCode = nullptr, Dictionary const *dictionary = nullptr);
 
+    /**
+     * Returns the next character, or '\0' at the end of a text. The next
+     * text follows right after only within a group of quotes; the start of a
+     * group must be found through QUOTE_INDEX.
+     */
     char getNext();
 
+    /**
+     * Decodes up to size characters of the current text into buffer, without
+     * a '\0', and returns how many. Fewer than size means the text has ended.
+     */
+    uint8_t decodeInto(char *buffer, uint8_t size);
+
+    /**
+     * Reads past the rest of the current text.
+     */
+    void skip();
+
   private:
+    HuffmanCode const *huffmanCode;
+    Dictionary const *dictionary;
     char const *next;
-    char curByte;
-    unsigned curBitMask;
+    // The rest of the word being read out, or null.
+    char const *word;
+    // The bits read ahead, the next one in the highest bit.
+    uint16_t bitBuffer;
+    uint8_t numBits;
     bool caps;
 
-    char readBits(int num);
-    bool readBit();
+    char decodeChar();
+    char decodeSymbol() { return huffmanCode ? decodeHuffman() : decodeFiveBit(); }
+    char decodeFiveBit();
+    char decodeHuffman();
+
+    // At most 8 bits at a time.
+    void fillBits(uint8_t num);
+    uint8_t readBits(uint8_t num);
 };
 
 #endif
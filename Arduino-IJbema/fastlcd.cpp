@@ -0,0 +1,156 @@
+#include "fastlcd.h"
+
+namespace {
+
+// Instruction execution times from the HD44780 datasheet, 37 us and 1.52 ms
+// at its typical 270 kHz oscillator, scaled to the slowest one it allows,
+// 190 kHz. Clones are often slow. A display slower still needs these raised,
+// or its R/W pin wired.
+uint16_t const EXECUTION_MICROS = 53;
+uint16_t const CLEAR_MICROS = 2160;
+
+// The steps of initialization by instruction (datasheet figure 24), with
+// LiquidCrystal's margins.
+uint16_t const INIT_STEP_MICROS = 4500;
+uint16_t const INIT_LAST_STEP_MICROS = 150;
+
+// DDRAM address of the first character of each row.
+uint8_t const ROW_OFFSETS[] = {0x00, 0x40, 0x14, 0x54};
+uint8_t const NUM_ROW_OFFSETS = sizeof(ROW_OFFSETS) / sizeof(ROW_OFFSETS[0]);
+
+// Each character takes 8 CGRAM addresses, even with 7 pixel high characters.
+uint8_t const CGRAM_CHAR_STRIDE = 8;
+// Skipping over this many unchanged rows costs as much as setting the CGRAM
+// address again, so shorter gaps are simply written again.
+uint8_t const MAX_REWRITTEN_ROWS = 1;
+
+// Instruction flags.
+uint8_t const ENTRY_INCREMENT = 0x02;
+uint8_t const DISPLAY_ON = 0x04;
+uint8_t const SHIFT_DISPLAY = 0x08;
+uint8_t const SHIFT_RIGHT = 0x04;
+uint8_t const TWO_LINES = 0x08;
+
+}
+
+FastLCD::FastLCD(uint8_t rs, uint8_t enable, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7)
+  :
+    FastLCD(rs, NO_PIN, enable, d4, d5, d6, d7)
+{
+}
+
+FastLCD::FastLCD(uint8_t rs, uint8_t rw, uint8_t enable, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7)
+  :
+    rsPin(rs),
+    rwPin(rw),
+    enablePin(enable),
+    dataPins{d4, d5, d6, d7},
+    rsPort(nullptr),
+    rwPort(nullptr),
+    enablePort(nullptr),
+    rsMask(0),
+    rwMask(0),
+    enableMask(0),
+    dataPort(nullptr),
+    dataModePort(nullptr),
+    dataInputPort(nullptr),
+    dataMask(0),
+    busyMask(0),
+    nibbleBits{0},
+    numRows(1),
+    readyTime(0)
+{
+}
+
+void FastLCD::begin(uint8_t, uint8_t rows) {
+  beginPins();
+  numRows = rows < NUM_ROW_OFFSETS ? rows : NUM_ROW_OFFSETS;
+
+  // Gets into 4-bit mode from whatever mode and nibble the controller was in.
+  // The busy flag can't be checked until the last of these.
+  writeNibble(0x03);
+  waitMicros(INIT_STEP_MICROS);
+  writeNibble(0x03);
+  waitMicros(INIT_STEP_MICROS);
+  writeNibble(0x03);
+  waitMicros(INIT_LAST_STEP_MICROS);
+  writeNibble(0x02);
+  setBusyFor(EXECUTION_MICROS);
+
+  command(LCD_FUNCTION_SET | (numRows > 1 ? TWO_LINES : 0));
+  command(LCD_DISPLAY_CONTROL | DISPLAY_ON);
+  clear();
+  command(LCD_ENTRY_MODE_SET | ENTRY_INCREMENT);
+}
+
+void FastLCD::clear() {
+  send(LCD_CLEAR_DISPLAY, false, CLEAR_MICROS);
+}
+
+void FastLCD::home() {
+  send(LCD_RETURN_HOME, false, CLEAR_MICROS);
+}
+
+void FastLCD::setCursor(uint8_t col, uint8_t row) {
+  if (row >= numRows) {
+    row = numRows - 1;
+  }
+  command(LCD_SET_DDRAM_ADDRESS | (col + ROW_OFFSETS[row]));
+}
+
+void FastLCD::scrollDisplayLeft() {
+  command(LCD_CURSOR_SHIFT | SHIFT_DISPLAY);
+}
+
+void FastLCD::scrollDisplayRight() {
+  command(LCD_CURSOR_SHIFT | SHIFT_DISPLAY | SHIFT_RIGHT);
+}
+
+void FastLCD::createChar(uint8_t location, uint8_t const charmap[]) {
+  command(LCD_SET_CGRAM_ADDRESS | (location & 0x07) << 3);
+  for (uint8_t i = 0; i < 8; i++) {
+    write(charmap[i]);
+  }
+}
+
+void FastLCD::writeGlyphRows(uint8_t const *glyphs, uint8_t height, uint8_t numGlyphs, uint8_t const dirty[]) {
+  // CGRAM address the address counter points at, if one of these glyphs'.
+  uint8_t next = numGlyphs * CGRAM_CHAR_STRIDE;
+  for (uint8_t glyph = 0; glyph < numGlyphs; glyph++) {
+    if (!dirty[glyph]) {
+      continue;
+    }
+    for (uint8_t row = 0; row < height; row++) {
+      if (!(dirty[glyph] & (1 << row))) {
+        continue;
+      }
+      uint8_t address = glyph * CGRAM_CHAR_STRIDE + row;
+      if (next < address && address - next <= MAX_REWRITTEN_ROWS) {
+        // The auto-increment carries on through the unchanged rows.
+        for (; next < address; next++) {
+          uint8_t skipped = next % CGRAM_CHAR_STRIDE;
+          write(skipped < height ? glyphs[next / CGRAM_CHAR_STRIDE * height + skipped] : 0);
+        }
+      } else if (next != address) {
+        command(LCD_SET_CGRAM_ADDRESS | address);
+      }
+      write(glyphs[glyph * height + row]);
+      next = address + 1;
+    }
+  }
+}
+
+void FastLCD::command(uint8_t value) {
+  send(value, false, EXECUTION_MICROS);
+}
+
+size_t FastLCD::write(uint8_t value) {
+  send(value, true, EXECUTION_MICROS);
+  return 1;
+}
+
+void FastLCD::send(uint8_t value, bool data, uint16_t executionMicros) {
+  waitUntilReady();
+  writeByte(value, data);
+  setBusyFor(executionMicros);
+}
@@ -0,0 +1,113 @@
+#ifndef FASTLCD_H_
+#define FASTLCD_H_
+
+#include <Arduino.h>
+
+// HD44780 instructions, for use with FastLCD::command().
+uint8_t const LCD_CLEAR_DISPLAY = 0x01;
+uint8_t const LCD_RETURN_HOME = 0x02;
+uint8_t const LCD_ENTRY_MODE_SET = 0x04;
+uint8_t const LCD_DISPLAY_CONTROL = 0x08;
+uint8_t const LCD_CURSOR_SHIFT = 0x10;
+uint8_t const LCD_FUNCTION_SET = 0x20;
+uint8_t const LCD_SET_CGRAM_ADDRESS = 0x40;
+uint8_t const LCD_SET_DDRAM_ADDRESS = 0x80;
+
+/**
+ * Drives an HD44780 display over its 4-bit bus, like LiquidCrystal does and
+ * with the part of its interface this sketch uses, but with direct port
+ * writes: when the four data pins share a port, a nibble goes out in a
+ * single write through a lookup table, whatever order the pins are in.
+ *
+ * LiquidCrystal waits out 100 microseconds after every nibble. Here the
+ * controller's time to execute an instruction is waited out only before the
+ * next one is sent, so whatever the caller does in between overlaps with it.
+ * If the R/W pin is wired, the busy flag is polled instead, which also copes
+ * with controllers slower than the datasheet's typical timings.
+ */
+class FastLCD : public Print {
+  public:
+    FastLCD(uint8_t rs, uint8_t enable, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7);
+    FastLCD(uint8_t rs, uint8_t rw, uint8_t enable, uint8_t d4, uint8_t d5, uint8_t d6, uint8_t d7);
+
+    /**
+     * Sets up the pins and the display. Takes about 60 ms.
+     */
+    void begin(uint8_t cols, uint8_t rows);
+
+    void clear();
+    void home();
+    void setCursor(uint8_t col, uint8_t row);
+    void scrollDisplayLeft();
+    void scrollDisplayRight();
+    void createChar(uint8_t location, uint8_t const charmap[]);
+
+    /**
+     * Writes the changed rows of the first numGlyphs custom characters, with
+     * as few CGRAM address commands as it takes. Row r of character c is
+     * glyphs[c * height + r], and is written if bit r of dirty[c] is set.
+     */
+    void writeGlyphRows(uint8_t const *glyphs, uint8_t height, uint8_t numGlyphs, uint8_t const dirty[]);
+
+    /**
+     * Sends an instruction, one of the LCD_ constants above with its flags.
+     */
+    void command(uint8_t value);
+
+    virtual size_t write(uint8_t value);
+    using Print::write;
+
+  private:
+    static uint8_t const NO_PIN = 0xFF;
+
+    uint8_t rsPin;
+    uint8_t rwPin;
+    uint8_t enablePin;
+    uint8_t dataPins[4];
+
+    volatile uint8_t *rsPort;
+    volatile uint8_t *rwPort; // Null if R/W is not wired.
+    volatile uint8_t *enablePort;
+    uint8_t rsMask;
+    uint8_t rwMask;
+    uint8_t enableMask;
+
+    // Set if all data pins are on this port, null otherwise.
+    volatile uint8_t *dataPort;
+    volatile uint8_t *dataModePort;
+    volatile uint8_t *dataInputPort;
+    uint8_t dataMask;
+    uint8_t busyMask; // D7.
+    // The port bits for each nibble.
+    uint8_t nibbleBits[16];
+
+    uint8_t numRows;
+
+    // When the controller will be done with the last instruction, in micros().
+    uint32_t readyTime;
+
+    void send(uint8_t value, bool data, uint16_t executionMicros);
+
+    // The pin transport, in fastlcdpins.cpp. The host tools have their own in
+    // host/hostlcd.cpp, so only these may touch the pins.
+
+    /**
+     * Sets up the pins, with RS low, and waits out the power-on reset.
+     */
+    void beginPins();
+    void waitMicros(uint16_t duration);
+    /**
+     * Sends a nibble as RS was last left, which is low during begin().
+     */
+    void writeNibble(uint8_t nibble);
+    void writeByte(uint8_t value, bool data);
+    /**
+     * Notes that the controller will be busy for this long from now.
+     */
+    void setBusyFor(uint16_t executionMicros);
+    void waitUntilReady();
+    void pulseEnable();
+    void setDataOutput(bool output);
+};
+
+#endif
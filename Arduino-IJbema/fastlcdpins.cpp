@@ -0,0 +1,154 @@
+// FastLCD's pin transport on the AVR: the rest of it, in fastlcd.cpp, only
+// decides what to send. The host tools replace this file with one that
+// clocks the nibbles into a model of the controller.
+
+#include "fastlcd.h"
+
+#include <util/atomic.h>
+
+namespace {
+
+// The power-on reset, with LiquidCrystal's margin.
+uint8_t const POWER_ON_MILLIS = 50;
+
+// micros() counts in steps of this much on a 16 MHz AVR, so a wait measured
+// with it can come out short by up to one step.
+uint8_t const MICROS_STEP = 4;
+
+void writePin(volatile uint8_t *port, uint8_t mask, bool high) {
+  // Interrupt handlers may write other pins of the same port.
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    if (high) {
+      *port |= mask;
+    } else {
+      *port &= ~mask;
+    }
+  }
+}
+
+// Covers the enable pulse width and the data delay time, 450 ns at most,
+// on top of the port write around it.
+inline void waitHalfMicro() {
+  __asm__ __volatile__("nop\n\tnop\n\tnop\n\tnop\n\t");
+}
+
+}
+
+void FastLCD::beginPins() {
+  pinMode(rsPin, OUTPUT);
+  rsPort = portOutputRegister(digitalPinToPort(rsPin));
+  rsMask = digitalPinToBitMask(rsPin);
+  pinMode(enablePin, OUTPUT);
+  enablePort = portOutputRegister(digitalPinToPort(enablePin));
+  enableMask = digitalPinToBitMask(enablePin);
+  if (rwPin != NO_PIN) {
+    pinMode(rwPin, OUTPUT);
+    rwPort = portOutputRegister(digitalPinToPort(rwPin));
+    rwMask = digitalPinToBitMask(rwPin);
+    writePin(rwPort, rwMask, false);
+  }
+
+  uint8_t port = digitalPinToPort(dataPins[0]);
+  bool samePort = true;
+  for (uint8_t i = 0; i < 4; i++) {
+    pinMode(dataPins[i], OUTPUT);
+    samePort = samePort && digitalPinToPort(dataPins[i]) == port;
+  }
+  if (samePort) {
+    dataPort = portOutputRegister(port);
+    dataModePort = portModeRegister(port);
+    dataInputPort = portInputRegister(port);
+    for (uint8_t nibble = 0; nibble < 16; nibble++) {
+      nibbleBits[nibble] = 0;
+      for (uint8_t i = 0; i < 4; i++) {
+        if (nibble & (1 << i)) {
+          nibbleBits[nibble] |= digitalPinToBitMask(dataPins[i]);
+        }
+      }
+    }
+    dataMask = nibbleBits[0x0F];
+    busyMask = nibbleBits[0x08];
+  }
+
+  writePin(rsPort, rsMask, false);
+  writePin(enablePort, enableMask, false);
+  delay(POWER_ON_MILLIS);
+}
+
+void FastLCD::waitMicros(uint16_t duration) {
+  delayMicroseconds(duration);
+}
+
+void FastLCD::writeByte(uint8_t value, bool data) {
+  writePin(rsPort, rsMask, data);
+  writeNibble(value >> 4);
+  writeNibble(value & 0x0F);
+}
+
+void FastLCD::setBusyFor(uint16_t executionMicros) {
+  if (rwPort == nullptr) {
+    readyTime = micros() + executionMicros + MICROS_STEP;
+  }
+}
+
+void FastLCD::writeNibble(uint8_t nibble) {
+  if (dataPort != nullptr) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+      *dataPort = (*dataPort & ~dataMask) | nibbleBits[nibble];
+    }
+  } else {
+    for (uint8_t i = 0; i < 4; i++) {
+      digitalWrite(dataPins[i], (nibble >> i) & 1);
+    }
+  }
+  pulseEnable();
+}
+
+void FastLCD::pulseEnable() {
+  // The controller takes the nibble on the falling edge.
+  writePin(enablePort, enableMask, true);
+  waitHalfMicro();
+  writePin(enablePort, enableMask, false);
+}
+
+void FastLCD::setDataOutput(bool output) {
+  if (dataPort != nullptr) {
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+      if (output) {
+        *dataModePort |= dataMask;
+      } else {
+        // No pull-ups on the inputs.
+        *dataPort &= ~dataMask;
+        *dataModePort &= ~dataMask;
+      }
+    }
+  } else {
+    for (uint8_t i = 0; i < 4; i++) {
+      pinMode(dataPins[i], output ? OUTPUT : INPUT);
+    }
+  }
+}
+
+void FastLCD::waitUntilReady() {
+  if (rwPort == nullptr) {
+    while (int32_t(micros() - readyTime) < 0) {
+    }
+    return;
+  }
+
+  setDataOutput(false);
+  writePin(rsPort, rsMask, false);
+  writePin(rwPort, rwMask, true);
+  bool busy;
+  do {
+    // The busy flag comes with the high nibble; the low one, the address
+    // counter's low bits, still has to be clocked out.
+    writePin(enablePort, enableMask, true);
+    waitHalfMicro();
+    busy = dataPort != nullptr ? (*dataInputPort & busyMask) : digitalRead(dataPins[3]);
+    writePin(enablePort, enableMask, false);
+    pulseEnable();
+  } while (busy);
+  writePin(rwPort, rwMask, false);
+  setDataOutput(true);
+}
@@ -0,0 +1,59 @@
+#include "frameclock.h"
+
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include <util/atomic.h>
+
+namespace {
+
+// At 16 MHz with the /64 prescaler, a frame is 4166 2/3 timer clocks, so
+// two frames of 4167 clocks and one of 4166 make every three exactly 50 ms.
+unsigned const CLOCKS_PER_FRAME = 4167;
+uint8_t const FRAMES_PER_CYCLE = 3;
+
+volatile uint8_t pendingTicks;
+volatile uint8_t cyclePhase;
+
+}
+
+ISR(TIMER1_COMPA_vect) {
+  if (pendingTicks < 0xFF) {
+    pendingTicks++;
+  }
+  // The counter has just restarted from 0, so the new compare value already
+  // applies to the frame that has begun.
+  cyclePhase = cyclePhase + 1 == FRAMES_PER_CYCLE ? 0 : cyclePhase + 1;
+  OCR1A = (cyclePhase == FRAMES_PER_CYCLE - 1 ? CLOCKS_PER_FRAME - 1 : CLOCKS_PER_FRAME) - 1;
+}
+
+void FrameClock::begin() {
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    // CTC mode: count up to OCR1A, interrupt, start over.
+    TCCR1A = 0;
+    TCCR1B = _BV(WGM12) | _BV(CS11) | _BV(CS10);
+    TCNT1 = 0;
+    OCR1A = CLOCKS_PER_FRAME - 1;
+    TIFR1 = _BV(OCF1A);
+    TIMSK1 |= _BV(OCIE1A);
+    pendingTicks = 0;
+    cyclePhase = 0;
+  }
+  missedTicks = 0;
+}
+
+void FrameClock::end() {
+  TIMSK1 &= ~_BV(OCIE1A);
+  TCCR1B = 0;
+}
+
+uint8_t FrameClock::takeTicks() {
+  uint8_t ticks;
+  ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+    ticks = pendingTicks;
+    pendingTicks = 0;
+  }
+  if (ticks > 1) {
+    missedTicks += ticks - 1;
+  }
+  return ticks;
+}
@@ -0,0 +1,38 @@
+#ifndef FRAMECLOCK_H_
+#define FRAMECLOCK_H_
+
+#include <stdint.h>
+
+/**
+ * A steady 60 Hz frame tick from Timer1, so the game runs at the same speed
+ * however long drawing on the LCD takes. There is only one timer, so there
+ * should only be one of these running at a time.
+ */
+class FrameClock {
+  public:
+    FrameClock() : missedTicks(0) {}
+
+    /**
+     * Starts ticking; the first tick comes one frame from now.
+     */
+    void begin();
+
+    /**
+     * Stops ticking.
+     */
+    void end();
+
+    /**
+     * Returns the number of ticks since the previous call, which is 0 while
+     * the current frame hasn't ended yet. Every tick beyond the first counts
+     * as a missed deadline: a frame that started late.
+     */
+    uint8_t takeTicks();
+
+    uint16_t getMissedTicks() const { return missedTicks; }
+
+  private:
+    uint16_t missedTicks;
+};
+
+#endif
@@ -0,0 +1,171 @@
+#include "inputlog.h"
+
+namespace {
+
+// 2: the bag decodes one permutation per seven pieces.
+uint8_t const FORMAT_VERSION = 2;
+
+uint8_t const BUTTONS_MASK = 0b00111111;
+uint8_t const RUN_SHIFT = 6;
+uint8_t const LONG_RUN = 3;
+uint16_t const MAX_RUN_LENGTH = LONG_RUN + 1 + 255;
+
+uint8_t const HEX_PER_LINE = 64;
+
+char const START = '<';
+char const END = '>';
+
+char hexDigit(uint8_t nibble) {
+  return nibble < 10 ? '0' + nibble : 'a' + nibble - 10;
+}
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  } else if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  } else if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  } else {
+    return -1;
+  }
+}
+
+}
+
+void InputRecorder::begin(uint8_t numVisibleRows, uint8_t numCols, uint32_t seed) {
+  out.write(START);
+  column = 0;
+  writeByte(FORMAT_VERSION);
+  writeByte(numVisibleRows);
+  writeByte(numCols);
+  for (uint8_t i = 0; i < 4; i++) {
+    writeByte(seed >> (8 * i));
+  }
+  runLength = 0;
+}
+
+void InputRecorder::record(TetrisButton newButtons) {
+  if (runLength && (newButtons != buttons || runLength == MAX_RUN_LENGTH)) {
+    flushRun();
+  }
+  buttons = newButtons;
+  runLength++;
+}
+
+void InputRecorder::end() {
+  if (runLength) {
+    flushRun();
+  }
+  out.write(END);
+  out.write('\n');
+}
+
+void InputRecorder::flushRun() {
+  if (runLength <= LONG_RUN) {
+    writeByte(uint8_t(buttons) | ((runLength - 1) << RUN_SHIFT));
+  } else {
+    writeByte(uint8_t(buttons) | (LONG_RUN << RUN_SHIFT));
+    writeByte(runLength - LONG_RUN - 1);
+  }
+  runLength = 0;
+}
+
+void InputRecorder::writeByte(uint8_t b) {
+  out.write(hexDigit(b >> 4));
+  out.write(hexDigit(b & 0x0F));
+  column += 2;
+  if (column >= HEX_PER_LINE) {
+    out.write('\n');
+    column = 0;
+  }
+}
+
+InputReplayer::InputReplayer(char const *text) :
+  text(text),
+  valid(false),
+  numVisibleRows(0),
+  numCols(0),
+  seed(0),
+  buttons(TetrisButton::NONE),
+  runLength(0)
+{
+  while (*this->text && *this->text != START) {
+    this->text++;
+  }
+  if (!*this->text) {
+    return;
+  }
+  this->text++;
+
+  if (readByte() != FORMAT_VERSION) {
+    return;
+  }
+  int rows = readByte();
+  int cols = readByte();
+  // The board and the walls round it must fit in a Tetris.
+  if (rows < 0 || cols < 0 || rows + 4u > MAX_ROWS || cols + 4u > MAX_COLS) {
+    return;
+  }
+  numVisibleRows = rows;
+  numCols = cols;
+  for (uint8_t i = 0; i < 4; i++) {
+    int b = readByte();
+    if (b < 0) {
+      return;
+    }
+    seed |= uint32_t(b) << (8 * i);
+  }
+  valid = true;
+}
+
+bool InputReplayer::atEnd() const {
+  if (runLength) {
+    return false;
+  }
+  for (char const *c = text; *c && *c != END; c++) {
+    if (hexValue(*c) >= 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TetrisButton InputReplayer::next() {
+  if (!runLength) {
+    int b = readByte();
+    if (b < 0) {
+      return TetrisButton::NONE;
+    }
+    buttons = TetrisButton(b & BUTTONS_MASK);
+    runLength = (b >> RUN_SHIFT) + 1;
+    if (runLength > LONG_RUN) {
+      int extra = readByte();
+      if (extra < 0) {
+        return TetrisButton::NONE;
+      }
+      runLength = LONG_RUN + 1 + extra;
+    }
+  }
+  runLength--;
+  return buttons;
+}
+
+int InputReplayer::readByte() {
+  int value = 0;
+  for (uint8_t digits = 0; digits < 2; text++) {
+    if (!*text || *text == END) {
+      // Stay at the end from now on.
+      while (*text) {
+        text++;
+      }
+      return -1;
+    }
+    int digit = hexValue(*text);
+    if (digit >= 0) {
+      value = (value << 4) | digit;
+      digits++;
+    }
+  }
+  return value;
+}
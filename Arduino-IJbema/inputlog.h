@@ -0,0 +1,82 @@
+#ifndef INPUTLOG_H_
+#define INPUTLOG_H_
+
+#include "tetris.h"
+
+#include <Arduino.h>
+#include <stdint.h>
+
+//#define RECORD_INPUT // Uncomment to log the input of every game over Serial. Leaves out the B and power button on pin 1.
+
+long const RECORD_BAUDRATE = 115200; // Same as MONITOR_BAUDRATE in the Makefile.
+
+// Format of a log: after a header of FORMAT_VERSION, the number of visible rows,
+// the number of columns and the bag seed (4 bytes, least significant first),
+// every byte holds the buttons held during a run of frames. The low 6 bits are
+// the TetrisButton mask. The high 2 bits are the run length minus 1 for runs
+// of 1 to 3 frames; 3 means the next byte holds the run length minus 4.
+// It is sent as hexadecimal text between '<' and '>', so it survives a serial
+// monitor and can be copied out of one.
+
+/**
+ * Writes the seed and the buttons of every frame of a game to a Print, such
+ * as Serial, so the game can be replayed exactly.
+ */
+class InputRecorder {
+  public:
+    explicit InputRecorder(Print &out) : out(out), buttons(TetrisButton::NONE), runLength(0), column(0) {}
+
+    void begin(uint8_t numVisibleRows, uint8_t numCols, uint32_t seed);
+    void record(TetrisButton buttons);
+    void end();
+
+  private:
+    Print &out;
+    TetrisButton buttons;
+    uint16_t runLength;
+    uint8_t column;
+
+    void flushRun();
+    void writeByte(uint8_t b);
+};
+
+/**
+ * Reads back a log written by InputRecorder, one frame at a time.
+ */
+class InputReplayer {
+  public:
+    /**
+     * Anything in the text before the start of the log is skipped.
+     */
+    explicit InputReplayer(char const *text);
+
+    /**
+     * False if no complete header was found, or if it is for a board too
+     * large for a Tetris.
+     */
+    bool isValid() const { return valid; }
+
+    uint8_t getNumVisibleRows() const { return numVisibleRows; }
+    uint8_t getNumCols() const { return numCols; }
+    uint32_t getSeed() const { return seed; }
+
+    bool atEnd() const;
+
+    /**
+     * Returns the buttons of the next frame, or NONE once at the end.
+     */
+    TetrisButton next();
+
+  private:
+    char const *text;
+    bool valid;
+    uint8_t numVisibleRows;
+    uint8_t numCols;
+    uint32_t seed;
+    TetrisButton buttons;
+    uint16_t runLength;
+
+    int readByte();
+};
+
+#endif
@@ -0,0 +1,114 @@
+#include "journal.h"
+
+#include <avr/eeprom.h>
+#include <avr/io.h>
+#include <stddef.h>
+#include <util/crc16.h>
+
+namespace {
+
+// A power of two that divides 65536, so that sequence numbers keep mapping to
+// the same slots when they wrap around. Slots are counted in 16 bits, as
+// EEPROMs of 4 KB and up hold 256 or more.
+uint8_t const SLOT_SIZE = 16;
+uint16_t const NUM_SLOTS = (E2END + 1) / SLOT_SIZE;
+
+uint8_t *getSlotAddress(uint16_t slot) {
+  return (uint8_t *) uintptr_t(slot * SLOT_SIZE);
+}
+
+}
+
+Journal::Journal()
+  :
+    stats{0, 0, 0, 0, 0},
+    nextSequence(0),
+    pendingBytes(sizeof(Record))
+{
+  static_assert(sizeof(Record) <= SLOT_SIZE, "Journal records don't fit their slots");
+}
+
+void Journal::begin() {
+  // Record n goes into slot n % NUM_SLOTS, so going up from slot 0 the
+  // sequence numbers count up by one until just past the newest record; from
+  // there on the slots hold records from the previous round, or nothing.
+  // That makes the newest record easy to find by bisection.
+  uint16_t first = readSequence(0);
+  uint16_t low = 0;
+  uint16_t high = NUM_SLOTS - 1;
+  while (low < high) {
+    uint16_t mid = (low + high + 1) / 2;
+    if (uint16_t(readSequence(mid) - first) == mid) {
+      low = mid;
+    } else {
+      high = mid - 1;
+    }
+  }
+
+  for (uint16_t i = 0; i < NUM_SLOTS; i++) {
+    uint16_t slot = (low + NUM_SLOTS - i) % NUM_SLOTS;
+    Record record;
+    eeprom_read_block(&record, getSlotAddress(slot), sizeof(record));
+    if (record.crc == getCrc(record) && record.sequence % NUM_SLOTS == slot) {
+      stats = record.stats;
+      nextSequence = record.sequence + 1;
+      return;
+    }
+  }
+  // A blank EEPROM: start afresh.
+}
+
+void Journal::recordGame(uint16_t score, uint8_t level, uint8_t lines) {
+  finish();
+
+  stats.gamesPlayed++;
+  if (score > stats.highScore) {
+    stats.highScore = score;
+  }
+  if (level > stats.highLevel) {
+    stats.highLevel = level;
+  }
+  if (lines > stats.mostLines) {
+    stats.mostLines = lines;
+  }
+  stats.totalLines += lines;
+
+  pending.stats = stats;
+  pending.sequence = nextSequence++;
+  pending.crc = getCrc(pending);
+  pendingBytes = 0;
+}
+
+bool Journal::step() {
+  if (pendingBytes == sizeof(Record)) {
+    return false;
+  }
+  if (eeprom_is_ready()) {
+    uint8_t *address = getSlotAddress(pending.sequence % NUM_SLOTS) + pendingBytes;
+    eeprom_update_byte(address, ((uint8_t const *) &pending)[pendingBytes]);
+    pendingBytes++;
+  }
+  return pendingBytes < sizeof(Record);
+}
+
+void Journal::finish() {
+  while (step()) {
+  }
+}
+
+uint16_t Journal::getCrc(Record const &record) {
+  // Everything but the CRC itself.
+  uint8_t const *bytes = (uint8_t const *) &record;
+  uint16_t crc = 0xFFFF;
+  for (uint8_t i = 0; i < offsetof(Record, crc); i++) {
+    crc = _crc_ccitt_update(crc, bytes[i]);
+  }
+  for (uint8_t i = offsetof(Record, sequence); i < sizeof(Record); i++) {
+    crc = _crc_ccitt_update(crc, bytes[i]);
+  }
+  return crc;
+}
+
+uint16_t Journal::readSequence(uint16_t slot) {
+  return eeprom_read_word((uint16_t const *) (getSlotAddress(slot) + offsetof(Record, sequence)));
+}
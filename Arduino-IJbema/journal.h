@@ -0,0 +1,74 @@
+#ifndef JOURNAL_H_
+#define JOURNAL_H_
+
+#include <stdint.h>
+
+/**
+ * What is kept from one power-up to the next.
+ */
+struct PlayStats {
+  uint16_t gamesPlayed;
+  uint16_t highScore;
+  uint8_t highLevel;
+  uint8_t mostLines;
+  uint32_t totalLines;
+};
+
+/**
+ * Keeps PlayStats in EEPROM as an append-only journal. Every save is a new
+ * record in the next slot, going round the whole EEPROM, so no cell wears out
+ * before the others. Each record carries a CRC, so one that was only partly
+ * written when the power went is passed over for the one before it.
+ *
+ * Records are written a byte per step(), as one EEPROM write takes 3.3 ms, so
+ * saving never holds up a frame.
+ */
+class Journal {
+  public:
+    Journal();
+
+    /**
+     * Finds the newest intact record. Reads a few slots rather than the whole
+     * EEPROM, unless the newest records turn out to be damaged.
+     */
+    void begin();
+
+    PlayStats const &getStats() const { return stats; }
+
+    /**
+     * Adds a finished game to the stats and starts saving them.
+     */
+    void recordGame(uint16_t score, uint8_t level, uint8_t lines);
+
+    /**
+     * Writes the next byte of the record being saved if the EEPROM is ready
+     * for it. Returns false once everything has been written.
+     */
+    bool step();
+
+    /**
+     * Waits for the record being saved to be written completely.
+     */
+    void finish();
+
+  private:
+    struct Record {
+      PlayStats stats;
+      uint16_t crc;
+      // Written last, so the record only counts as the newest once the rest
+      // is in place.
+      uint16_t sequence;
+    };
+
+    PlayStats stats;
+    uint16_t nextSequence;
+
+    // The record being saved, and how many of its bytes have been written.
+    Record pending;
+    uint8_t pendingBytes;
+
+    static uint16_t getCrc(Record const &record);
+    static uint16_t readSequence(uint16_t slot);
+};
+
+#endif
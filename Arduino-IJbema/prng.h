@@ -0,0 +1,78 @@
+#ifndef PRNG_H_
+#define PRNG_H_
+
+#include <stdint.h>
+
+/**
+ * A small pseudorandom number generator with its own state, so that the bag,
+ * the quotes and simulations each have a sequence of their own that depends
+ * only on its seed. Division is slow on the AVR, so it is done only where it
+ * can't be helped, and then rarely.
+ *
+ * https://en.wikipedia.org/wiki/Xorshift
+ */
+class Random {
+  public:
+    /**
+     * The seed is mixed first, so that nearby seeds start far apart in the
+     * sequence rather than dealing the same first pieces.
+     */
+    explicit Random(uint32_t seed) :
+      // Xorshift gets stuck on zero, and only zero mixes to zero.
+      state(seed ? mix(seed) : 0x1234567)
+    {}
+
+    /**
+     * The finalizer of MurmurHash3: a one-to-one mapping in which every bit
+     * of the result depends on every bit of x.
+     */
+    static uint32_t mix(uint32_t x) {
+      x ^= x >> 16;
+      x *= 0x85EBCA6B;
+      x ^= x >> 13;
+      x *= 0xC2B2AE35;
+      x ^= x >> 16;
+      return x;
+    }
+
+    /**
+     * A seed for the stream'th of several generators that all derive from
+     * one seed, each with a sequence of its own.
+     */
+    static uint32_t derive(uint32_t seed, uint32_t stream) {
+      return mix(seed ^ mix(stream + 1));
+    }
+
+    uint32_t next() {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      return state;
+    }
+
+    /**
+     * A number from 0 up to but not including max, every one as likely, by
+     * scaling the high bits rather than taking a remainder.
+     *
+     * Scaling alone would favour some numbers when max doesn't divide 65536,
+     * so the draws that would are thrown away and drawn again. Those are found
+     * by the low half of the product, and only when it is below max does the
+     * exact bound need a division (Lemire, "Fast random integer generation in
+     * an interval").
+     */
+    uint16_t below(uint16_t max) {
+      uint32_t product = uint32_t(next() >> 16) * max;
+      if (uint16_t(product) < max) {
+        uint16_t threshold = uint16_t(-max) % max;
+        while (uint16_t(product) < threshold) {
+          product = uint32_t(next() >> 16) * max;
+        }
+      }
+      return product >> 16;
+    }
+
+  private:
+    uint32_t state;
+};
+
+#endif
@@ -0,0 +1,142 @@
+#include "profiler.h"
+
+#ifdef PROFILE
+
+#include <avr/pgmspace.h>
+
+namespace {
+
+// What each zone may take before it counts as an overrun, out of the
+// 16667 us of a frame.
+uint16_t const BUDGET_MICROS[NUM_PROFILE_ZONES] PROGMEM = {
+  200,  // READ_BUTTONS
+  2000, // LOGIC
+  8000, // RENDER
+  4000, // BITMAP_UPDATE
+  100,  // DECOMPRESS
+};
+
+uint8_t const COLUMN_WIDTH = 7;
+
+struct ZoneStats {
+  uint16_t count;
+  uint16_t minMicros;
+  uint16_t maxMicros;
+  uint16_t overruns;
+  uint32_t totalMicros;
+};
+
+ZoneStats zones[NUM_PROFILE_ZONES];
+
+__FlashStringHelper const *zoneName(uint8_t zone) {
+  switch (ProfileZone(zone)) {
+    case ProfileZone::READ_BUTTONS: return F("buttons");
+    case ProfileZone::LOGIC: return F("logic");
+    case ProfileZone::RENDER: return F("render");
+    case ProfileZone::BITMAP_UPDATE: return F("bitmap");
+    case ProfileZone::DECOMPRESS: return F("decomp");
+    default: return F("?");
+  }
+}
+
+uint16_t getMean(ZoneStats const &stats) {
+  return stats.count ? stats.totalMicros / stats.count : 0;
+}
+
+void printSpaces(Print &out, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++) {
+    out.write(' ');
+  }
+}
+
+// Right-aligned in a column.
+void printColumn(Print &out, uint16_t value) {
+  uint8_t digits = 1;
+  for (uint16_t rest = value / 10; rest; rest /= 10) {
+    digits++;
+  }
+  printSpaces(out, COLUMN_WIDTH - digits);
+  out.print(value);
+}
+
+void writeWord(Print &out, uint16_t value) {
+  out.write(uint8_t(value));
+  out.write(uint8_t(value >> 8));
+}
+
+}
+
+void Profiler::record(ProfileZone zone, uint32_t elapsedMicros) {
+  ZoneStats &stats = zones[uint8_t(zone)];
+  uint16_t elapsed = elapsedMicros < 0xFFFF ? elapsedMicros : 0xFFFF;
+  if (stats.count == 0xFFFF) {
+    // Halving both keeps the mean, now weighted towards recent runs.
+    stats.count /= 2;
+    stats.totalMicros /= 2;
+  }
+  if (stats.count == 0 || elapsed < stats.minMicros) {
+    stats.minMicros = elapsed;
+  }
+  if (elapsed > stats.maxMicros) {
+    stats.maxMicros = elapsed;
+  }
+  if (elapsed > pgm_read_word_near(BUDGET_MICROS + uint8_t(zone)) && stats.overruns < 0xFFFF) {
+    stats.overruns++;
+  }
+  stats.count++;
+  stats.totalMicros += elapsed;
+}
+
+void Profiler::poll() {
+  while (Serial.available() > 0) {
+    switch (Serial.read()) {
+      case 't':
+        printText(Serial);
+        break;
+      case 'b':
+        writeBinary(Serial);
+        break;
+      case 'r':
+        reset();
+        break;
+    }
+  }
+}
+
+void Profiler::printText(Print &out) {
+  out.println(F("zone     count    min   mean    max   over"));
+  for (uint8_t zone = 0; zone < NUM_PROFILE_ZONES; zone++) {
+    ZoneStats const &stats = zones[zone];
+    __FlashStringHelper const *name = zoneName(zone);
+    out.print(name);
+    printSpaces(out, COLUMN_WIDTH - strlen_P((char const *) name));
+    printColumn(out, stats.count);
+    printColumn(out, stats.minMicros);
+    printColumn(out, getMean(stats));
+    printColumn(out, stats.maxMicros);
+    printColumn(out, stats.overruns);
+    out.println();
+  }
+}
+
+void Profiler::writeBinary(Print &out) {
+  out.write('{');
+  out.write(NUM_PROFILE_ZONES);
+  for (uint8_t zone = 0; zone < NUM_PROFILE_ZONES; zone++) {
+    ZoneStats const &stats = zones[zone];
+    writeWord(out, stats.count);
+    writeWord(out, stats.minMicros);
+    writeWord(out, getMean(stats));
+    writeWord(out, stats.maxMicros);
+    writeWord(out, stats.overruns);
+  }
+  out.write('}');
+}
+
+void Profiler::reset() {
+  for (uint8_t zone = 0; zone < NUM_PROFILE_ZONES; zone++) {
+    zones[zone] = ZoneStats();
+  }
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef PROFILER_H_
+#define PROFILER_H_
+
+#include <Arduino.h>
+#include <stdint.h>
+
+//#define PROFILE // Uncomment to time the hot paths and report over Serial. Leaves out the B and power button on pin 1.
+
+long const PROFILE_BAUDRATE = 115200; // Same as MONITOR_BAUDRATE in the Makefile.
+
+/**
+ * The stretches of code that are timed. Zones can nest, and then the time of
+ * the inner one is part of the outer one's too.
+ */
+enum class ProfileZone : uint8_t {
+  READ_BUTTONS,  // TetrisGame::readButtons().
+  LOGIC,         // The Tetris::update() calls of a frame.
+  RENDER,        // TetrisRenderer::render(), the LCD traffic included.
+  BITMAP_UPDATE, // LCDBitmap::update(), within RENDER during a game.
+  DECOMPRESS,    // Decompressor::getNext(), a character of a quote.
+  COUNT
+};
+
+uint8_t const NUM_PROFILE_ZONES = uint8_t(ProfileZone::COUNT);
+
+#ifdef PROFILE
+
+// Requests, sent as a single character over Serial:
+//   't'  Report as text, a line per zone.
+//   'b'  Report in binary: '{', the number of zones, then for every zone its
+//        count, minimum, mean, maximum and overruns as 16-bit numbers, least
+//        significant byte first, and a closing '}'.
+//   'r'  Start over.
+// Times are in microseconds, to the 4 us resolution of micros(). An overrun
+// is a run of a zone that took longer than its budget, see profiler.cpp.
+
+/**
+ * Keeps the minimum, maximum and mean time of every zone, and how often it
+ * went over budget, in a fixed table in RAM.
+ */
+class Profiler {
+  public:
+    static void record(ProfileZone zone, uint32_t elapsedMicros);
+
+    /**
+     * Answers any requests that came in over Serial. Cheap enough to call
+     * every frame.
+     */
+    static void poll();
+
+    static void printText(Print &out);
+    static void writeBinary(Print &out);
+    static void reset();
+};
+
+/**
+ * Times the zone from its construction to the end of its scope.
+ */
+class ProfileTimer {
+  public:
+    explicit ProfileTimer(ProfileZone zone) : zone(zone), start(micros()) {}
+    ~ProfileTimer() { Profiler::record(zone, micros() - start); }
+
+  private:
+    ProfileZone const zone;
+    uint32_t const start;
+};
+
+#define PROFILE_ZONE(zone) ProfileTimer profileTimer(ProfileZone::zone)
+#define PROFILE_POLL() Profiler::poll()
+
+#else
+
+#define PROFILE_ZONE(zone)
+#define PROFILE_POLL()
+
+#endif
+
+#endif
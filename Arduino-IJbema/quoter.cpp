@@ -2,16 +2,35 @@
 
 #include "quotes.h"
 #include "decompress.h"
+#include "fastlcd.h"
+#include "textlayer.h"
 #include "utils.h"
 
 #include <Arduino.h>
-#include <LiquidCrystal.h>
 #include <avr/pgmspace.h>
 
 namespace {
 
 int const LCD_WIDTH = 16;
 
+#ifdef MARQUEE_QUOTES
+
+// Each line of the LCD's memory. The display shows LCD_WIDTH columns of it
+// from the shift on, wrapping round at the end.
+uint8_t const LINE_LENGTH = 40;
+
+// The address counter runs on from the end of one line into the other, so
+// it is set back to the start of the line there.
+void writeRound(FastLCD &lcd, char c, uint8_t &column, uint8_t row) {
+  lcd.write(c);
+  if (++column == LINE_LENGTH) {
+    column = 0;
+    lcd.setCursor(column, row);
+  }
+}
+
+#else
+
 void fillWithSpaces(char *buffer, int length) {
   buffer[length] = '\0';
   for (length--; length >= 0; length--) {
@@ -25,47 +44,100 @@ void shiftLeft(char *buffer, int length) {
   }
 }
 
+#endif
+
 }
 
 void Quoter::showRandomQuote() {
-  int quoteIndex = random(NUM_QUOTES);
-  char const *quote = (char const *) pgm_read_word_near(QUOTES + quoteIndex);
-  
-  lcd.clear();
-  lcd.home();
-  lcd.print(F("Mark zou zeggen:"));
+  int quoteIndex = random.below(NUM_QUOTES);
+  int group = quoteIndex / QUOTES_PER_INDEX;
+  char const *start = QUOTE_DATA + (group > 0 ? pgm_read_word_near(QUOTE_INDEX + group - 1) : 0);
+  Decompressor dec(start, QUOTE_CODE, QUOTE_DICTIONARY);
+  for (int i = group * QUOTES_PER_INDEX; i < quoteIndex; i++) {
+    dec.skip();
+  }
+
+  scrollQuote(dec);
+}
+
+#ifdef MARQUEE_QUOTES
+
+void Quoter::scrollQuote(Decompressor &dec) {
+  // Written twice, the header fills its line and scrolls round with the
+  // quote as a banner, so it never has to be sent again.
+  text.clear();
+  for (int i = 0; i < 2; i++) {
+    lcd.print(F("Mark zou zeggen:    "));
+  }
+
+  // Each character goes into the column just right of the shown ones, and
+  // a shift brings it into view.
+  uint8_t column = LCD_WIDTH;
+  lcd.setCursor(column, 1);
+  while (char c = dec.getNext()) {
+    writeRound(lcd, c, column, 1);
+    lcd.scrollDisplayLeft();
+    if (interruptibleDelay(200)) return;
+  }
+  for (int i = 0; i < LCD_WIDTH; i++) {
+    writeRound(lcd, ' ', column, 1);
+    lcd.scrollDisplayLeft();
+    if (interruptibleDelay(200)) return;
+  }
+
+  if (interruptibleDelay(500)) return;
+
+  // The shown part of the header's line starts LCD_WIDTH columns back.
+  column = (column + LINE_LENGTH - LCD_WIDTH) % LINE_LENGTH;
+  lcd.setCursor(column, 0);
+  for (int i = 0; i < LCD_WIDTH; i++) {
+    writeRound(lcd, ' ', column, 0);
+    if (interruptibleDelay(20)) return;
+  }
+
+  // Also sets the shift back.
+  text.clear();
+}
+
+#else
+
+void Quoter::scrollQuote(Decompressor &dec) {
+  text.clear();
+  text.setCursor(0, 0);
+  text.print(F("Mark zou zeggen:"));
+  text.update();
 
   char buffer[LCD_WIDTH + 1];
   fillWithSpaces(buffer, LCD_WIDTH);
-  Decompressor dec(quote);
   while (char c = dec.getNext()) {
     shiftLeft(buffer, LCD_WIDTH);
     buffer[LCD_WIDTH - 1] = c;
     
-    lcd.setCursor(0, 1);
-    lcd.print(buffer);
+    text.setCursor(0, 1);
+    text.print(buffer);
+    text.update();
     if (interruptibleDelay(200)) return;
-
-    quote++;
   }
   for (int i = 0; i < LCD_WIDTH; i++) {
     shiftLeft(buffer, LCD_WIDTH);
     buffer[LCD_WIDTH - 1] = ' ';
     
-    lcd.setCursor(0, 1);
-    lcd.print(buffer);
+    text.setCursor(0, 1);
+    text.print(buffer);
+    text.update();
     if (interruptibleDelay(200)) return;
   }
 
   if (interruptibleDelay(500)) return;
 
-  lcd.setCursor(0, 0);
+  text.setCursor(0, 0);
   for (int i = 0; i < LCD_WIDTH; i++) {
-    lcd.print(' ');
+    text.print(' ');
+    text.update();
     if (interruptibleDelay(20)) return;
   }
   
-  lcd.clear();
+  text.clear();
 }
 
-#include "quotes.h"
+#endif
@@ -1,19 +1,40 @@
 #ifndef QUOTER_H
 #define QUOTER_H
 
+#include "prng.h"
+
+#include <stdint.h>
+
+#define MARQUEE_QUOTES // Comment out to scroll quotes by rewriting the whole line each step, with the header kept still.
+
+class Decompressor;
+class FastLCD;
 class InterruptibleDelay;
-class LiquidCrystal;
+class TextLayer;
 
+/**
+ * Shows a random quote, a character at a time as it scrolls in from the
+ * right. With MARQUEE_QUOTES, each character is written once into the LCD's
+ * 40-column line memory, used as a ring, and the display shift scrolls it
+ * into view. The shift moves the header line too, so the header is written
+ * twice round its line and scrolls along as a banner.
+ */
 class Quoter {
   public:
-    Quoter(LiquidCrystal &lcd, InterruptibleDelay &interruptibleDelay) :
-      lcd(lcd), interruptibleDelay(interruptibleDelay) {}
+    Quoter(FastLCD &lcd, TextLayer &text, InterruptibleDelay &interruptibleDelay) :
+      lcd(lcd), text(text), interruptibleDelay(interruptibleDelay), random(0) {}
+
+    void seed(uint32_t seed) { random = Random(seed); }
 
     void showRandomQuote();
 
   private:
-    LiquidCrystal &lcd;
+    FastLCD &lcd;
+    TextLayer &text;
     InterruptibleDelay &interruptibleDelay;
+    Random random;
+
+    void scrollQuote(Decompressor &dec);
 };
 
 #endif
@@ -4,394 +4,624 @@
 
 #include <avr/pgmspace.h>
 
-static char const QUOTE_0[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)26, (char)75, (char)128, (char)151, (char)1, (char)37, (char)164, (char)192, (char)130, (char)149, (char)128, (char)97, (char)86, (char)178, (char)202, (char)126, (char)46, (char)2, (char)3, (char)57, (char)22, (char)158, (char)63, (char)248};
-static char const QUOTE_1[] PROGMEM = {(char)101, (char)92, (char)52, (char)120, (char)252, (char)9, (char)152, (char)16, (char)90, (char)0, (char)44, (char)5, (char)202, (char)89, (char)3, (char)79, (char)3, (char)2, (char)26, (char)120, (char)252, (char)8, (char)40, (char)128, (char)226, (char)208, (char)13, (char)74, (char)156, (char)7, (char)186, (char)130, (char)74, (char)168, (char)7, (char)192, (char)30, (char)58, (char)220, (char)62};
-static char const QUOTE_2[] PROGMEM = {(char)124, (char)37, (char)84, (char)180, (char)174, (char)5, (char)146, (char)226, (char)1, (char)43, (char)5, (char)202, (char)192, (char)61, (char)126, (char)46, (char)2, (char)11, (char)64, (char)38, (char)96, (char)152, (char)208, (char)247, (char)185, (char)161, (char)89, (char)92, (char)11, (char)132, (char)50, (char)2, (char)86, (char)2, (char)141, (char)20, (char)1, (char)74, (char)224, (char)76, (char)104, (char)172, (char)141, (char)68, (char)21, (char)101, (char)96, (char)2, (char)23, (char)1, (char)5, (char)23, (char)192};
-static char const QUOTE_3[] PROGMEM = {(char)124, (char)37, (char)84, (char)180, (char)174, (char)241, (char)248, (char)30, (char)3, (char)188, (char)128, (char)80, (char)64, (char)208, (char)202, (char)137, (char)113, (char)64, (char)183, (char)182, (char)128, (char)107, (char)228, (char)114, (char)187, (char)224};
-static char const QUOTE_4[] PROGMEM = {(char)154, (char)92, (char)112, (char)86, (char)96, (char)8, (char)38, (char)247, (char)31, (char)197, (char)128, (char)203, (char)235, (char)226, (char)121, (char)20, (char)20, (char)65, (char)65, (char)4, (char)133, (char)207, (char)104, (char)93, (char)240};
-static char const QUOTE_5[] PROGMEM = {(char)81, (char)64, (char)34, (char)186, (char)128, (char)97, (char)88, (char)149, (char)44, (char)1, (char)100, (char)192, (char)162, (char)129, (char)165, (char)160, (char)20, (char)80, (char)49, (char)48, (char)4, (char)232, (char)16, (char)208, (char)20, (char)40, (char)33, (char)42, (char)165, (char)133, (char)119, (char)192};
-static char const QUOTE_6[] PROGMEM = {(char)64, (char)103, (char)34, (char)211, (char)199, (char)224, (char)217, (char)222, (char)75, (char)22, (char)94, (char)44, (char)7, (char)29, (char)80, (char)32, (char)162, (char)2, (char)86, (char)4, (char)61, (char)199, (char)44, (char)190};
-static char const QUOTE_7[] PROGMEM = {(char)106, (char)84, (char)224, (char)46, (char)73, (char)113, (char)231, (char)4, (char)150, (char)64, (char)35, (char)203, (char)64, (char)57, (char)231, (char)4, (char)18, (char)167, (char)2, (char)193, (char)112, (char)8, (char)80, (char)73, (char)228, (char)40, (char)38, (char)26, (char)204, (char)30, (char)45, (char)242, (char)255, (char)139, (char)124, (char)119, (char)227, (char)191, (char)29, (char)252};
-static char const QUOTE_8[] PROGMEM = {(char)44, (char)129, (char)164, (char)208, (char)5, (char)26, (char)40, (char)11, (char)20, (char)172, (char)3, (char)82, (char)226, (char)22, (char)64, (char)179, (char)10, (char)89, (char)129, (char)240, (char)1, (char)10, (char)1, (char)73, (char)239, (char)34, (char)139, (char)48, (char)9, (char)42, (char)1, (char)10, (char)4, (char)6, (char)114, (char)45, (char)1, (char)66, (char)156, (char)174, (char)187, (char)223, (char)34, (char)36, (char)255};
-static char const QUOTE_9[] PROGMEM = {(char)58, (char)72, (char)87, (char)184, (char)8, (char)41, (char)77, (char)64, (char)16, (char)160, (char)64, (char)103, (char)34, (char)208, (char)15, (char)117, (char)8, (char)85, (char)208, (char)20, (char)121, (char)92, (char)4, (char)22, (char)128, (char)115, (char)206, (char)10, (char)184, (char)133, (char)145, (char)228, (char)250, (char)184, (char)128, (char)184, (char)103, (char)240};
-static char const QUOTE_10[] PROGMEM = {(char)35, (char)202, (char)226, (char)203, (char)197, (char)128, (char)104, (char)70, (char)138, (char)2, (char)99, (char)71, (char)189, (char)156, (char)89, (char)120, (char)135, (char)224};
-static char const QUOTE_11[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)26, (char)75, (char)128, (char)151, (char)2, (char)105, (char)33, (char)64, (char)234, (char)252};
-static char const QUOTE_12[] PROGMEM = {(char)82, (char)84, (char)4, (char)20, (char)84, (char)1, (char)74, (char)224, (char)80, (char)212, (char)1, (char)203, (char)58, (char)61, (char)133, (char)112, (char)10, (char)224, (char)65, (char)58, (char)208, (char)64, (char)114, (char)156, (char)180, (char)43, (char)190};
-static char const QUOTE_13[] PROGMEM = {(char)37, (char)81, (char)226, (char)192, (char)92, (char)165, (char)160, (char)20, (char)80, (char)104, (char)172, (char)48, (char)30, (char)245, (char)130, (char)229, (char)103, (char)192};
-static char const QUOTE_14[] PROGMEM = {(char)37, (char)81, (char)226, (char)192, (char)16, (char)52, (char)3, (char)18, (char)165, (char)208, (char)13, (char)40, (char)11, (char)100, (char)144, (char)174, (char)167, (char)192};
-static char const QUOTE_15[] PROGMEM = {(char)65, (char)104, (char)2, (char)185, (char)39, (char)40, (char)22, (char)26, (char)60, (char)174, (char)5, (char)195, (char)64, (char)37, (char)96, (char)211, (char)193, (char)66, (char)131, (char)73, (char)43, (char)128, (char)130, (char)136, (char)9, (char)152, (char)26, (char)149, (char)56, (char)12, (char)10, (char)202, (char)237, (char)5, (char)126, (char)44, (char)3, (char)66, (char)25, (char)0, (char)137, (char)40, (char)19, (char)48, (char)52, (char)33, (char)144, (char)44, (char)247, (char)200, (char)30, (char)54, (char)241, (char)175, (char)137, (char)64, (char)176, (char)209, (char)229, (char)119, (char)192};
-static char const QUOTE_16[] PROGMEM = {(char)64, (char)80, (char)20, (char)5, (char)1, (char)64, (char)80, (char)31, (char)22, (char)3, (char)11, (char)25, (char)0, (char)130, (char)150, (char)83, (char)167, (char)192};
-static char const QUOTE_17[] PROGMEM = {(char)195, (char)91, (char)48, (char)57, (char)37, (char)160, (char)26, (char)82, (char)200, (char)9, (char)112, (char)3, (char)10, (char)120, (char)252, (char)8, (char)45, (char)0, (char)153, (char)128, (char)44, (char)97, (char)90, (char)16, (char)176, (char)1, (char)113, (char)36, (char)95, (char)19, (char)204, (char)19, (char)26, (char)42, (char)194, (char)120, (char)135, (char)224};
-static char const QUOTE_18[] PROGMEM = {(char)97, (char)86, (char)178, (char)128, (char)65, (char)113, (char)1, (char)227, (char)242, (char)4, (char)50, (char)2, (char)10, (char)32, (char)40, (char)160, (char)163, (char)198, (char)128, (char)52, (char)165, (char)145, (char)11, (char)34, (char)128, (char)201, (char)45, (char)38, (char)87, (char)2, (char)207, (char)124, (char)190};
-static char const QUOTE_19[] PROGMEM = {(char)74, (char)192, (char)176, (char)184, (char)13, (char)40, (char)10, (char)52, (char)80, (char)14, (char)73, (char)104, (char)6, (char)148, (char)178, (char)5, (char)158, (char)249, (char)78, (char)133, (char)99, (char)10, (char)224, (char)16, (char)52, (char)2, (char)86, (char)13, (char)60, (char)4, (char)74, (char)193, (char)112, (char)207, (char)197, (char)192, (char)40, (char)209, (char)64, (char)57, (char)37, (char)167, (char)192};
-static char const QUOTE_20[] PROGMEM = {(char)65, (char)104, (char)3, (char)62, (char)85, (char)111, (char)143, (char)192, (char)130, (char)231, (char)197, (char)128, (char)65, (char)104, (char)4, (char)204, (char)9, (char)73, (char)192, (char)114, (char)149, (char)192, (char)130, (char)32, (char)33, (char)124};
-static char const QUOTE_21[] PROGMEM = {(char)74, (char)192, (char)71, (char)148, (char)14, (char)123, (char)211, (char)64, (char)4, (char)46, (char)0, (char)222, (char)214, (char)149, (char)212, (char)159, (char)192};
-static char const QUOTE_22[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)13, (char)74, (char)156, (char)10, (char)21, (char)133, (char)51, (char)222, (char)224, (char)52, (char)33, (char)144, (char)46, (char)82, (char)200, (char)9, (char)112, (char)4, (char)25, (char)208, (char)33, (char)145, (char)26, (char)242, (char)20, (char)7, (char)46, (char)139, (char)79, (char)128};
-static char const QUOTE_23[] PROGMEM = {(char)122, (char)0, (char)119, (char)147, (char)197, (char)128, (char)44, (char)128, (char)34, (char)178, (char)128, (char)185, (char)75, (char)32, (char)20, (char)174, (char)3, (char)67, (char)37, (char)150, (char)137, (char)113, (char)219, (char)88, (char)64, (char)180, (char)248};
-static char const QUOTE_24[] PROGMEM = {(char)106, (char)84, (char)224, (char)80, (char)172, (char)41, (char)158, (char)247, (char)1, (char)51, (char)1, (char)74, (char)224, (char)60, (char)192, (char)11, (char)136, (char)89, (char)2, (char)112, (char)40, (char)210, (char)16, (char)176, (char)18, (char)120, (char)132, (char)146, (char)130, (char)233, (char)99, (char)18, (char)22, (char)204, (char)16, (char)10, (char)214, (char)90, (char)124};
-static char const QUOTE_25[] PROGMEM = {(char)81, (char)64, (char)215, (char)150, (char)128, (char)57, (char)110, (char)247, (char)184, (char)5, (char)43, (char)129, (char)53, (char)230, (char)5, (char)5, (char)10, (char)194, (char)153, (char)239, (char)112, (char)22, (char)248, (char)21, (char)223};
-static char const QUOTE_26[] PROGMEM = {(char)106, (char)84, (char)224, (char)10, (char)79, (char)44, (char)168, (char)162, (char)129, (char)5, (char)41, (char)168, (char)2, (char)149, (char)192, (char)220, (char)184, (char)241, (char)9, (char)37, (char)6, (char)239, (char)196, (char)177, (char)137, (char)11, (char)102, (char)10, (char)21, (char)133, (char)51, (char)222, (char)239, (char)128};
-static char const QUOTE_27[] PROGMEM = {(char)210, (char)89, (char)98, (char)202, (char)201, (char)154, (char)139, (char)226, (char)16, (char)110, (char)1, (char)114, (char)74, (char)191, (char)16, (char)252};
-static char const QUOTE_28[] PROGMEM = {(char)210, (char)89, (char)98, (char)202, (char)201, (char)154, (char)139, (char)63, (char)31, (char)129, (char)73, (char)80, (char)26, (char)19, (char)128, (char)229, (char)43, (char)128, (char)39, (char)149, (char)101, (char)112, (char)26, (char)82, (char)200, (char)22, (char)11, (char)128, (char)210, (char)129, (char)133, (char)113, (char)93, (char)240};
-static char const QUOTE_29[] PROGMEM = {(char)74, (char)193, (char)100, (char)184, (char)128, (char)83, (char)234, (char)7, (char)189, (char)96, (char)98, (char)74, (char)96, (char)33, (char)239, (char)151, (char)192};
-static char const QUOTE_30[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)7, (char)45, (char)222, (char)247, (char)0, (char)165, (char)112, (char)16, (char)85, (char)149, (char)128, (char)8, (char)92, (char)2, (char)61, (char)173, (char)40, (char)26, (char)87, (char)76, (char)174, (char)248};
-static char const QUOTE_31[] PROGMEM = {(char)243, (char)244, (char)19, (char)32, (char)134, (char)138, (char)44, (char)252, (char)67, (char)240};
-static char const QUOTE_32[] PROGMEM = {(char)107, (char)221, (char)76, (char)130, (char)25, (char)162, (char)30, (char)239, (char)16, (char)130, (char)225, (char)160, (char)28, (char)4, (char)21, (char)132, (char)43, (char)188, (char)67, (char)240};
-static char const QUOTE_33[] PROGMEM = {(char)185, (char)64, (char)25, (char)20, (char)20, (char)65, (char)64, (char)183, (char)36, (char)232, (char)164, (char)193, (char)116, (char)60, (char)19, (char)14, (char)64, (char)228, (char)248, (char)135, (char)224};
-static char const QUOTE_34[] PROGMEM = {(char)91, (char)204, (char)100, (char)151, (char)197, (char)192, (char)107, (char)90, (char)223, (char)128};
-static char const QUOTE_35[] PROGMEM = {(char)122, (char)0, (char)208, (char)184, (char)9, (char)33, (char)62};
-static char const QUOTE_36[] PROGMEM = {(char)40, (char)209, (char)66, (char)129, (char)161, (char)115, (char)138, (char)224, (char)78, (char)15, (char)149, (char)10, (char)224, (char)120, (char)203, (char)198, (char)0, (char)80, (char)67, (char)32, (char)57, (char)37, (char)167, (char)192};
-static char const QUOTE_37[] PROGMEM = {(char)216, (char)211, (char)64, (char)209, (char)47, (char)112, (char)28, (char)82, (char)144, (char)164, (char)248};
-static char const QUOTE_38[] PROGMEM = {(char)65, (char)104, (char)4, (char)186, (char)133, (char)147, (char)139, (char)64, (char)32, (char)165, (char)53, (char)0, (char)22, (char)81, (char)42, (char)32, (char)14, (char)86, (char)37, (char)75, (char)248};
-static char const QUOTE_39[] PROGMEM = {(char)11, (char)38, (char)5, (char)20, (char)5, (char)43, (char)128, (char)208, (char)157, (char)197, (char)164, (char)158, (char)224, (char)32, (char)36, (char)1, (char)202, (char)128, (char)147, (char)197, (char)222, (char)46, (char)241, (char)119, (char)192};
-static char const QUOTE_40[] PROGMEM = {(char)45, (char)10, (char)239, (char)31, (char)130, (char)9, (char)214, (char)131, (char)226, (char)224, (char)120, (char)199, (char)199, (char)0, (char)106, (char)93, (char)90, (char)21, (char)223};
-static char const QUOTE_41[] PROGMEM = {(char)122, (char)0, (char)160, (char)248, (char)176, (char)9, (char)88, (char)26, (char)242, (char)208, (char)14, (char)121, (char)192, (char)82, (char)184, (char)16, (char)78, (char)180, (char)16, (char)45, (char)240, (char)43, (char)190};
-static char const QUOTE_42[] PROGMEM = {(char)81, (char)64, (char)186, (char)186, (char)128, (char)57, (char)110, (char)247, (char)184, (char)5, (char)43, (char)129, (char)73, (char)85, (char)32, (char)64, (char)88, (char)87, (char)1, (char)46, (char)1, (char)10, (char)7, (char)76, (char)215, (char)248};
-static char const QUOTE_43[] PROGMEM = {(char)74, (char)192, (char)100, (char)150, (char)147, (char)0, (char)89, (char)68, (char)168, (char)128, (char)75, (char)128, (char)66, (char)130, (char)233, (char)117, (char)11, (char)32, (char)52, (char)180, (char)5, (char)38, (char)132, (char)202, (char)147, (char)0, (char)66, (char)239, (char)128};
-static char const QUOTE_44[] PROGMEM = {(char)91, (char)234, (char)79, (char)31, (char)129, (char)169, (char)45, (char)20, (char)95, (char)16, (char)252};
-static char const QUOTE_45[] PROGMEM = {(char)91, (char)234, (char)79, (char)16, (char)130, (char)210, (char)121, (char)78, (char)89, (char)1, (char)1, (char)32, (char)18, (char)176, (char)22, (char)64, (char)163, (char)198, (char)128, (char)53, (char)46, (char)33, (char)100, (char)6, (char)6, (char)116, (char)5, (char)130, (char)239, (char)23, (char)120, (char)187, (char)197, (char)223};
-static char const QUOTE_46[] PROGMEM = {(char)69, (char)41, (char)15, (char)29, (char)120, (char)191, (char)197, (char)243, (char)11, (char)124, (char)93, (char)167, (char)231, (char)197, (char)207, (char)145, (char)252, (char)94, (char)119, (char)134, (char)147, (char)47, (char)139, (char)206, (char)240, (char)210, (char)101, (char)241, (char)109, (char)17, (char)39, (char)221, (char)46, (char)63, (char)139, (char)78, (char)22, (char)151, (char)197, (char)208, (char)33, (char)128, (char)149, (char)131, (char)69, (char)63, (char)139, (char)0, (char)66, (char)129, (char)211, (char)53, (char)192, (char)130, (char)148, (char)212, (char)1, (char)19, (char)64, (char)57, (char)228, (char)73, (char)254};
-static char const QUOTE_47[] PROGMEM = {(char)153, (char)93, (char)50, (char)191, (char)196, (char)32, (char)184, (char)104, (char)2, (char)4, (char)50, (char)105, (char)75, (char)227, (char)240, (char)89, (char)37, (char)209, (char)64, (char)183, (char)152, (char)201, (char)47, (char)139, (char)128, (char)208, (char)134, (char)64, (char)185, (char)88, (char)6, (char)150, (char)128, (char)24, (char)76, (char)98, (char)165, (char)197, (char)248};
-static char const QUOTE_48[] PROGMEM = {(char)241, (char)225, (char)82, (char)226, (char)20, (char)18, (char)11, (char)169, (char)227, (char)239, (char)128};
-static char const QUOTE_49[] PROGMEM = {(char)217, (char)92, (char)2, (char)5, (char)192, (char)65, (char)68, (char)5, (char)20, (char)8, (char)45, (char)0, (char)231, (char)156, (char)14, (char)73, (char)104, (char)2, (char)149, (char)211, (char)3, (char)236, (char)89, (char)1, (char)5, (char)160, (char)31, (char)113, (char)0, (char)229, (char)64, (char)72, (char)15, (char)32, (char)121, (char)127, (char)200, (char)31};
-static char const QUOTE_50[] PROGMEM = {(char)81, (char)64, (char)48, (char)194, (char)108, (char)120, (char)214, (char)9, (char)208, (char)33, (char)160, (char)2, (char)23, (char)120, (char)184, (char)9, (char)88, (char)8, (char)87, (char)47, (char)197, (char)128, (char)74, (char)193, (char)162, (char)156, (char)20, (char)1, (char)141, (char)240};
-static char const QUOTE_51[] PROGMEM = {(char)56, (char)105, (char)98, (char)200, (char)129, (char)107, (char)75, (char)226, (char)192, (char)109, (char)1, (char)101, (char)131, (char)36, (char)184, (char)191};
-static char const QUOTE_52[] PROGMEM = {(char)216, (char)110, (char)89, (char)189, (char)165, (char)7, (char)142, (char)136, (char)15, (char)29, (char)19, (char)224};
-static char const QUOTE_53[] PROGMEM = {(char)106, (char)84, (char)224, (char)6, (char)207, (char)113, (char)11, (char)66, (char)184, (char)22, (char)11, (char)129, (char)96, (char)184, (char)54, (char)123, (char)136, (char)11, (char)134, (char)96, (char)241, (char)144, (char)38, (char)23, (char)18, (char)233, (char)26, (char)11, (char)48, (char)21, (char)192, (char)41, (char)92, (char)8, (char)84, (char)132, (char)75, (char)142, (char)41, (char)61, (char)228, (char)81, (char)126};
-static char const QUOTE_54[] PROGMEM = {(char)73, (char)129, (char)151, (char)214, (char)69, (char)2, (char)3, (char)8, (char)100, (char)1, (char)113, (char)1, (char)151, (char)212, (char)11, (char)115, (char)238, (char)4, (char)208, (char)19, (char)203, (char)168, (char)28, (char)0, (char)178, (char)147, (char)229, (char)226, (char)224, (char)79, (char)46, (char)160, (char)112, (char)2, (char)202, (char)79, (char)151, (char)139, (char)190};
-static char const QUOTE_55[] PROGMEM = {(char)217, (char)3, (char)64, (char)36, (char)133, (char)41, (char)74, (char)82, (char)148, (char)165, (char)41, (char)74, (char)82, (char)148, (char)165, (char)41, (char)74, (char)82, (char)148, (char)165, (char)41, (char)74, (char)82, (char)148, (char)165, (char)41, (char)74, (char)94, (char)20, (char)165, (char)41, (char)74, (char)82, (char)148, (char)165, (char)41, (char)74, (char)95, (char)128};
-static char const QUOTE_56[] PROGMEM = {(char)203, (char)234, (char)1, (char)133, (char)222, (char)39, (char)160, (char)4, (char)80, (char)48, (char)58, (char)207, (char)136, (char)126};
-static char const QUOTE_57[] PROGMEM = {(char)57, (char)74, (char)224, (char)105, (char)46, (char)241, (char)248, (char)28, (char)149, (char)204, (char)4, (char)8, (char)101, (char)96, (char)187, (char)197, (char)128, (char)8, (char)92, (char)4, (char)22, (char)128, (char)185, (char)100, (char)191, (char)128};
-static char const QUOTE_58[] PROGMEM = {(char)57, (char)74, (char)224, (char)105, (char)46, (char)241, (char)248, (char)20, (char)16, (char)32, (char)44, (char)99, (char)252, (char)88, (char)5, (char)20, (char)23, (char)75, (char)1, (char)71, (char)141, (char)0, (char)114, (char)75, (char)64, (char)37, (char)192, (char)106, (char)84, (char)11, (char)22, (char)65, (char)113, (char)11, (char)34, (char)187, (char)199, (char)255};
-static char const QUOTE_59[] PROGMEM = {(char)57, (char)69, (char)42, (char)165, (char)96, (char)81, (char)64, (char)231, (char)212, (char)14, (char)121, (char)193, (char)58, (char)20, (char)164, (char)152, (char)35, (char)114, (char)202, (char)153, (char)241, (char)248, (char)9, (char)103, (char)200, (char)43, (char)2, (char)102, (char)2, (char)141, (char)20, (char)5, (char)139, (char)32, (char)78, (char)176, (char)44, (char)146, (char)90, (char)203, (char)224};
-static char const QUOTE_60[] PROGMEM = {(char)11, (char)38, (char)5, (char)20, (char)26, (char)185, (char)75, (char)64, (char)8, (char)174, (char)2, (char)138, (char)3, (char)150, (char)239, (char)123, (char)129, (char)66, (char)128, (char)137, (char)95, (char)192};
-static char const QUOTE_61[] PROGMEM = {(char)88, (char)104, (char)242, (char)184, (char)9, (char)152, (char)23, (char)90, (char)120, (char)184, (char)9, (char)88, (char)38, (char)224, (char)192, (char)14, (char)73, (char)104, (char)2, (char)6, (char)128, (char)74, (char)193, (char)105, (char)60, (char)167, (char)44, (char)128, (char)151, (char)1, (char)97, (char)163, (char)202, (char)224, (char)78, (char)15, (char)149, (char)40, (char)95, (char)128};
-static char const QUOTE_62[] PROGMEM = {(char)80, (char)124, (char)88, (char)3, (char)190, (char)68, (char)123, (char)188, (char)88, (char)11, (char)134, (char)128, (char)112, (char)16, (char)86, (char)19, (char)224};
-static char const QUOTE_63[] PROGMEM = {(char)64, (char)80, (char)20, (char)4, (char)9, (char)88, (char)46, (char)25, (char)130, (char)197, (char)145, (char)203, (char)66, (char)184, (char)8, (char)121, (char)64, (char)27, (char)150, (char)111, (char)105, (char)64, (char)119, (char)200, (char)143, (char)112, (char)36, (char)22, (char)204, (char)57, (char)2, (char)103, (char)240};
-static char const QUOTE_64[] PROGMEM = {(char)74, (char)193, (char)100, (char)184, (char)128, (char)160, (char)46, (char)86, (char)1, (char)175, (char)122, (char)64, (char)64, (char)208, (char)18, (char)11, (char)102, (char)28, (char)128, (char)133, (char)114, (char)232, (char)2, (char)6, (char)128, (char)73, (char)64, (char)55, (char)186, (char)116, (char)149, (char)71, (char)68, (char)216, (char)160, (char)28, (char)147, (char)68, (char)141, (char)51, (char)104, (char)14, (char)82, (char)154, (char)159};
-static char const QUOTE_65[] PROGMEM = {(char)65, (char)65, (char)98, (char)202, (char)65, (char)156, (char)202, (char)226, (char)120, (char)176, (char)7, (char)124, (char)136, (char)247, (char)2, (char)65, (char)108, (char)195, (char)144, (char)32, (char)165, (char)53, (char)0, (char)64, (char)132, (char)151, (char)44, (char)150, (char)86, (char)37, (char)75, (char)4, (char)224, (char)146, (char)200, (char)174, (char)248};
-static char const QUOTE_66[] PROGMEM = {(char)44, (char)129, (char)164, (char)208, (char)14, (char)168, (char)52, (char)255, (char)19, (char)184, (char)23, (char)8, (char)100, (char)66, (char)177, (char)239, (char)152, (char)18, (char)86, (char)133, (char)196, (char)0, (char)146, (char)160, (char)72, (char)45, (char)153, (char)115, (char)226, (char)224, (char)29, (char)242, (char)35, (char)220, (char)3, (char)132, (char)52, (char)1, (char)18, (char)80, (char)22, (char)64, (char)179, (char)216, (char)114, (char)184, (char)133, (char)2, (char)202, (char)89, (char)2, (char)229, (char)96, (char)42, (char)154, (char)29, (char)239, (char)73, (char)93, (char)240};
-static char const QUOTE_67[] PROGMEM = {(char)59, (char)200, (char)162, (char)234, (char)179, (char)241, (char)96, (char)39, (char)64, (char)129, (char)43, (char)6, (char)158, (char)11, (char)73, (char)229, (char)56, (char)31, (char)15, (char)22, (char)2, (char)108, (char)8, (char)78, (char)4, (char)172, (char)5, (char)144, (char)2, (char)201, (char)185, (char)231, (char)2, (char)92, (char)10, (char)20, (char)12, (char)8, (char)104, (char)10, (char)20, (char)11, (char)123, (char)74, (char)239, (char)23, (char)3, (char)197, (char)190, (char)46, (char)241, (char)111, (char)142, (char)254};
-static char const QUOTE_68[] PROGMEM = {(char)65, (char)74, (char)0, (char)184, (char)143, (char)128, (char)92, (char)71, (char)248, (char)135, (char)224};
-static char const QUOTE_69[] PROGMEM = {(char)74, (char)192, (char)112, (char)128, (char)44, (char)1, (char)36, (char)146, (char)129, (char)101, (char)44, (char)129, (char)53, (char)164, (char)174, (char)1, (char)19, (char)64, (char)40, (char)33, (char)151, (char)192};
-static char const QUOTE_70[] PROGMEM = {(char)88, (char)92, (char)5, (char)20, (char)14, (char)121, (char)192, (char)228, (char)150, (char)128, (char)24, (char)101, (char)98, (char)187, (char)199, (char)224, (char)32, (char)104, (char)4, (char)204, (char)5, (char)26, (char)40, (char)11, (char)135, (char)32, (char)56, (char)108, (char)89, (char)124};
-static char const QUOTE_71[] PROGMEM = {(char)41, (char)92, (char)4, (char)21, (char)141, (char)5, (char)18, (char)162, (char)21, (char)211, (char)1, (char)146, (char)90, (char)76, (char)174, (char)2, (char)92, (char)2, (char)20, (char)19, (char)160, (char)72, (char)4, (char)204, (char)2, (char)43, (char)2, (char)227, (char)201, (char)42, (char)89, (char)100, (char)2, (char)5, (char)192, (char)65, (char)88, (char)208, (char)81, (char)42, (char)33, (char)93, (char)48, (char)20, (char)174, (char)5, (char)202, (char)85, (char)168, (char)160, (char)154, (char)210, (char)87, (char)0, (char)149, (char)145, (char)128, (char)149, (char)130, (char)133, (char)0, (char)139, (char)114, (char)200, (char)174, (char)248};
-static char const QUOTE_72[] PROGMEM = {(char)81, (char)64, (char)183, (char)182, (char)128, (char)125, (char)139, (char)32, (char)176, (char)23, (char)43, (char)0, (char)19, (char)120, (char)184, (char)9, (char)88, (char)22, (char)247, (char)1, (char)239, (char)88, (char)44, (char)23, (char)0, (char)133, (char)6, (char)174, (char)25, (char)80, (char)160, (char)124, (char)1, (char)227, (char)16, (char)77, (char)105, (char)0, (char)76, (char)183, (char)180, (char)174, (char)248};
-static char const QUOTE_73[] PROGMEM = {(char)107, (char)203, (char)64, (char)40, (char)160, (char)123, (char)214, (char)6, (char)132, (char)50, (char)1, (char)44, (char)249, (char)5, (char)96, (char)57, (char)69, (char)42, (char)165, (char)101, (char)119, (char)192};
-static char const QUOTE_74[] PROGMEM = {(char)40, (char)90, (char)247, (char)1, (char)51, (char)0, (char)110, (char)89, (char)189, (char)165, (char)7, (char)142, (char)182, (char)79, (char)128};
-static char const QUOTE_75[] PROGMEM = {(char)76, (char)167, (char)52, (char)131, (char)197, (char)96, (char)195, (char)91, (char)48, (char)120, (char)172, (char)5, (char)104, (char)82, (char)193, (char)177, (char)37, (char)117, (char)60, (char)92, (char)0, (char)141, (char)20, (char)44, (char)143, (char)39, (char)184, (char)150, (char)43, (char)167, (char)66, (char)202, (char)96, (char)210, (char)84, (char)224, (char)28, (char)183, (char)123, (char)220, (char)4, (char)202, (char)73, (char)160, (char)93, (char)79, (char)22, (char)0, (char)129, (char)160, (char)24, (char)84, (char)146, (char)128, (char)9, (char)128, (char)87, (char)0, (char)129, (char)112, (char)4, (char)87, (char)1, (char)69, (char)1, (char)203, (char)119, (char)189, (char)192, (char)114, (char)75, (char)64, (char)66, (char)79, (char)37, (char)71, (char)68, (char)148, (char)223};
-static char const QUOTE_76[] PROGMEM = {(char)33, (char)64, (char)210, (char)150, (char)116, (char)40, (char)41, (char)32, (char)165, (char)201, (char)113, (char)192, (char)153, (char)130, (char)229, (char)96, (char)30, (char)83, (char)21, (char)201, (char)113, (char)254};
-static char const QUOTE_77[] PROGMEM = {(char)65, (char)104, (char)4, (char)204, (char)13, (char)8, (char)100, (char)2, (char)149, (char)192, (char)67, (char)203, (char)58, (char)40, (char)190, (char)46, (char)1, (char)3, (char)64, (char)32, (char)162, (char)2, (char)86, (char)11, (char)149, (char)128, (char)176, (char)86, (char)89, (char)124};
-static char const QUOTE_78[] PROGMEM = {(char)179, (char)228, (char)147, (char)148, (char)11, (char)41, (char)100, (char)11, (char)134, (char)96, (char)65, (char)104, (char)2, (char)149, (char)192, (char)99, (char)220, (char)119, (char)186, (char)147, (char)161, (char)86, (char)151, (char)28, (char)5, (char)112, (char)8, (char)16, (char)200, (char)7, (char)75, (char)142, (char)4, (char)172, (char)15, (char)122, (char)192, (char)228, (char)150, (char)128, (char)35, (char)222, (char)64, (char)4, (char)46, (char)241, (char)112, (char)46, (char)86, (char)0, (char)165, (char)112, (char)46, (char)82, (char)172, (char)15, (char)48, (char)44, (char)149, (char)24, (char)13, (char)41, (char)65, (char)39, (char)184, (char)135, (char)43, (char)31, (char)2, (char)187, (char)224};
-static char const QUOTE_79[] PROGMEM = {(char)105, (char)104, (char)11, (char)134, (char)128, (char)156, (char)31, (char)42, (char)21, (char)192, (char)56, (char)67, (char)64, (char)32, (char)180, (char)5, (char)202, (char)192, (char)92, (char)165, (char)144, (char)31, (char)98, (char)203, (char)224};
-static char const QUOTE_80[] PROGMEM = {(char)74, (char)192, (char)178, (char)149, (char)96, (char)113, (char)104, (char)7, (char)4, (char)50, (char)3, (char)82, (char)167, (char)2, (char)69, (char)26, (char)40, (char)89, (char)89, (char)229, (char)167, (char)139, (char)0, (char)68, (char)148, (char)9, (char)152, (char)10, (char)147, (char)149, (char)204, (char)74, (char)150, (char)1, (char)22, (char)116, (char)1, (char)203, (char)32, (char)144, (char)82, (char)8, (char)87, (char)79, (char)16, (char)129, (char)174, (char)2, (char)216, (char)84, (char)184, (char)160, (char)161, (char)74, (char)224, (char)38, (char)96, (char)106, (char)93, (char)58, (char)21, (char)211, (char)1, (char)42, (char)33, (char)21, (char)128, (char)211, (char)192, (char)68, (char)172, (char)15, (char)242, (char)255, (char)140, (char)60, (char)118, (char)4, (char)172, (char)26, (char)13, (char)1, (char)66, (char)128, (char)133, (char)114, (char)202, (char)224, (char)16, (char)52, (char)2, (char)86, (char)2, (char)200, (char)13, (char)156, (char)192, (char)208, (char)134, (char)64, (char)41, (char)93, (char)48, (char)52, (char)165, (char)3, (char)2, (char)227, (char)204, (char)4, (char)40, (char)8, (char)245, (char)208, (char)178, (char)248};
-static char const QUOTE_81[] PROGMEM = {(char)106, (char)75, (char)69, (char)23, (char)197, (char)128, (char)113, (char)74, (char)208, (char)16, (char)160, (char)50, (char)75, (char)73, (char)252};
-static char const QUOTE_82[] PROGMEM = {(char)65, (char)68, (char)34, (char)184, (char)10, (char)171, (char)24, (char)146, (char)128, (char)44, (char)1, (char)195, (char)66, (char)184, (char)9, (char)112, (char)20, (char)80, (char)80, (char)46, (char)33, (char)92, (char)39, (char)202, (char)116, (char)43, (char)0, (char)114, (char)137, (char)239, (char)145, (char)60, (char)127, (char)240};
-static char const QUOTE_83[] PROGMEM = {(char)122, (char)0, (char)208, (char)187, (char)197, (char)128, (char)85, (char)100, (char)4, (char)204, (char)5, (char)43, (char)128, (char)32, (char)206, (char)129, (char)12, (char)137, (char)240};
-static char const QUOTE_84[] PROGMEM = {(char)74, (char)192, (char)112, (char)129, (char)201, (char)45, (char)0, (char)224, (char)134, (char)64, (char)85, (char)101, (char)226, (char)192, (char)37, (char)96, (char)107, (char)203, (char)64, (char)45, (char)137, (char)107, (char)74, (char)239, (char)128};
-static char const QUOTE_85[] PROGMEM = {(char)216, (char)106, (char)0, (char)212, (char)1, (char)168, (char)3, (char)80, (char)112, (char)143, (char)40, (char)8, (char)26, (char)1, (char)207, (char)168, (char)28, (char)146, (char)211, (char)196, (char)63};
-static char const QUOTE_86[] PROGMEM = {(char)64, (char)89, (char)96, (char)201, (char)46, (char)47, (char)139, (char)0, (char)64, (char)208, (char)9, (char)152, (char)28, (char)90, (char)0, (char)44, (char)152, (char)4, (char)146, (char)200, (char)26, (char)123, (char)136, (char)89, (char)0, (char)44, (char)27, (char)208, (char)246, (char)48, (char)180, (char)81, (char)126};
-static char const QUOTE_87[] PROGMEM = {(char)44, (char)136, (char)151, (char)28, (char)178, (char)241, (char)248, (char)30, (char)84, (char)120, (char)176, (char)13, (char)9, (char)192, (char)149, (char)129, (char)160, (char)179, (char)223, (char)32, (char)40, (char)160, (char)75, (char)166, (char)52, (char)21, (char)203, (char)43, (char)188, (char)127, (char)240};
-static char const QUOTE_88[] PROGMEM = {(char)44, (char)136, (char)151, (char)28, (char)178, (char)2, (char)102, (char)2, (char)149, (char)192, (char)11, (char)25, (char)226, (char)218, (char)37, (char)165, (char)1, (char)131, (char)103, (char)201, (char)52, (char)40, (char)16, (char)146, (char)203, (char)224};
-static char const QUOTE_89[] PROGMEM = {(char)44, (char)136, (char)151, (char)28, (char)178, (char)2, (char)10, (char)89, (char)78, (char)128, (char)241, (char)214, (char)201, (char)240};
-static char const QUOTE_90[] PROGMEM = {(char)74, (char)192, (char)128, (char)144, (char)20, (char)185, (char)74, (char)2, (char)200, (char)137, (char)113, (char)203, (char)32, (char)92, (char)169, (char)156, (char)196, (char)146, (char)200, (char)1, (char)96, (char)222, (char)135, (char)176, (char)210, (char)42, (char)64, (char)210, (char)148, (char)23, (char)75, (char)24, (char)87, (char)1, (char)197, (char)105, (char)93, (char)240};
-static char const QUOTE_91[] PROGMEM = {(char)105, (char)93, (char)50, (char)184, (char)26, (char)74, (char)156, (char)0, (char)178, (char)137, (char)81, (char)1, (char)98, (char)208, (char)15, (char)113, (char)11, (char)32, (char)16, (char)160, (char)75, (char)137, (char)42, (char)172, (char)1, (char)100, (char)192, (char)149, (char)128, (char)165, (char)112, (char)11, (char)34, (char)37, (char)199, (char)44, (char)128, (char)151, (char)76, (char)104, (char)43, (char)151, (char)240};
-static char const QUOTE_92[] PROGMEM = {(char)44, (char)136, (char)151, (char)28, (char)178, (char)0, (char)88, (char)55, (char)161, (char)236, (char)52, (char)138, (char)159, (char)23, (char)0, (char)133, (char)2, (char)72, (char)80, (char)176, (char)160, (char)156, (char)31, (char)42, (char)18, (char)65, (char)114, (char)254};
-static char const QUOTE_93[] PROGMEM = {(char)32, (char)104, (char)3, (char)132, (char)9, (char)88, (char)44, (char)25, (char)208, (char)22, (char)44, (char)142, (char)90, (char)21, (char)222, (char)46, (char)2, (char)11, (char)36, (char)185, (char)197, (char)144, (char)26, (char)80, (char)22, (char)64, (char)115, (char)206, (char)2, (char)216, (char)174, (char)0, (char)66, (char)224, (char)89, (char)33, (char)3, (char)66, (char)150, (char)124};
-static char const QUOTE_94[] PROGMEM = {(char)185, (char)64, (char)112, (char)133, (char)192, (char)163, (char)198, (char)128, (char)28, (char)186, (char)43, (char)24, (char)147, (char)129, (char)193, (char)12, (char)128, (char)66, (char)128, (char)205, (char)55, (char)139, (char)68, (char)249, (char)72, (char)172, (char)1, (char)92, (char)2, (char)5, (char)192, (char)112, (char)67, (char)32, (char)109, (char)28, (char)12, (char)228, (char)90, (char)120, (char)255, (char)224};
-static char const QUOTE_95[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)23, (char)43, (char)1, (char)164, (char)184, (char)9, (char)112, (char)54, (char)94, (char)72, (char)137, (char)113, (char)203, (char)32, (char)120, (char)235, (char)100, (char)248};
-static char const QUOTE_96[] PROGMEM = {(char)18, (char)75, (char)47, (char)23, (char)120, (char)184, (char)9, (char)88, (char)16, (char)81, (char)1, (char)137, (char)45, (char)139, (char)32, (char)24, (char)192, (char)147, (char)200, (char)80, (char)93, (char)42, (char)112, (char)30, (char)109, (char)63, (char)224};
-static char const QUOTE_97[] PROGMEM = {(char)18, (char)75, (char)32, (char)21, (char)192, (char)32, (char)67, (char)39, (char)4, (char)14, (char)8, (char)100, (char)2, (char)20, (char)8, (char)12, (char)228, (char)90, (char)120, (char)255, (char)224};
-static char const QUOTE_98[] PROGMEM = {(char)18, (char)75, (char)47, (char)31, (char)129, (char)43, (char)3, (char)43, (char)58, (char)1, (char)239, (char)88, (char)46, (char)86, (char)2, (char)225, (char)167, (char)139, (char)0, (char)248, (char)3, (char)73, (char)26, (char)62};
-static char const QUOTE_99[] PROGMEM = {(char)44, (char)136, (char)151, (char)28, (char)178, (char)5, (char)211, (char)65, (char)36, (char)178, (char)1, (char)169, (char)127, (char)16, (char)252};
-static char const QUOTE_100[] PROGMEM = {(char)74, (char)192, (char)73, (char)37, (char)203, (char)3, (char)205, (char)114, (char)176, (char)14, (char)73, (char)104, (char)7, (char)154, (char)229, (char)96, (char)26, (char)90, (char)20, (char)174, (char)5, (char)138, (char)86, (char)2, (char)133, (char)5, (char)138, (char)86, (char)124};
-static char const QUOTE_101[] PROGMEM = {(char)81, (char)64, (char)215, (char)150, (char)128, (char)19, (char)18, (char)160, (char)105, (char)42, (char)119, (char)139, (char)0, (char)208, (char)134, (char)64, (char)32, (char)104, (char)1, (char)21, (char)192, (char)74, (char)192, (char)247, (char)175, (char)224};
-static char const QUOTE_102[] PROGMEM = {(char)8, (char)209, (char)226, (char)192, (char)92, (char)51, (char)1, (char)36, (char)247, (char)158, (char)128, (char)123, (char)214, (char)8, (char)73, (char)45, (char)8, (char)18, (char)224, (char)16, (char)160, (char)184, (char)102, (char)208, (char)141, (char)9, (char)113, (char)64, (char)135, (char)190, (char)95};
-static char const QUOTE_103[] PROGMEM = {(char)8, (char)209, (char)226, (char)192, (char)92, (char)51, (char)1, (char)36, (char)247, (char)158, (char)128, (char)123, (char)214, (char)8, (char)73, (char)45, (char)8, (char)18, (char)224, (char)16, (char)160, (char)104, (char)92, (char)64, (char)33, (char)239, (char)151, (char)192};
-static char const QUOTE_104[] PROGMEM = {(char)91, (char)218, (char)6, (char)148, (char)15, (char)177, (char)100, (char)2, (char)149, (char)192, (char)173, (char)100, (char)6, (char)132, (char)50, (char)2, (char)2, (char)194, (char)187, (char)197, (char)192, (char)74, (char)192, (char)112, (char)129, (char)207, (char)56, (char)46, (char)25, (char)129, (char)240, (char)64, (char)92, (char)114, (char)187, (char)224};
-static char const QUOTE_105[] PROGMEM = {(char)242, (char)216, (char)171, (char)40, (char)121, (char)116, (char)11, (char)8, (char)66, (char)16, (char)145, (char)239, (char)123, (char)232, (char)162, (char)150, (char)115, (char)159, (char)192};
-static char const QUOTE_106[] PROGMEM = {(char)242, (char)216, (char)171, (char)40, (char)121, (char)116, (char)12, (char)42, (char)214, (char)89, (char)20, (char)11, (char)8, (char)66, (char)16, (char)145, (char)239, (char)123, (char)232, (char)162, (char)150, (char)115, (char)159, (char)192};
-static char const QUOTE_107[] PROGMEM = {(char)111, (char)137, (char)220, (char)1, (char)73, (char)229, (char)144, (char)8, (char)146, (char)128, (char)143, (char)45, (char)1, (char)58, (char)60, (char)178, (char)2, (char)92, (char)2, (char)20, (char)19, (char)172, (char)11, (char)34, (char)20, (char)79, (char)44, (char)190};
-static char const QUOTE_108[] PROGMEM = {(char)12, (char)142, (char)143, (char)23, (char)1, (char)43, (char)3, (char)94, (char)90, (char)1, (char)207, (char)56, (char)9, (char)36, (char)148, (char)23, (char)12, (char)230, (char)87, (char)0, (char)146, (char)8, (char)82, (char)87, (char)0, (char)174, (char)1, (char)18, (char)80, (char)82, (char)229, (char)40, (char)44, (char)249, (char)36, (char)229, (char)3, (char)225, (char)103, (char)214, (char)229, (char)119, (char)192};
-static char const QUOTE_109[] PROGMEM = {(char)210, (char)89, (char)98, (char)202, (char)201, (char)154, (char)139, (char)63, (char)31, (char)130, (char)233, (char)96, (char)20, (char)80, (char)32, (char)180, (char)1, (char)2, (char)25, (char)1, (char)201, (char)45, (char)0, (char)251, (char)22, (char)64, (char)65, (char)68, (char)34, (char)187, (char)199, (char)224, (char)32, (char)67, (char)32, (char)32, (char)162, (char)2, (char)86, (char)9, (char)150, (char)73, (char)45, (char)102, (char)6, (char)132, (char)46, (char)33, (char)92, (char)192, (char)184, (char)224, (char)113, (char)70, (char)138, (char)52, (char)178, (char)146, (char)75, (char)48, (char)62, (char)197, (char)144, (char)14, (char)84, (char)4, (char)159};
-static char const QUOTE_110[] PROGMEM = {(char)11, (char)146, (char)210, (char)129, (char)51, (char)6, (char)174, (char)16, (char)200, (char)19, (char)172, (char)11, (char)36, (char)150, (char)178, (char)0, (char)66, (char)224, (char)33, (char)236, (char)102, (char)110, (char)247, (char)147, (char)224};
-static char const QUOTE_111[] PROGMEM = {(char)11, (char)146, (char)210, (char)248, (char)252, (char)4, (char)8, (char)100, (char)4, (char)20, (char)166, (char)160, (char)2, (char)226, (char)60, (char)23, (char)43, (char)1, (char)98, (char)202, (char)116, (char)11, (char)136, (char)11, (char)5, (char)223};
-static char const QUOTE_112[] PROGMEM = {(char)91, (char)222, (char)177, (char)60, (char)171, (char)43, (char)128, (char)215, (char)150, (char)133, (char)112, (char)28, (char)146, (char)208, (char)26, (char)125, (char)138, (char)86, (char)1, (char)46, (char)60, (char)138, (char)68, (char)149, (char)212, (char)43, (char)128, (char)114, (char)138, (char)85, (char)74, (char)202, (char)239, (char)128};
-static char const QUOTE_113[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)26, (char)127, (char)137, (char)220, (char)3, (char)149, (char)201, (char)8, (char)88, (char)5, (char)189, (char)235, (char)19, (char)202, (char)191, (char)16, (char)128, (char)178, (char)4, (char)232, (char)16, (char)208, (char)9, (char)112, (char)16, (char)242, (char)129, (char)69, (char)0, (char)67, (char)34, (char)6, (char)16, (char)43, (char)38, (char)6, (char)188, (char)180, (char)2, (char)222, (char)178, (char)187, (char)224};
-static char const QUOTE_114[] PROGMEM = {(char)184, (char)67, (char)39, (char)180, (char)19, (char)160, (char)67, (char)64, (char)22, (char)64, (char)75, (char)128, (char)114, (char)149, (char)192, (char)43, (char)150, (char)86, (char)1, (char)111, (char)122, (char)196, (char)242, (char)172, (char)8, (char)121, (char)64, (char)162, (char)128, (char)165, (char)112, (char)10, (char)144, (char)45, (char)239, (char)93, (char)60, (char)127, (char)240};
-static char const QUOTE_115[] PROGMEM = {(char)80, (char)64, (char)231, (char)212, (char)13, (char)121, (char)104, (char)87, (char)2, (char)229, (char)6, (char)138, (char)178, (char)200, (char)1, (char)96, (char)30, (char)237, (char)20, (char)7, (char)42, (char)10, (char)150, (char)148, (char)20, (char)149, (char)106, (char)181, (char)22, (char)96, (char)124, (char)1, (char)64, (char)152, (char)172, (char)3, (char)10, (char)115, (char)149, (char)223};
-static char const QUOTE_116[] PROGMEM = {(char)18, (char)84, (char)5, (char)177, (char)45, (char)105, (char)92, (char)4, (char)204, (char)30, (char)51, (char)24, (char)30, (char)146, (char)2, (char)146, (char)77, (char)146, (char)16, (char)179, (char)224};
-static char const QUOTE_117[] PROGMEM = {(char)157, (char)86, (char)178, (char)179, (char)197, (char)128, (char)184, (char)104, (char)1, (char)23, (char)73, (char)43, (char)40, (char)5, (char)23, (char)199, (char)255};
-static char const QUOTE_118[] PROGMEM = {(char)81, (char)64, (char)130, (char)176, (char)160, (char)48, (char)90, (char)150, (char)36, (char)160, (char)76, (char)192, (char)82, (char)184, (char)19, (char)170, (char)214, (char)86, (char)120, (char)135, (char)224};
-static char const QUOTE_119[] PROGMEM = {(char)74, (char)193, (char)114, (char)150, (char)128, (char)115, (char)206, (char)4, (char)60, (char)160, (char)217, (char)124, (char)91, (char)201, (char)62, (char)137, (char)24, (char)10, (char)87, (char)0, (char)108, (char)76, (char)0, (char)128, (char)144, (char)13, (char)45, (char)1, (char)39, (char)184, (char)150, (char)98, (char)74, (char)114, (char)184, (char)133, (char)5, (char)18, (char)90, (char)21, (char)222, (char)46, (char)3, (char)31, (char)57, (char)148, (char)20, (char)73, (char)104, (char)87, (char)120, (char)132, (char)4, (char)13, (char)1, (char)103, (char)184, (char)128, (char)74, (char)192, (char)66, (char)206, (char)137, (char)81, (char)38, (char)3, (char)149, (char)201, (char)8, (char)89, (char)226, (char)224, (char)52, (char)33, (char)144, (char)20, (char)31, (char)22, (char)1, (char)43, (char)5, (char)195, (char)48, (char)16, (char)46, (char)3, (char)222, (char)176, (char)120, (char)199, (char)198, (char)95};
-static char const QUOTE_120[] PROGMEM = {(char)211, (char)234, (char)2, (char)20, (char)19, (char)26, (char)18, (char)214, (char)149, (char)128, (char)124, (char)1, (char)7, (char)150, (char)0, (char)152, (char)208, (char)18, (char)21, (char)137, (char)82, (char)193, (char)164, (char)169, (char)222, (char)63, (char)248};
-static char const QUOTE_121[] PROGMEM = {(char)152, (char)208, (char)150, (char)180, (char)172, (char)241, (char)248, (char)52, (char)150, (char)88, (char)178, (char)178, (char)102, (char)162, (char)204, (char)26, (char)74, (char)156, (char)2, (char)149, (char)192, (char)60, (char)159, (char)66, (char)200, (char)16, (char)147, (char)196, (char)194, (char)149, (char)190, (char)46, (char)241, (char)119, (char)139, (char)190};
-static char const QUOTE_122[] PROGMEM = {(char)152, (char)208, (char)150, (char)180, (char)172, (char)241, (char)248, (char)44, (char)246, (char)28, (char)174, (char)152, (char)10, (char)22, (char)189, (char)192, (char)88, (char)92, (char)15, (char)19, (char)208, (char)7, (char)41, (char)92, (char)5, (char)220, (char)33, (char)32, (char)2, (char)226, (char)22, (char)83, (char)248};
-static char const QUOTE_123[] PROGMEM = {(char)64, (char)72, (char)7, (char)84, (char)23, (char)77, (char)40, (char)147, (char)148, (char)5, (char)112, (char)14, (char)86, (char)36, (char)229, (char)4, (char)198, (char)132, (char)181, (char)165, (char)96, (char)31, (char)0, (char)53, (char)42, (char)112, (char)5, (char)39, (char)188, (char)159};
-static char const QUOTE_124[] PROGMEM = {(char)18, (char)84, (char)7, (char)4, (char)133, (char)144, (char)18, (char)237, (char)36, (char)174, (char)2, (char)102, (char)2, (char)20, (char)2, (char)147, (char)198, (char)55, (char)177, (char)32, (char)123, (char)214, (char)11, (char)22, (char)83, (char)26, (char)18, (char)214, (char)149, (char)132, (char)248};
-static char const QUOTE_125[] PROGMEM = {(char)152, (char)208, (char)150, (char)180, (char)172, (char)2, (char)234, (char)224, (char)40, (char)160, (char)114, (char)75, (char)64, (char)92, (char)167, (char)163, (char)231, (char)68, (char)149, (char)192, (char)164, (char)159, (char)91, (char)149, (char)211, (char)248};
-static char const QUOTE_126[] PROGMEM = {(char)33, (char)65, (char)49, (char)161, (char)45, (char)105, (char)88, (char)4, (char)184, (char)4, (char)40, (char)46, (char)245, (char)130, (char)225, (char)26, (char)40, (char)11, (char)149, (char)159};
-static char const QUOTE_127[] PROGMEM = {(char)74, (char)79, (char)226, (char)192, (char)5, (char)147, (char)2, (char)86, (char)6, (char)165, (char)78, (char)0, (char)152, (char)87, (char)16, (char)178, (char)3, (char)224, (char)10, (char)37, (char)68, (char)5, (char)130, (char)224, (char)76, (char)104, (char)75, (char)90, (char)86, (char)1, (char)5, (char)16, (char)30, (char)234, (char)16, (char)33, (char)119, (char)192};
-static char const QUOTE_128[] PROGMEM = {(char)64, (char)80, (char)16, (char)33, (char)40, (char)72, (char)8, (char)146, (char)130, (char)99, (char)66, (char)90, (char)210, (char)176, (char)15, (char)122, (char)252, (char)92, (char)4, (char)184, (char)13, (char)74, (char)156, (char)4, (char)61, (char)230, (char)32, (char)19, (char)48, (char)80, (char)9, (char)115, (char)82, (char)66, (char)21, (char)147, (char)5, (char)202, (char)89, (char)0, (char)165, (char)112, (char)26, (char)151, (char)16, (char)178, (char)1, (char)228, (char)247, (char)208, (char)16, (char)147, (char)196, (char)194, (char)149, (char)160, (char)32, (char)92, (char)13, (char)37, (char)150, (char)44, (char)172, (char)153, (char)168, (char)179, (char)248};
-static char const QUOTE_129[] PROGMEM = {(char)162, (char)96, (char)11, (char)5, (char)192, (char)104, (char)100, (char)191, (char)23, (char)0, (char)239, (char)122, (char)65, (char)0, (char)193, (char)37, (char)144, (char)18, (char)224, (char)16, (char)160, (char)132, (char)170, (char)198, (char)21, (char)194, (char)10, (char)254};
-static char const QUOTE_130[] PROGMEM = {(char)218, (char)146, (char)160, (char)81, (char)15, (char)104, (char)103, (char)240};
-static char const QUOTE_131[] PROGMEM = {(char)210, (char)105, (char)66, (char)187, (char)197, (char)128, (char)157, (char)2, (char)23, (char)120, (char)176, (char)12, (char)73, (char)206, (char)87, (char)120, (char)176, (char)26, (char)77, (char)40, (char)95, (char)22, (char)2, (char)116, (char)8, (char)93, (char)226, (char)192, (char)49, (char)39, (char)57, (char)93, (char)226, (char)192, (char)22, (char)131, (char)241, (char)119, (char)139, (char)190};
-static char const QUOTE_132[] PROGMEM = {(char)157, (char)36, (char)149, (char)44, (char)174, (char)241, (char)248, (char)46, (char)82, (char)208, (char)10, (char)40, (char)52, (char)85, (char)150, (char)64, (char)32, (char)104, (char)10, (char)1, (char)201, (char)45, (char)0, (char)151, (char)0, (char)82, (char)11, (char)136, (char)11, (char)49, (char)37, (char)61, (char)60, (char)126, (char)0, (char)178, (char)96, (char)33, (char)65, (char)58, (char)61, (char)237, (char)163, (char)203, (char)103, (char)150, (char)64, (char)65, (char)104, (char)7, (char)36, (char)180, (char)1, (char)30, (char)90, (char)120, (char)255, (char)224};
-static char const QUOTE_133[] PROGMEM = {(char)80, (char)84, (char)21, (char)4, (char)9, (char)88, (char)14, (char)16, (char)53, (char)192, (char)50, (char)75, (char)73, (char)128, (char)163, (char)69, (char)0, (char)100, (char)224, (char)174, (char)248};
-static char const QUOTE_134[] PROGMEM = {(char)33, (char)64, (char)176, (char)180, (char)172, (char)43, (char)169, (char)34, (char)165, (char)222, (char)33, (char)7, (char)142, (char)182, (char)79, (char)128};
-static char const QUOTE_135[] PROGMEM = {(char)33, (char)64, (char)66, (char)214, (char)147, (char)26, (char)10, (char)1, (char)5, (char)14, (char)2, (char)10, (char)83, (char)80, (char)8, (char)45, (char)0, (char)81, (char)162, (char)128, (char)177, (char)74, (char)192, (char)8, (char)180, (char)44, (char)128, (char)114, (char)200, (char)167, (char)43, (char)9, (char)240};
-static char const QUOTE_136[] PROGMEM = {(char)221, (char)194, (char)25, (char)61, (char)160, (char)226, (char)10, (char)32, (char)37, (char)96, (char)43, (char)22, (char)80, (char)44, (char)165, (char)144, (char)44, (char)89, (char)82, (char)65, (char)58, (char)92, (char)112, (char)5, (char)147, (char)2, (char)86, (char)6, (char)150, (char)128, (char)33, (char)65, (char)73, (char)21, (char)46, (char)1, (char)195, (char)227, (char)255, (char)128};
-static char const QUOTE_137[] PROGMEM = {(char)11, (char)136, (char)89, (char)76, (char)7, (char)8, (char)20, (char)80, (char)28, (char)183, (char)123, (char)220, (char)6, (char)36, (char)212, (char)43, (char)188, (char)92, (char)6, (char)36, (char)212, (char)43, (char)128, (char)153, (char)128, (char)55, (char)44, (char)222, (char)210, (char)252};
-static char const QUOTE_138[] PROGMEM = {(char)105, (char)104, (char)2, (char)20, (char)20, (char)145, (char)82, (char)239, (char)31, (char)128, (char)165, (char)112, (char)10, (char)52, (char)80, (char)160, (char)177, (char)93, (char)64, (char)25, (char)37, (char)164, (char)232, (char)2, (char)6, (char)128, (char)57, (char)110, (char)247, (char)187, (char)224};
-static char const QUOTE_139[] PROGMEM = {(char)122, (char)0, (char)208, (char)184, (char)4, (char)73, (char)64, (char)114, (char)206, (char)143, (char)124, (char)136, (char)80, (char)53, (char)244, (char)124, (char)164, (char)149, (char)16, (char)178, (char)152, (char)18, (char)224, (char)18, (char)169, (char)164, (char)216, (char)23, (char)16, (char)20, (char)121, (char)92, (char)7, (char)189, (char)127};
-static char const QUOTE_140[] PROGMEM = {(char)74, (char)193, (char)100, (char)184, (char)128, (char)8, (char)93, (char)64, (char)176, (char)18, (char)41, (char)202, (char)201, (char)128, (char)165, (char)112, (char)46, (char)16, (char)200, (char)133, (char)99, (char)244, (char)80, (char)52, (char)33, (char)167, (char)192};
-static char const QUOTE_141[] PROGMEM = {(char)74, (char)193, (char)49, (char)162, (char)73, (char)81, (char)129, (char)167, (char)184, (char)133, (char)144, (char)22, (char)246, (char)180, (char)62, (char)39, (char)152, (char)46, (char)23, (char)80, (char)9, (char)88, (char)4, (char)87, (char)0, (char)165, (char)112, (char)14, (char)23, (char)30, (char)116, (char)44, (char)190};
-static char const QUOTE_142[] PROGMEM = {(char)64, (char)80, (char)16, (char)16, (char)52, (char)6, (char)159, (char)80, (char)37, (char)96, (char)115, (char)222, (char)154, (char)0, (char)143, (char)43, (char)190};
-static char const QUOTE_143[] PROGMEM = {(char)74, (char)192, (char)180, (char)169, (char)96, (char)45, (char)138, (char)224, (char)81, (char)42, (char)33, (char)93, (char)48, (char)32, (char)180, (char)0, (char)77, (char)112, (char)206, (char)101, (char)112, (char)31, (char)0, (char)55, (char)196, (char)238, (char)4, (char)198, (char)130, (char)201, (char)160, (char)43, (char)128, (char)130, (char)136, (char)69, (char)112, (char)21, (char)86, (char)49, (char)37, (char)2, (char)11, (char)64, (char)16, (char)33, (char)147, (char)236, (char)89, (char)120, (char)252, (char)8, (char)45, (char)0, (char)153, (char)128, (char)133, (char)4, (char)210, (char)181, (char)129, (char)201, (char)45, (char)62};
-static char const QUOTE_144[] PROGMEM = {(char)185, (char)100, (char)191, (char)31, (char)129, (char)65, (char)80, (char)64, (char)224, (char)128, (char)133, (char)0, (char)77, (char)112, (char)207, (char)197, (char)192, (char)43, (char)128, (char)149, (char)129, (char)175, (char)45, (char)0, (char)231, (char)156, (char)4, (char)40, (char)46, (char)25, (char)129, (char)240, (char)64, (char)92, (char)114, (char)187, (char)224};
-static char const QUOTE_145[] PROGMEM = {(char)185, (char)100, (char)191, (char)31, (char)130, (char)207, (char)97, (char)202, (char)226, (char)20, (char)23, (char)41, (char)86, (char)6, (char)166, (char)115, (char)26, (char)18, (char)87, (char)120, (char)184, (char)9, (char)88, (char)26, (char)242, (char)208, (char)14, (char)121, (char)192, (char)19, (char)92, (char)51, (char)153, (char)93, (char)240};
-static char const QUOTE_146[] PROGMEM = {(char)184, (char)104, (char)2, (char)149, (char)192, (char)185, (char)100, (char)176, (char)38, (char)96, (char)88, (char)90, (char)89, (char)1, (char)240, (char)149, (char)82, (char)210, (char)184, (char)20, (char)120, (char)209, (char)240};
-static char const QUOTE_147[] PROGMEM = {(char)74, (char)192, (char)34, (char)184, (char)2, (char)44, (char)232, (char)0, (char)133, (char)192, (char)65, (char)104, (char)11, (char)150, (char)75, (char)241, (char)96, (char)38, (char)81, (char)214, (char)73, (char)166, (char)64, (char)36, (char)169, (char)133, (char)209, (char)92, (char)4, (char)204, (char)23, (char)44, (char)150, (char)11, (char)180, (char)94, (char)46, (char)3, (char)146, (char)86, (char)133, (char)196, (char)0, (char)92, (char)66, (char)202, (char)96, (char)66, (char)75, (char)32, (char)17, (char)37, (char)5, (char)0, (char)71, (char)150, (char)159};
-static char const QUOTE_148[] PROGMEM = {(char)74, (char)192, (char)215, (char)150, (char)128, (char)115, (char)206, (char)15, (char)28, (char)120, (char)192, (char)21, (char)145, (char)92, (char)6, (char)133, (char)101, (char)112, (char)44, (char)247, (char)200, (char)22, (char)123, (char)14, (char)87, (char)16, (char)160, (char)185, (char)74, (char)176, (char)120, (char)183, (char)203, (char)254, (char)45, (char)248};
-static char const QUOTE_149[] PROGMEM = {(char)33, (char)65, (char)2, (char)185, (char)51, (char)5, (char)130, (char)224, (char)9, (char)228, (char)45, (char)203, (char)63, (char)31, (char)131, (char)197, (char)190, (char)95, (char)241, (char)111, (char)192};
-static char const QUOTE_150[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)5, (char)43, (char)129, (char)2, (char)185, (char)51, (char)1, (char)92, (char)2, (char)36, (char)160, (char)98, (char)84, (char)186, (char)1, (char)240, (char)2, (char)10, (char)231, (char)100, (char)8, (char)170, (char)102, (char)208, (char)187, (char)224};
-static char const QUOTE_151[] PROGMEM = {(char)69, (char)41, (char)15, (char)29, (char)120, (char)191, (char)197, (char)247, (char)189, (char)252, (char)93, (char)151, (char)214, (char)149, (char)17, (char)124, (char)92, (char)55, (char)183, (char)197, (char)247, (char)13, (char)6, (char)143, (char)31, (char)219, (char)199, (char)187, (char)175, (char)140, (char)188, (char)107, (char)103, (char)83, (char)198, (char)3, (char)71, (char)17, (char)182, (char)252};
-static char const QUOTE_152[] PROGMEM = {(char)129, (char)92, (char)153, (char)248, (char)252, (char)4, (char)8, (char)100, (char)13, (char)62, (char)164, (char)43, (char)129, (char)114, (char)129, (char)5, (char)160, (char)28, (char)146, (char)208, (char)13, (char)41, (char)100, (char)7, (char)216, (char)178, (char)2, (char)10, (char)33, (char)21, (char)223};
-static char const QUOTE_153[] PROGMEM = {(char)106, (char)84, (char)224, (char)57, (char)37, (char)173, (char)202, (char)8, (char)21, (char)201, (char)152, (char)46, (char)17, (char)162, (char)128, (char)124, (char)0, (char)212, (char)171, (char)224};
-static char const QUOTE_154[] PROGMEM = {(char)64, (char)80, (char)20, (char)7, (char)196, (char)32, (char)74, (char)193, (char)170, (char)166, (char)0, (char)85, (char)88, (char)196, (char)148, (char)5, (char)144, (char)30, (char)245, (char)128, (char)44, (char)97, (char)90, (char)16, (char)176, (char)21, (char)77, (char)1, (char)227, (char)173, (char)195, (char)224};
-static char const QUOTE_155[] PROGMEM = {(char)74, (char)192, (char)73, (char)61, (char)203, (char)43, (char)188, (char)126, (char)4, (char)172, (char)8, (char)9, (char)0, (char)34, (char)206, (char)128, (char)115, (char)206, (char)11, (char)149, (char)128, (char)184, (char)104, (char)11, (char)148, (char)224, (char)93, (char)92, (char)226, (char)184, (char)26, (char)45, (char)40, (char)87, (char)2, (char)207, (char)97, (char)202, (char)233, (char)129, (char)169, (char)87, (char)192};
-static char const QUOTE_156[] PROGMEM = {(char)36, (char)158, (char)229, (char)149, (char)222, (char)63, (char)2, (char)86, (char)11, (char)60, (char)172, (char)33, (char)64, (char)210, (char)129, (char)207, (char)56, (char)4, (char)89, (char)208, (char)16, (char)146, (char)90, (char)31, (char)128};
-static char const QUOTE_157[] PROGMEM = {(char)122, (char)60, (char)88, (char)6, (char)166, (char)115, (char)26, (char)18, (char)87, (char)1, (char)175, (char)45, (char)0, (char)149, (char)129, (char)239, (char)88, (char)8, (char)80, (char)92, (char)51, (char)1, (char)74, (char)233, (char)129, (char)240, (char)64, (char)92, (char)114, (char)187, (char)224};
-static char const QUOTE_158[] PROGMEM = {(char)65, (char)104, (char)4, (char)204, (char)15, (char)122, (char)192, (char)81, (char)162, (char)128, (char)185, (char)75, (char)32, (char)20, (char)174, (char)6, (char)158, (char)244, (char)209, (char)69, (char)5, (char)158, (char)249, (char)0, (char)133, (char)1, (char)152, (char)26, (char)120, (char)176, (char)13, (char)11, (char)128, (char)244, (char)1, (char)161, (char)119, (char)192};
-static char const QUOTE_159[] PROGMEM = {(char)66, (char)92, (char)244, (char)130, (char)133, (char)11, (char)124, (char)66, (char)6, (char)134, (char)76, (char)73, (char)103, (char)227, (char)160, (char)10, (char)65, (char)113, (char)0, (char)164, (char)168, (char)30, (char)39, (char)111, (char)143, (char)254};
-static char const QUOTE_160[] PROGMEM = {(char)42, (char)214, (char)144, (char)21, (char)107, (char)72, (char)10, (char)181, (char)164, (char)16, (char)160, (char)92, (char)112, (char)105, (char)239, (char)123, (char)252, (char)93, (char)226, (char)239, (char)23, (char)0, (char)79, (char)75, (char)143, (char)226, (char)31, (char)128};
-static char const QUOTE_161[] PROGMEM = {(char)131, (char)228, (char)231, (char)130, (char)225, (char)12, (char)146, (char)224, (char)23, (char)16, (char)98, (char)70, (char)146, (char)208, (char)7, (char)43, (char)139, (char)85, (char)208, (char)23, (char)124, (char)137, (char)79, (char)128};
-static char const QUOTE_162[] PROGMEM = {(char)122, (char)0, (char)160, (char)248, (char)176, (char)2, (char)123, (char)201, (char)49, (char)160, (char)48, (char)129, (char)92, (char)15, (char)22, (char)248, (char)187, (char)197, (char)190, (char)59, (char)248};
-static char const QUOTE_163[] PROGMEM = {(char)177, (char)101, (char)54, (char)6, (char)5, (char)119, (char)143, (char)192, (char)167, (char)165, (char)192, (char)162, (char)10, (char)1, (char)178, (char)162, (char)7, (char)159, (char)188, (char)191, (char)231, (char)239, (char)128};
-static char const QUOTE_164[] PROGMEM = {(char)65, (char)104, (char)4, (char)204, (char)15, (char)242, (char)254, (char)223, (char)227, (char)176, (char)113, (char)69, (char)1, (char)30, (char)90, (char)0, (char)133, (char)3, (char)252, (char)79, (char)48, (char)88, (char)178, (char)89, (char)75, (char)34, (char)1, (char)237, (char)248};
-static char const QUOTE_165[] PROGMEM = {(char)154, (char)243, (char)2, (char)129, (char)51, (char)6, (char)158, (char)4, (char)5, (char)196, (char)73, (char)192, (char)246, (char)129, (char)169, (char)83, (char)129, (char)66, (char)176, (char)166, (char)123, (char)220, (char)6, (char)148, (char)160, (char)161, (char)64, (char)130, (char)202, (char)201, (char)113, (char)10, (char)239, (char)128};
-static char const QUOTE_166[] PROGMEM = {(char)74, (char)193, (char)55, (char)6, (char)0, (char)114, (char)87, (char)48, (char)88, (char)46, (char)1, (char)3, (char)64, (char)52, (char)44, (char)97, (char)65, (char)53, (char)230, (char)5, (char)248};
-static char const QUOTE_167[] PROGMEM = {(char)106, (char)103, (char)49, (char)161, (char)37, (char)112, (char)22, (char)23, (char)2, (char)107, (char)204, (char)10, (char)7, (char)36, (char)180, (char)5, (char)10, (char)114, (char)184, (char)23, (char)75, (char)168, (char)89, (char)77, (char)129, (char)12, (char)20, (char)89, (char)252};
-static char const QUOTE_168[] PROGMEM = {(char)122, (char)60, (char)88, (char)6, (char)166, (char)115, (char)26, (char)18, (char)87, (char)1, (char)175, (char)45, (char)0, (char)149, (char)129, (char)239, (char)88, (char)8, (char)80, (char)92, (char)51, (char)1, (char)74, (char)233, (char)129, (char)240, (char)64, (char)92, (char)114, (char)187, (char)224};
-static char const QUOTE_169[] PROGMEM = {(char)93, (char)105, (char)226, (char)192, (char)53, (char)229, (char)160, (char)28, (char)243, (char)130, (char)9, (char)11, (char)158, (char)7, (char)148, (char)197, (char)113, (char)93, (char)226, (char)224, (char)10, (char)66, (char)248};
-static char const QUOTE_170[] PROGMEM = {(char)59, (char)200, (char)64, (char)181, (char)222, (char)44, (char)2, (char)86, (char)1, (char)21, (char)192, (char)115, (char)206, (char)9, (char)208, (char)165, (char)36, (char)193, (char)66, (char)128, (char)146, (char)123, (char)150, (char)87, (char)1, (char)237, (char)3, (char)159, (char)38, (char)132, (char)44, (char)4, (char)18, (char)23, (char)60, (char)20, (char)40, (char)39, (char)2, (char)176, (char)174, (char)248};
-static char const QUOTE_171[] PROGMEM = {(char)74, (char)193, (char)55, (char)6, (char)0, (char)164, (char)159, (char)91, (char)149, (char)211, (char)3, (char)158, (char)112, (char)78, (char)133, (char)41, (char)38, (char)7, (char)36, (char)180, (char)2, (char)30, (char)80, (char)52, (char)50, (char)162, (char)92, (char)80, (char)62, (char)0, (char)32, (char)104, (char)8, (char)4, (char)44, (char)162, (char)138, (char)5, (char)220, (char)45, (char)248};
-static char const QUOTE_172[] PROGMEM = {(char)74, (char)192, (char)215, (char)150, (char)128, (char)65, (char)104, (char)3, (char)52, (char)192, (char)17, (char)103, (char)74, (char)214, (char)94, (char)123, (char)104, (char)101, (char)68, (char)184, (char)190, (char)125, (char)2, (char)18, (char)89, (char)88, (char)46, (char)3, (char)66, (char)25, (char)0, (char)182, (char)43, (char)128, (char)248, (char)0, (char)133, (char)2, (char)30, (char)243, (char)208, (char)160, (char)157, (char)10, (char)198, (char)21, (char)223};
-static char const QUOTE_173[] PROGMEM = {(char)65, (char)104, (char)2, (char)200, (char)243, (char)161, (char)65, (char)164, (char)169, (char)192, (char)130, (char)104, (char)89, (char)1, (char)165, (char)160, (char)38, (char)192, (char)205, (char)5, (char)152, (char)18, (char)224, (char)105, (char)42, (char)112, (char)28, (char)16, (char)183, (char)197, (char)128, (char)43, (char)128, (char)208, (char)202, (char)137, (char)113, (char)124, (char)88, (char)2, (char)36, (char)160, (char)73, (char)105, (char)48, (char)88, (char)46, (char)7, (char)139, (char)124, (char)91, (char)226, (char)208, (char)109, (char)188, (char)12, (char)168, (char)151, (char)20, (char)30, (char)45, (char)241, (char)111, (char)139, (char)64, (char)130, (char)150, (char)159};
-static char const QUOTE_174[] PROGMEM = {(char)184, (char)67, (char)39, (char)180, (char)4, (char)43, (char)151, (char)64, (char)36, (char)164, (char)44, (char)138, (char)87, (char)1, (char)46, (char)41, (char)93, (char)48, (char)16, (char)52, (char)2, (char)86, (char)4, (char)150, (char)147, (char)3, (char)75, (char)64, (char)52, (char)50, (char)162, (char)92, (char)80, (char)32, (char)162, (char)241, (char)255, (char)192};
-static char const QUOTE_175[] PROGMEM = {(char)157, (char)30, (char)214, (char)148, (char)7, (char)123, (char)206, (char)194, (char)130, (char)110, (char)12, (char)40, (char)10, (char)2, (char)197, (char)148, (char)198, (char)132, (char)176, (char)20, (char)172, (char)230, (char)87, (char)1, (char)161, (char)149, (char)18, (char)226, (char)128, (char)174, (char)3, (char)67, (char)42, (char)36, (char)174, (char)3, (char)146, (char)90, (char)124};
-static char const QUOTE_176[] PROGMEM = {(char)17, (char)73, (char)68, (char)168, (char)158, (char)63, (char)1, (char)92, (char)7, (char)216, (char)178, (char)7, (char)141, (char)60, (char)96, (char)6, (char)165, (char)213, (char)161, (char)92, (char)11, (char)148, (char)178, (char)6, (char)138, (char)178, (char)203, (char)199, (char)255};
-static char const QUOTE_177[] PROGMEM = {(char)177, (char)100, (char)114, (char)150, (char)128, (char)81, (char)65, (char)64, (char)184, (char)133, (char)112, (char)28, (char)146, (char)208, (char)20, (char)40, (char)32, (char)242, (char)210, (char)101, (char)119, (char)139, (char)1, (char)100, (char)151, (char)69, (char)146, (char)87, (char)240};
-static char const QUOTE_178[] PROGMEM = {(char)155, (char)3, (char)2, (char)184, (char)9, (char)152, (char)44, (char)247, (char)200, (char)2, (char)173, (char)20, (char)89, (char)248, (char)176, (char)14, (char)41, (char)90, (char)2, (char)6, (char)128, (char)176, (char)92, (char)6, (char)148, (char)1, (char)11, (char)190};
-static char const QUOTE_179[] PROGMEM = {(char)161, (char)64, (char)74, (char)214, (char)94, (char)46, (char)2, (char)11, (char)64, (char)53, (char)229, (char)160, (char)2, (char)198, (char)21, (char)161, (char)11, (char)0, (char)114, (char)149, (char)192, (char)57, (char)88, (char)64, (char)45, (char)243, (char)161, (char)92, (char)4, (char)61, (char)242, (char)241, (char)96, (char)18, (char)176, (char)8, (char)174, (char)5, (char)202, (char)192, (char)56, (char)164, (char)44, (char)152, (char)23, (char)16, (char)178, (char)248};
-static char const QUOTE_180[] PROGMEM = {(char)243, (char)240, (char)32, (char)153, (char)4, (char)52, (char)81, (char)102, (char)9, (char)176, (char)33, (char)112, (char)38, (char)192, (char)134, (char)138, (char)44, (char)254};
-static char const QUOTE_181[] PROGMEM = {(char)122, (char)60, (char)88, (char)4, (char)172, (char)4, (char)121, (char)64, (char)22, (char)81, (char)42, (char)32, (char)14, (char)91, (char)189, (char)238, (char)3, (char)66, (char)25, (char)2, (char)225, (char)167, (char)139, (char)129, (char)112, (char)208, (char)15, (char)122, (char)105, (char)226, (char)192, (char)16, (char)52, (char)5, (char)203, (char)37, (char)208, (char)15, (char)122, (char)252, (char)93, (char)240};
-static char const QUOTE_182[] PROGMEM = {(char)80, (char)64, (char)231, (char)212, (char)13, (char)121, (char)104, (char)87, (char)2, (char)229, (char)6, (char)138, (char)178, (char)200, (char)1, (char)96, (char)30, (char)237, (char)20, (char)7, (char)42, (char)10, (char)150, (char)148, (char)20, (char)149, (char)106, (char)181, (char)22, (char)96, (char)124, (char)1, (char)64, (char)152, (char)172, (char)3, (char)10, (char)115, (char)149, (char)223};
-static char const QUOTE_183[] PROGMEM = {(char)185, (char)75, (char)32, (char)20, (char)174, (char)4, (char)223, (char)41, (char)100, (char)23, (char)41, (char)206, (char)91, (char)150, (char)75, (char)160, (char)60, (char)117, (char)178, (char)124};
-static char const QUOTE_184[] PROGMEM = {(char)216, (char)100, (char)116, (char)120, (char)132, (char)14, (char)41, (char)64, (char)153, (char)132, (char)69, (char)99, (char)11, (char)240};
-static char const QUOTE_185[] PROGMEM = {(char)177, (char)100, (char)114, (char)150, (char)128, (char)114, (char)75, (char)64, (char)20, (char)174, (char)3, (char)2, (char)178, (char)187, (char)65, (char)88, (char)26, (char)82, (char)130, (char)133, (char)3, (char)138, (char)210, (char)187, (char)224};
-static char const QUOTE_186[] PROGMEM = {(char)152, (char)208, (char)82, (char)201, (char)236, (char)73, (char)64, (char)153, (char)128, (char)163, (char)69, (char)1, (char)98, (char)208, (char)8, (char)11, (char)136, (char)147, (char)252};
-static char const QUOTE_187[] PROGMEM = {(char)67, (char)220, (char)114, (char)203, (char)197, (char)192, (char)114, (char)75, (char)73, (char)129, (char)46, (char)2, (char)42, (char)153, (char)131, (char)197, (char)190, (char)95, (char)241, (char)104, (char)18, (char)176, (char)28, (char)32, (char)104, (char)67, (char)32, (char)56, (char)33, (char)144, (char)8, (char)80, (char)32, (char)51, (char)145, (char)105, (char)240};
-static char const QUOTE_188[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)5, (char)73, (char)202, (char)230, (char)37, (char)75, (char)3, (char)158, (char)244, (char)208, (char)8, (char)123, (char)142, (char)89, (char)124};
-static char const QUOTE_189[] PROGMEM = {(char)218, (char)120, (char)176, (char)32, (char)162, (char)3, (char)146, (char)90, (char)220, (char)160, (char)91, (char)18, (char)217, (char)141, (char)15, (char)43, (char)168, (char)162, (char)207, (char)224};
-static char const QUOTE_190[] PROGMEM = {(char)74, (char)192, (char)112, (char)129, (char)108, (char)75, (char)90, (char)87, (char)124};
-static char const QUOTE_191[] PROGMEM = {(char)11, (char)6, (char)244, (char)61, (char)158, (char)43, (char)91, (char)18, (char)214, (char)149, (char)222, (char)61, (char)241, (char)236, (char)216, (char)81, (char)162, (char)128, (char)73, (char)10, (char)95, (char)128};
-static char const QUOTE_192[] PROGMEM = {(char)52, (char)170, (char)154, (char)120, (char)132, (char)5, (char)26, (char)40, (char)11, (char)22, (char)128, (char)59, (char)202, (char)69, (char)189, (char)240, (char)3, (char)224, (char)2, (char)20, (char)13, (char)12, (char)151, (char)79, (char)128};
-static char const QUOTE_193[] PROGMEM = {(char)85, (char)100, (char)4, (char)204, (char)5, (char)43, (char)128, (char)32, (char)206, (char)129, (char)12, (char)137, (char)240};
-static char const QUOTE_194[] PROGMEM = {(char)122, (char)0, (char)208, (char)187, (char)197, (char)128, (char)85, (char)100, (char)7, (char)189, (char)127};
-static char const QUOTE_195[] PROGMEM = {(char)64, (char)80, (char)31, (char)22, (char)0, (char)137, (char)40, (char)10, (char)226, (char)129, (char)101, (char)44, (char)128, (char)247, (char)175, (char)224};
-static char const QUOTE_196[] PROGMEM = {(char)115, (char)234, (char)5, (char)86, (char)64, (char)34, (char)74, (char)4, (char)204, (char)5, (char)26, (char)40, (char)4, (char)20, (char)172, (char)5, (char)195, (char)64, (char)8, (char)180, (char)44, (char)128, (char)64, (char)184, (char)4, (char)73, (char)64, (char)116, (char)170, (char)126, (char)46, (char)1, (char)18, (char)80, (char)28, (char)165, (char)53, (char)1, (char)103, (char)190, (char)64, (char)184, (char)104, (char)162, (char)207, (char)224};
-static char const QUOTE_197[] PROGMEM = {(char)11, (char)38, (char)4, (char)172, (char)26, (char)73, (char)86, (char)1, (char)21, (char)192, (char)56, (char)64, (char)149, (char)128, (char)229, (char)187, (char)222, (char)224, (char)78, (char)15, (char)149, (char)10, (char)239, (char)22, (char)2, (char)229, (char)146, (char)232, (char)2, (char)141, (char)20, (char)5, (char)139, (char)41, (char)6, (char)115, (char)43, (char)136, (char)3, (char)188, (char)164, (char)248};
-static char const QUOTE_198[] PROGMEM = {(char)65, (char)101, (char)32, (char)32, (char)33, (char)89, (char)65, (char)114, (char)150, (char)128, (char)32, (char)67, (char)32, (char)92, (char)172, (char)4, (char)130, (char)18, (char)1, (char)165, (char)47, (char)136, (char)126};
-static char const QUOTE_199[] PROGMEM = {(char)106, (char)84, (char)224, (char)16, (char)178, (char)10, (char)88, (char)194, (char)214, (char)64, (char)130, (char)75, (char)10, (char)1, (char)254, (char)95, (char)219, (char)254};
-static char const QUOTE_200[] PROGMEM = {(char)122, (char)0, (char)186, (char)211, (char)197, (char)128, (char)107, (char)128, (char)100, (char)150, (char)147, (char)4, (char)232, (char)16, (char)208, (char)14, (char)121, (char)192, (char)151, (char)0, (char)133, (char)0, (char)170, (char)229, (char)150, (char)95};
-static char const QUOTE_201[] PROGMEM = {(char)50, (char)75, (char)73, (char)149, (char)192, (char)76, (char)192, (char)226, (char)208, (char)20, (char)45, (char)36, (char)153, (char)204, (char)174, (char)248};
-static char const QUOTE_202[] PROGMEM = {(char)218, (char)235, (char)64, (char)114, (char)225, (char)12, (char)128, (char)153, (char)129, (char)169, (char)83, (char)128, (char)100, (char)150, (char)147, (char)155, (char)11, (char)90, (char)21, (char)159};
-static char const QUOTE_203[] PROGMEM = {(char)56, (char)116, (char)86, (char)48, (char)190, (char)33, (char)1, (char)82, (char)224, (char)73, (char)35, (char)69, (char)18, (char)114, (char)204, (char)8, (char)123, (char)24, (char)23, (char)18, (char)65, (char)39, (char)136, (char)126};
-static char const QUOTE_204[] PROGMEM = {(char)180, (char)158, (char)83, (char)150, (char)64, (char)184, (char)102, (char)4, (char)148, (char)133, (char)145, (char)74, (char)224, (char)57, (char)231, (char)2, (char)10, (char)86, (char)1, (char)238, (char)152, (char)209, (char)86, (char)17, (char)39, (char)241, (char)96, (char)29, (char)80, (char)38, (char)96, (char)73, (char)72, (char)89, (char)20, (char)174, (char)3, (char)234, (char)64, (char)21, (char)192, (char)209, (char)107, (char)34, (char)22, (char)73, (char)63, (char)192};
-static char const QUOTE_205[] PROGMEM = {(char)74, (char)193, (char)162, (char)156, (char)1, (char)101, (char)18, (char)162, (char)1, (char)5, (char)97, (char)64, (char)23, (char)16, (char)178, (char)40, (char)8, (char)151, (char)28, (char)174, (char)3, (char)236, (char)89, (char)2, (char)210, (char)121, (char)78, (char)89, (char)124};
-static char const QUOTE_206[] PROGMEM = {(char)32, (char)104, (char)9, (char)141, (char)15, (char)123, (char)154, (char)21, (char)149, (char)192, (char)65, (char)124, (char)92, (char)2, (char)6, (char)128, (char)76, (char)193, (char)167, (char)248, (char)157, (char)192, (char)184, (char)67, (char)34, (char)21, (char)143, (char)209, (char)64, (char)34, (char)233, (char)39, (char)65, (char)82, (char)79, (char)128};
-static char const QUOTE_207[] PROGMEM = {(char)186, (char)86, (char)152, (char)20, (char)137, (char)15, (char)139, (char)188, (char)93, (char)226, (char)224, (char)48, (char)181, (char)88, (char)18, (char)66, (char)151, (char)197, (char)128, (char)104, (char)67, (char)32, (char)52, (char)180, (char)1, (char)10, (char)2, (char)4, (char)224, (char)164, (char)146, (char)89, (char)208, (char)178, (char)248};
-static char const QUOTE_208[] PROGMEM = {(char)122, (char)0, (char)22, (char)76, (char)20, (char)3, (char)224, (char)11, (char)165, (char)105, (char)129, (char)72, (char)144, (char)130, (char)116, (char)8, (char)105, (char)240};
-static char const QUOTE_209[] PROGMEM = {(char)58, (char)130, (char)202, (char)1, (char)51, (char)6, (char)159, (char)226, (char)119, (char)1, (char)165, (char)160, (char)96, (char)246, (char)38, (char)137, (char)29, (char)103, (char)240};
-static char const QUOTE_210[] PROGMEM = {(char)107, (char)90, (char)9, (char)181, (char)239, (char)162, (char)18, (char)89, (char)252};
-static char const QUOTE_211[] PROGMEM = {(char)74, (char)193, (char)55, (char)6, (char)0, (char)114, (char)75, (char)64, (char)33, (char)229, (char)3, (char)74, (char)233, (char)149, (char)192, (char)93, (char)92, (char)226, (char)184, (char)12, (char)45, (char)138, (char)224, (char)105, (char)238, (char)33, (char)100, (char)1, (char)48, (char)174, (char)33, (char)101, (char)240};
-static char const QUOTE_212[] PROGMEM = {(char)184, (char)102, (char)2, (char)60, (char)174, (char)241, (char)248, (char)18, (char)176, (char)45, (char)239, (char)128, (char)2, (char)202, (char)37, (char)68, (char)1, (char)203, (char)119, (char)189, (char)192, (char)114, (char)75, (char)91, (char)148, (char)19, (char)122, (char)214, (char)87, (char)124};
-static char const QUOTE_213[] PROGMEM = {(char)221, (char)56, (char)130, (char)128, (char)73, (char)145, (char)60, (char)88, (char)1, (char)38, (char)68, (char)241, (char)96, (char)4, (char)153, (char)19, (char)197, (char)128, (char)18, (char)100, (char)79, (char)22, (char)2, (char)136, (char)40, (char)4, (char)153, (char)16, (char)9, (char)152, (char)40, (char)130, (char)130, (char)239, (char)145, (char)60, (char)93, (char)240};
-static char const QUOTE_214[] PROGMEM = {(char)45, (char)10, (char)224, (char)38, (char)96, (char)11, (char)24, (char)82, (char)184, (char)9, (char)112, (char)4, (char)89, (char)21, (char)36, (char)75, (char)142, (char)0, (char)178, (char)96, (char)160, (char)32, (char)157, (char)104, (char)32, (char)121, (char)128, (char)208, (char)157, (char)197, (char)164, (char)158, (char)230, (char)132, (char)44, (char)162, (char)84, (char)64, (char)38, (char)127};
-static char const QUOTE_215[] PROGMEM = {(char)9, (char)174, (char)25, (char)248, (char)252, (char)8, (char)10, (char)2, (char)128, (char)160, (char)62, (char)46, (char)1, (char)228, (char)24, (char)40, (char)51, (char)241, (char)112, (char)28, (char)82, (char)128, (char)137, (char)40, (char)16, (char)81, (char)1, (char)43, (char)3, (char)158, (char)112, (char)57, (char)37, (char)160, (char)14, (char)82, (char)4, (char)46, (char)248};
-static char const QUOTE_216[] PROGMEM = {(char)44, (char)129, (char)58, (char)4, (char)52, (char)3, (char)158, (char)112, (char)105, (char)254, (char)39, (char)112, (char)42, (char)228, (char)208, (char)22, (char)11, (char)128, (char)212, (char)169, (char)192, (char)179, (char)228, (char)147, (char)148, (char)11, (char)11, (char)75, (char)32, (char)9, (char)42, (char)1, (char)10, (char)0, (char)154, (char)225, (char)159, (char)139, (char)0, (char)149, (char)130, (char)229, (char)45, (char)0, (char)228, (char)150, (char)128, (char)105, (char)75, (char)32, (char)92, (char)52, (char)1, (char)100, (char)4, (char)184, (char)26, (char)13, (char)62};
-static char const QUOTE_217[] PROGMEM = {(char)122, (char)60, (char)88, (char)4, (char)172, (char)13, (char)121, (char)104, (char)6, (char)165, (char)78, (char)0, (char)77, (char)112, (char)204, (char)4, (char)121, (char)93, (char)226, (char)192, (char)64, (char)46, (char)4, (char)198, (char)132, (char)181, (char)165, (char)96, (char)10, (char)237, (char)63, (char)197, (char)192, (char)122, (char)0, (char)226, (char)151, (char)197, (char)128, (char)165, (char)202, (char)80, (char)64, (char)46, (char)113, (char)92, (char)9, (char)141, (char)9, (char)107, (char)74, (char)207, (char)128};
-static char const QUOTE_218[] PROGMEM = {(char)9, (char)174, (char)25, (char)248, (char)176, (char)15, (char)64, (char)14, (char)242, (char)120, (char)176, (char)4, (char)13, (char)0, (char)215, (char)150, (char)128, (char)123, (char)214, (char)7, (char)60, (char)255};
-static char const QUOTE_219[] PROGMEM = {(char)216, (char)77, (char)112, (char)204, (char)7, (char)8, (char)8, (char)247, (char)147, (char)196, (char)32, (char)184, (char)93, (char)64, (char)16, (char)52, (char)3, (char)94, (char)90, (char)1, (char)239, (char)88, (char)28, (char)243, (char)131, (char)136, (char)121, (char)110, (char)86, (char)1, (char)43, (char)0, (char)88, (char)13, (char)21, (char)101, (char)144, (char)60, (char)101, (char)226, (char)255, (char)25, (char)148, (char)8, (char)40, (char)128, (char)114, (char)144, (char)33, (char)119, (char)139, (char)129, (char)226, (char)139, (char)132, (char)50, (char)123, (char)65, (char)227, (char)47, (char)23, (char)248, (char)207, (char)199, (char)224, (char)185, (char)88, (char)234, (char)248, (char)176, (char)20, (char)185, (char)74, (char)0, (char)152, (char)146, (char)170, (char)97, (char)34, (char)173, (char)101, (char)112, (char)44, (char)246, (char)120, (char)167, (char)224};
-static char const QUOTE_220[] PROGMEM = {(char)203, (char)234, (char)3, (char)190, (char)148, (char)8, (char)8, (char)240, (char)81, (char)5, (char)0, (char)222, (char)245, (char)165, (char)199, (char)0, (char)178, (char)10, (char)32, (char)160, (char)19, (char)222, (char)191, (char)16, (char)252};
-static char const QUOTE_221[] PROGMEM = {(char)91, (char)214, (char)87, (char)120, (char)132, (char)13, (char)8, (char)100, (char)2, (char)150, (char)83, (char)160, (char)2, (char)198, (char)20, (char)16, (char)11, (char)156, (char)87, (char)0, (char)38, (char)184, (char)103, (char)50, (char)187, (char)224};
-static char const QUOTE_222[] PROGMEM = {(char)104, (char)93, (char)226, (char)192, (char)37, (char)96, (char)65, (char)68, (char)0, (char)176, (char)20, (char)185, (char)74, (char)6, (char)132, (char)46, (char)33, (char)92, (char)7, (char)36, (char)180, (char)3, (char)74, (char)89, (char)0, (char)229, (char)91, (char)222, (char)186, (char)120, (char)184, (char)4, (char)40, (char)2, (char)107, (char)134, (char)96, (char)76, (char)192, (char)231, (char)156, (char)19, (char)161, (char)74, (char)73, (char)129, (char)201, (char)45, (char)0, (char)114, (char)144, (char)33, (char)119, (char)192};
-static char const QUOTE_223[] PROGMEM = {(char)203, (char)234, (char)3, (char)190, (char)148, (char)8, (char)8, (char)240, (char)81, (char)5, (char)0, (char)222, (char)245, (char)165, (char)199, (char)0, (char)178, (char)10, (char)32, (char)160, (char)19, (char)222, (char)191, (char)16, (char)131, (char)47, (char)168, (char)22, (char)231, (char)220, (char)25, (char)125, (char)64, (char)48, (char)186, (char)128, (char)17, (char)64, (char)192, (char)235, (char)62, (char)33, (char)248};
-static char const QUOTE_224[] PROGMEM = {(char)122, (char)60, (char)88, (char)11, (char)132, (char)104, (char)160, (char)12, (char)96, (char)37, (char)96, (char)92, (char)146, (char)163, (char)130, (char)229, (char)44, (char)128, (char)82, (char)184, (char)19, (char)108, (char)193, (char)96, (char)184, (char)7, (char)123, (char)206, (char)194, (char)252};
-static char const QUOTE_225[] PROGMEM = {(char)33, (char)64, (char)66, (char)214, (char)147, (char)26, (char)10, (char)1, (char)5, (char)14, (char)2, (char)10, (char)83, (char)80, (char)4, (char)13, (char)0, (char)81, (char)162, (char)128, (char)211, (char)236, (char)82, (char)176, (char)2, (char)45, (char)11, (char)32, (char)28, (char)178, (char)41, (char)202, (char)194, (char)124};
-static char const QUOTE_226[] PROGMEM = {(char)33, (char)64, (char)233, (char)129, (char)51, (char)1, (char)202, (char)112, (char)200, (char)46, (char)33, (char)75, (char)34, (char)0, (char)149, (char)172, (char)136, (char)89, (char)1, (char)239, (char)95, (char)192};
-static char const QUOTE_227[] PROGMEM = {(char)241, (char)80, (char)88, (char)194, (char)207, (char)197, (char)64, (char)184, (char)104, (char)4, (char)172, (char)13, (char)45, (char)0, (char)66, (char)128, (char)65, (char)67, (char)128, (char)130, (char)136, (char)7, (char)41, (char)2, (char)23, (char)0, (char)233, (char)113, (char)192, (char)34, (char)208, (char)178, (char)1, (char)2, (char)224, (char)52, (char)180, (char)1, (char)10, (char)7, (char)79, (char)224};
-static char const QUOTE_228[] PROGMEM = {(char)33, (char)65, (char)183, (char)76, (char)28, (char)107, (char)203, (char)64, (char)61, (char)235, (char)1, (char)203, (char)119, (char)189, (char)192, (char)41, (char)92, (char)9, (char)141, (char)15, (char)113, (char)102, (char)11, (char)188, (char)104, (char)43, (char)138, (char)226, (char)22, (char)96, (char)162, (char)70, (char)178, (char)208, (char)9, (char)117, (char)158, (char)89, (char)21, (char)223};
-static char const QUOTE_229[] PROGMEM = {(char)33, (char)64, (char)233, (char)129, (char)175, (char)45, (char)1, (char)112, (char)208, (char)2, (char)45, (char)11, (char)32, (char)56, (char)36, (char)43, (char)150, (char)87, (char)1, (char)246, (char)44, (char)128, (char)68, (char)148, (char)20, (char)172, (char)230, (char)87, (char)16, (char)181, (char)145, (char)93, (char)226, (char)224, (char)20, (char)174, (char)2, (char)10, (char)226, (char)21, (char)128, (char)34, (char)74, (char)5, (char)20, (char)13, (char)121, (char)104, (char)7, (char)216, (char)178, (char)64, (char)88, (char)87, (char)1, (char)51, (char)1, (char)203, (char)119, (char)189, (char)192, (char)114, (char)75, (char)64, (char)49, (char)231, (char)76, (char)198, (char)143, (char)128};
-static char const QUOTE_230[] PROGMEM = {(char)59, (char)202, (char)64, (char)36, (char)133, (char)47, (char)139, (char)0, (char)149, (char)128, (char)225, (char)4, (char)19, (char)173, (char)4, (char)11, (char)124, (char)10, (char)239, (char)128};
-static char const QUOTE_231[] PROGMEM = {(char)74, (char)192, (char)66, (char)185, (char)96, (char)32, (char)104, (char)4, (char)172, (char)26, (char)120, (char)26, (char)16, (char)200, (char)5, (char)43, (char)129, (char)4, (char)235, (char)65, (char)1, (char)194, (char)5, (char)190, (char)5, (char)119, (char)192};
-static char const QUOTE_232[] PROGMEM = {(char)74, (char)192, (char)114, (char)138, (char)85, (char)74, (char)192, (char)114, (char)149, (char)192, (char)170, (char)74, (char)224, (char)89, (char)239, (char)144, (char)32, (char)157, (char)104, (char)62, (char)39, (char)152, (char)16, (char)247, (char)203, (char)224};
-static char const QUOTE_233[] PROGMEM = {(char)74, (char)192, (char)112, (char)131, (char)79, (char)4, (char)19, (char)173, (char)4, (char)8, (char)11, (char)10, (char)239, (char)128};
-static char const QUOTE_234[] PROGMEM = {(char)41, (char)92, (char)8, (char)39, (char)90, (char)8, (char)16, (char)242, (char)154, (char)128, (char)75, (char)128, (char)66, (char)129, (char)213, (char)27, (char)10, (char)20, (char)200, (char)160, (char)145, (char)66, (char)58, (char)62, (char)64, (char)104, (char)67, (char)32, (char)62, (char)0, (char)241, (char)151, (char)140, (char)60, (char)96, (char)3, (char)200, (char)36, (char)43, (char)188, (char)88, (char)5, (char)149, (char)206, (char)43, (char)18, (char)165, (char)252};
-static char const QUOTE_235[] PROGMEM = {(char)17, (char)104, (char)89, (char)1, (char)207, (char)121, (char)44, (char)242, (char)146, (char)101, (char)96, (char)8, (char)23, (char)0, (char)165, (char)112, (char)32, (char)157, (char)104, (char)63};
-static char const QUOTE_236[] PROGMEM = {(char)74, (char)193, (char)164, (char)208, (char)23, (char)43, (char)1, (char)4, (char)235, (char)65, (char)5, (char)10, (char)7, (char)216, (char)178, (char)185, (char)78, (char)87, (char)124};
-static char const QUOTE_237[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)5, (char)43, (char)129, (char)4, (char)235, (char)65, (char)1, (char)202, (char)64, (char)133, (char)223};
-static char const QUOTE_238[] PROGMEM = {(char)34, (char)104, (char)11, (char)134, (char)96, (char)41, (char)92, (char)9, (char)189, (char)242, (char)160, (char)5, (char)39, (char)188, (char)138, (char)40, (char)32, (char)157, (char)104, (char)34, (char)121, (char)10, (char)223, (char)128};
-static char const QUOTE_239[] PROGMEM = {(char)241, (char)13, (char)210, (char)93, (char)21, (char)32, (char)130, (char)117, (char)160, (char)252};
-static char const QUOTE_240[] PROGMEM = {(char)130, (char)117, (char)160, (char)128, (char)174, (char)1, (char)74, (char)224, (char)53, (char)238, (char)8, (char)40, (char)242, (char)209, (char)69, (char)241, (char)15, (char)192};
-static char const QUOTE_241[] PROGMEM = {(char)122, (char)0, (char)186, (char)211, (char)197, (char)128, (char)18, (char)84, (char)2, (char)149, (char)192, (char)130, (char)117, (char)160, (char)129, (char)175, (char)45, (char)0, (char)162, (char)129, (char)238, (char)162, (char)31, (char)82, (char)21, (char)192, (char)184, (char)92, (char)226, (char)150, (char)64, (char)81, (char)64, (char)208, (char)22, (char)73, (char)116, (char)232, (char)248, (char)83, (char)224};
-static char const QUOTE_242[] PROGMEM = {(char)34, (char)87, (char)160, (char)175, (char)197, (char)192, (char)11, (char)0, (char)82, (char)208, (char)9, (char)88, (char)52, (char)86, (char)24, (char)15, (char)122, (char)193, (char)4, (char)235, (char)65, (char)5, (char)130, (char)224, (char)217, (char)238, (char)39, (char)139, (char)128, (char)208, (char)134, (char)64, (char)211, (char)220, (char)66, (char)200, (char)13, (char)123, (char)131, (char)71, (char)150, (char)138, (char)47, (char)136, (char)64, (char)22, (char)33, (char)229, (char)185, (char)89, (char)226, (char)239, (char)23, (char)120, (char)184, (char)13, (char)76, (char)230, (char)52, (char)36, (char)174, (char)5, (char)30, (char)52, (char)1, (char)161, (char)12, (char)128, (char)91, (char)21, (char)192, (char)41, (char)93, (char)69, (char)20, (char)8, (char)11, (char)10, (char)239, (char)128};
-static char const QUOTE_243[] PROGMEM = {(char)130, (char)117, (char)160, (char)248, (char)184, (char)30, (char)50, (char)5, (char)107, (char)32, (char)48, (char)52, (char)44, (char)128, (char)130, (char)136, (char)10, (char)40, (char)46, (char)82, (char)200, (char)8, (char)123, (char)142, (char)89, (char)120, (char)184, (char)8, (char)124, (char)10, (char)199, (char)190, (char)127};
-static char const QUOTE_244[] PROGMEM = {(char)83, (char)234, (char)5, (char)189, (char)235, (char)131, (char)2, (char)26, (char)1, (char)51, (char)5, (char)211, (char)79, (char)31, (char)129, (char)254, (char)95, (char)219, (char)252, (char)119, (char)227, (char)176, (char)112, (char)137, (char)40, (char)44, (char)23, (char)1, (char)169, (char)80, (char)28, (char)146, (char)208, (char)8, (char)123, (char)229, (char)226, (char)192, (char)17, (char)37, (char)2, (char)102, (char)3, (char)201, (char)229, (char)119, (char)192};
-static char const QUOTE_245[] PROGMEM = {(char)152, (char)208, (char)90, (char)200, (char)85, (char)74, (char)193, (char)103, (char)190, (char)75, (char)123, (char)64, (char)162, (char)129, (char)165, (char)160, (char)26, (char)247, (char)6, (char)143, (char)45, (char)20, (char)89, (char)129, (char)207, (char)26, (char)1, (char)4, (char)235, (char)65, (char)241, (char)60, (char)254};
-static char const QUOTE_246[] PROGMEM = {(char)243, (char)242, (char)222, (char)99, (char)36, (char)190, (char)44, (char)2, (char)222, (char)99, (char)36, (char)190, (char)44, (char)3, (char)10, (char)181, (char)150, (char)64, (char)16, (char)86, (char)162, (char)129, (char)111, (char)49, (char)146, (char)95, (char)128};
-static char const QUOTE_247[] PROGMEM = {(char)149, (char)73, (char)144, (char)105, (char)245, (char)2, (char)138, (char)2, (char)149, (char)192, (char)16, (char)88, (char)146, (char)173, (char)149, (char)77, (char)139, (char)32, (char)57, (char)229, (char)105, (char)93, (char)240};
-static char const QUOTE_248[] PROGMEM = {(char)65, (char)64, (char)183, (char)152, (char)201, (char)47, (char)139, (char)0, (char)119, (char)148, (char)128, (char)73, (char)10, (char)95, (char)128};
-static char const QUOTE_249[] PROGMEM = {(char)155, (char)3, (char)8, (char)20, (char)11, (char)121, (char)140, (char)146, (char)129, (char)51, (char)5, (char)146, (char)89, (char)131, (char)199, (char)94, (char)40, (char)248};
-static char const QUOTE_250[] PROGMEM = {(char)122, (char)0, (char)68, (char)148, (char)5, (char)113, (char)64, (char)178, (char)150, (char)64, (char)105, (char)104, (char)2, (char)133, (char)175, (char)112, (char)30, (char)245, (char)248, (char)176, (char)13, (char)45, (char)0, (char)68, (char)148, (char)1, (char)99, (char)11, (char)57, (char)21, (char)46, (char)73, (char)203, (char)32, (char)63, (char)203, (char)251, (char)127, (char)192};
-static char const QUOTE_251[] PROGMEM = {(char)211, (char)216, (char)23, (char)28, (char)8, (char)45, (char)0, (char)114, (char)149, (char)192, (char)19, (char)228, (char)66, (char)221, (char)51, (char)153, (char)101, (char)50, (char)60, (char)171, (char)81, (char)102, (char)183, (char)152, (char)201, (char)40, (char)19, (char)63, (char)128};
-static char const QUOTE_252[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)30, (char)39, (char)160, (char)14, (char)93, (char)22, (char)158, (char)44, (char)1, (char)92, (char)1, (char)21, (char)192, (char)241, (char)61, (char)1, (char)98, (char)202, (char)207, (char)97, (char)202, (char)233, (char)130, (char)197, (char)145, (char)203, (char)66, (char)184, (char)15, (char)113, (char)11, (char)32, (char)16, (char)160, (char)153, (char)93, (char)50, (char)191, (char)224};
-static char const QUOTE_253[] PROGMEM = {(char)66, (char)80, (char)159, (char)22, (char)0, (char)161, (char)107, (char)220, (char)183, (char)152, (char)201, (char)47, (char)192};
-static char const QUOTE_254[] PROGMEM = {(char)74, (char)193, (char)160, (char)176, (char)15, (char)122, (char)192, (char)208, (char)134, (char)64, (char)152, (char)22, (char)243, (char)25, (char)37, (char)3, (char)66, (char)178, (char)187, (char)224};
-static char const QUOTE_255[] PROGMEM = {(char)104, (char)67, (char)32, (char)45, (char)230, (char)50, (char)74, (char)6, (char)150, (char)128, (char)157, (char)82, (char)178, (char)200, (char)30, (char)61, (char)241, (char)232, (char)39, (char)84, (char)172, (char)178, (char)184, (char)104, (char)89, (char)1, (char)165, (char)160, (char)22, (char)243, (char)25, (char)37, (char)155, (char)66, (char)21, (char)168, (char)191};
-static char const QUOTE_256[] PROGMEM = {(char)106, (char)84, (char)224, (char)53, (char)229, (char)33, (char)100, (char)4, (char)20, (char)166, (char)160, (char)10, (char)87, (char)0, (char)51, (char)164, (char)158, (char)231, (char)181, (char)51, (char)26, (char)10, (char)5, (char)188, (char)198, (char)73, (char)86, (char)23, (char)124};
-static char const QUOTE_257[] PROGMEM = {(char)43, (char)129, (char)181, (char)23, (char)85, (char)159, (char)139, (char)1, (char)203, (char)134, (char)128, (char)36, (char)146, (char)229, (char)129, (char)43, (char)5, (char)138, (char)86, (char)1, (char)111, (char)49, (char)146, (char)95, (char)128};
-static char const QUOTE_258[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)26, (char)123, (char)136, (char)19, (char)181, (char)36, (char)32, (char)78, (char)2, (char)149, (char)192, (char)114, (char)75, (char)91, (char)130, (char)1, (char)88, (char)2, (char)23, (char)28, (char)162, (char)147, (char)214, (char)87, (char)2, (char)193, (char)112, (char)60, (char)101, (char)227, (char)64, (char)64, (char)36, (char)159, (char)139, (char)0, (char)87, (char)0, (char)69, (char)112, (char)11, (char)32, (char)58, (char)160, (char)18, (char)84, (char)224, (char)128, (char)143, (char)124, (char)144, (char)82, (char)187, (char)224};
-static char const QUOTE_259[] PROGMEM = {(char)65, (char)104, (char)80, (char)45, (char)230, (char)50, (char)74, (char)4, (char)204, (char)1, (char)175, (char)192};
-static char const QUOTE_260[] PROGMEM = {(char)114, (char)75, (char)64, (char)88, (char)178, (char)57, (char)104, (char)87, (char)1, (char)69, (char)4, (char)2, (char)64, (char)80, (char)160, (char)177, (char)101, (char)116, (char)206, (char)101, (char)97, (char)93, (char)226, (char)31, (char)128};
-static char const QUOTE_261[] PROGMEM = {(char)80, (char)64, (char)135, (char)190, (char)94, (char)44, (char)2, (char)223, (char)82, (char)1, (char)111, (char)130, (char)138, (char)7, (char)184, (char)133, (char)144, (char)8, (char)80, (char)76, (char)174, (char)153, (char)95, (char)240};
-static char const QUOTE_262[] PROGMEM = {(char)106, (char)103, (char)49, (char)161, (char)37, (char)112, (char)26, (char)242, (char)208, (char)9, (char)88, (char)30, (char)245, (char)129, (char)161, (char)12, (char)128, (char)114, (char)221, (char)239, (char)112, (char)16, (char)86, (char)21, (char)161, (char)11, (char)1, (char)58, (char)62, (char)16, (char)43, (char)128, (char)210, (char)208, (char)11, (char)121, (char)140, (char)146, (char)252};
-static char const QUOTE_263[] PROGMEM = {(char)34, (char)74, (char)2, (char)184, (char)160, (char)89, (char)75, (char)32, (char)81, (char)229, (char)112, (char)26, (char)224, (char)17, (char)245, (char)26, (char)10, (char)9, (char)210, (char)171, (char)5, (char)195, (char)48, (char)61, (char)235, (char)241, (char)112, (char)16, (char)90, (char)3, (char)105, (char)119, (char)139, (char)120, (char)130, (char)178, (char)4, (char)44, (char)214, (char)210, (char)166, (char)106, (char)40, (char)22, (char)247, (char)3, (char)73, (char)26, (char)0, (char)81, (char)162, (char)128, (char)114, (char)75, (char)64, (char)89, (char)239, (char)148, (char)232, (char)86, (char)48, (char)174, (char)1, (char)3, (char)64, (char)37, (char)96, (char)115, (char)206, (char)11, (char)149, (char)128, (char)41, (char)92, (char)8, (char)4, (char)50, (char)1, (char)2, (char)114, (char)184, (char)26, (char)123, (char)136, (char)89, (char)0, (char)143, (char)168, (char)208, (char)80, (char)45, (char)238, (char)241, (char)119, (char)192};
-static char const QUOTE_264[] PROGMEM = {(char)218, (char)235, (char)79, (char)22, (char)3, (char)137, (char)88, (char)52, (char)19, (char)128, (char)165, (char)112, (char)52, (char)150, (char)88, (char)178, (char)178, (char)102, (char)162, (char)252};
-static char const QUOTE_265[] PROGMEM = {(char)74, (char)192, (char)185, (char)37, (char)71, (char)2, (char)11, (char)64, (char)45, (char)245, (char)39, (char)139, (char)128, (char)215, (char)150, (char)128, (char)115, (char)206, (char)9, (char)208, (char)165, (char)36, (char)192, (char)71, (char)212, (char)104, (char)43, (char)128, (char)208, (char)134, (char)64, (char)33, (char)65, (char)50, (char)201, (char)37, (char)2, (char)102, (char)10, (char)20, (char)19, (char)128, (char)92, (char)226, (char)184, (char)159};
-static char const QUOTE_266[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)5, (char)26, (char)40, (char)7, (char)36, (char)180, (char)1, (char)202, (char)231, (char)148, (char)224, (char)43, (char)139, (char)35, (char)164, (char)160, (char)123, (char)65, (char)66, (char)128, (char)143, (char)168, (char)208, (char)87, (char)120, (char)184, (char)5, (char)44, (char)167, (char)64, (char)52, (char)33, (char)144, (char)10, (char)87, (char)2, (char)1, (char)115, (char)138, (char)229, (char)188, (char)171, (char)248};
-static char const QUOTE_267[] PROGMEM = {(char)67, (char)91, (char)226, (char)192, (char)17, (char)37, (char)1, (char)37, (char)88, (char)64, (char)174, (char)1, (char)18, (char)80, (char)88, (char)46, (char)3, (char)74, (char)0, (char)152, (char)146, (char)124, (char)10, (char)239, (char)22, (char)1, (char)51, (char)1, (char)3, (char)64, (char)88, (char)46, (char)5, (char)0, (char)71, (char)212, (char)104, (char)43, (char)188, (char)88, (char)7, (char)152, (char)9, (char)152, (char)8, (char)26, (char)0, (char)44, (char)185, (char)75, (char)32, (char)106, (char)229, (char)45, (char)60, (char)126, (char)15, (char)63, (char)121, (char)127, (char)207, (char)223};
-static char const QUOTE_268[] PROGMEM = {(char)74, (char)193, (char)0, (char)204, (char)4, (char)46, (char)138, (char)5, (char)148, (char)178, (char)241, (char)96, (char)18, (char)176, (char)32, (char)162, (char)1, (char)10, (char)0, (char)152, (char)229, (char)99, (char)224, (char)87, (char)0, (char)129, (char)57, (char)92, (char)11, (char)20, (char)172, (char)5, (char)10, (char)11, (char)4, (char)43, (char)1, (char)202, (char)71, (char)212, (char)104, (char)41, (char)60, (char)92, (char)2, (char)184, (char)13, (char)112, (char)44, (char)25, (char)149, (char)137, (char)113, (char)64, (char)153, (char)129, (char)240, (char)248};
-static char const QUOTE_269[] PROGMEM = {(char)40, (char)209, (char)64, (char)77, (char)129, (char)129, (char)93, (char)226, (char)192, (char)32, (char)40, (char)15, (char)139, (char)0, (char)162, (char)129, (char)137, (char)82, (char)232, (char)6, (char)165, (char)64, (char)185, (char)89, (char)240};
-static char const QUOTE_270[] PROGMEM = {(char)208, (char)78, (char)5, (char)20, (char)26, (char)112, (char)14, (char)27, (char)20, (char)1, (char)29, (char)18, (char)80, (char)52, (char)180, (char)1, (char)10, (char)13, (char)92, (char)165, (char)135, (char)143, (char)254};
-static char const QUOTE_271[] PROGMEM = {(char)97, (char)106, (char)176, (char)78, (char)149, (char)90, (char)138, (char)15, (char)16, (char)248, (char)244, (char)12, (char)45, (char)86, (char)7, (char)180, (char)20, (char)40, (char)24, (char)93, (char)21, (char)223};
-static char const QUOTE_272[] PROGMEM = {(char)178, (char)91, (char)227, (char)240, (char)108, (char)252, (char)46, (char)158, (char)226, (char)32, (char)169, (char)39, (char)139, (char)129, (char)186, (char)113, (char)51, (char)157, (char)75, (char)227, (char)255, (char)128};
-static char const QUOTE_273[] PROGMEM = {(char)64, (char)80, (char)16, (char)53, (char)42, (char)112, (char)10, (char)226, (char)130, (char)99, (char)65, (char)100, (char)208, (char)38, (char)96, (char)60, (char)158, (char)87, (char)0, (char)174, (char)3, (char)82, (char)167, (char)0, (char)46, (char)33, (char)100, (char)80, (char)73, (char)239, (char)39, (char)139, (char)129, (char)112, (char)208, (char)2, (char)121, (char)83, (char)64, (char)53, (char)42, (char)1, (char)3, (char)64, (char)57, (char)245, (char)248};
-static char const QUOTE_274[] PROGMEM = {(char)74, (char)192, (char)34, (char)144, (char)174, (char)88, (char)60, (char)79, (char)64, (char)28, (char)164, (char)72, (char)209, (char)64, (char)52, (char)180, (char)1, (char)74, (char)224, (char)49, (char)35, (char)69, (char)14, (char)91, (char)21, (char)196, (char)40, (char)39, (char)68, (char)154, (char)159};
-static char const QUOTE_275[] PROGMEM = {(char)11, (char)0, (char)68, (char)148, (char)20, (char)40, (char)208, (char)228, (char)149, (char)96, (char)178, (char)92, (char)64, (char)37, (char)96, (char)114, (char)75, (char)64, (char)105, (char)224, (char)115, (char)200, (char)147, (char)128, (char)73, (char)80, (char)8, (char)23, (char)76, (char)174, (char)248};
-static char const QUOTE_276[] PROGMEM = {(char)164, (char)171, (char)58, (char)21, (char)223};
-static char const QUOTE_277[] PROGMEM = {(char)32, (char)104, (char)11, (char)134, (char)96, (char)144, (char)93, (char)164, (char)159, (char)197, (char)128, (char)18, (char)84, (char)224, (char)129, (char)197, (char)160, (char)52, (char)240, (char)22, (char)71, (char)0, (char)89, (char)48, (char)9, (char)242, (char)33, (char)93, (char)116, (char)206, (char)101, (char)145, (char)30, (char)85, (char)168, (char)179, (char)91, (char)204, (char)100, (char)151, (char)224};
-static char const QUOTE_278[] PROGMEM = {(char)221, (char)195, (char)79, (char)31, (char)248, (char)132, (char)28, (char)57, (char)74, (char)224, (char)48, (char)43, (char)43, (char)180, (char)21, (char)248, (char)255, (char)224};
-static char const QUOTE_279[] PROGMEM = {(char)210, (char)92, (char)4, (char)184, (char)9, (char)45, (char)38, (char)6, (char)21, (char)107, (char)44, (char)167, (char)226, (char)224, (char)32, (char)51, (char)145, (char)105, (char)227, (char)255, (char)128};
-static char const QUOTE_280[] PROGMEM = {(char)105, (char)104, (char)6, (char)165, (char)78, (char)4, (char)232, (char)243, (char)106, (char)169, (char)57, (char)100, (char)4, (char)204, (char)19, (char)163, (char)205, (char)170, (char)164, (char)229, (char)112, (char)2, (char)202, (char)37, (char)68, (char)1, (char)74, (char)224, (char)65, (char)133, (char)210, (char)75, (char)47, (char)128};
-static char const QUOTE_281[] PROGMEM = {(char)35, (char)202, (char)224, (char)42, (char)172, (char)98, (char)74, (char)0, (char)177, (char)133, (char)104, (char)66, (char)192, (char)5, (char)128, (char)105, (char)74, (char)0, (char)133, (char)192, (char)33, (char)64, (char)196, (char)154, (char)151, (char)41, (char)39, (char)73, (char)37, (char)68, (char)241, (char)255, (char)192};
-static char const QUOTE_282[] PROGMEM = {(char)98, (char)77, (char)66, (char)187, (char)199, (char)224, (char)74, (char)192, (char)112, (char)128, (char)44, (char)3, (char)75, (char)64, (char)109, (char)92, (char)120, (char)190};
-static char const QUOTE_283[] PROGMEM = {(char)33, (char)65, (char)58, (char)192, (char)178, (char)1, (char)10, (char)1, (char)60, (char)178, (char)1, (char)18, (char)80, (char)28, (char)33, (char)160, (char)30, (char)208, (char)120, (char)224, (char)21, (char)172, (char)128, (char)68, (char)141, (char)20, (char)248};
-static char const QUOTE_284[] PROGMEM = {(char)218, (char)235, (char)79, (char)23, (char)3, (char)151, (char)125, (char)65, (char)227, (char)127, (char)29, (char)120, (char)207, (char)198, (char)0, (char)124, (char)39, (char)64, (char)133, (char)222, (char)33, (char)2, (char)2, (char)64, (char)40, (char)160, (char)105, (char)64, (char)228, (char)150, (char)128, (char)184, (char)86, (char)178, (char)200, (char)11, (char)171, (char)156, (char)87, (char)0, (char)69, (char)99, (char)10, (char)224, (char)60, (char)218, (char)127, (char)143, (char)254};
-static char const QUOTE_285[] PROGMEM = {(char)59, (char)202, (char)79, (char)22, (char)0, (char)129, (char)160, (char)19, (char)48, (char)83, (char)197, (char)192, (char)74, (char)192, (char)112, (char)128, (char)229, (char)187, (char)222, (char)224, (char)58, (char)160, (char)155, (char)3, (char)2, (char)184, (char)5, (char)112, (char)60, (char)97, (char)227, (char)79, (char)24, (char)120, (char)192, (char)15, (char)132, (char)232, (char)16, (char)187, (char)224};
-static char const QUOTE_286[] PROGMEM = {(char)17, (char)92, (char)7, (char)60, (char)224, (char)104, (char)67, (char)32, (char)56, (char)180, (char)3, (char)225, (char)226, (char)192, (char)57, (char)231, (char)1, (char)202, (char)87, (char)0, (char)213, (char)26, (char)193, (char)84, (char)208, (char)229, (char)179, (char)203, (char)34, (char)120, (char)184, (char)9, (char)88, (char)14, (char)16, (char)45, (char)137, (char)107, (char)74, (char)239, (char)128};
-static char const QUOTE_287[] PROGMEM = {(char)12, (char)142, (char)143, (char)22, (char)2, (char)162, (char)171, (char)169, (char)80, (char)38, (char)96, (char)11, (char)0, (char)226, (char)208, (char)26, (char)120, (char)5, (char)32, (char)172, (char)1, (char)100, (char)192, (char)66, (char)137, (char)33, (char)112, (char)60, (char)117, (char)226, (char)255, (char)128};
-static char const QUOTE_288[] PROGMEM = {(char)184, (char)67, (char)39, (char)180, (char)9, (char)152, (char)11, (char)32, (char)57, (char)37, (char)160, (char)60, (char)98, (char)3, (char)6, (char)147, (char)121, (char)92, (char)196, (char)169, (char)101, (char)3, (char)18, (char)234, (char)224, (char)137, (char)157, (char)36, (char)145, (char)86, (char)137, (char)40, (char)60, (char)91, (char)229, (char)255, (char)22, (char)252};
-static char const QUOTE_289[] PROGMEM = {(char)168, (char)170, (char)234, (char)84, (char)9, (char)152, (char)14, (char)91, (char)189, (char)238, (char)3, (char)139, (char)64, (char)5, (char)147, (char)5, (char)210, (char)226, (char)62, (char)243, (char)248};
-static char const QUOTE_290[] PROGMEM = {(char)59, (char)201, (char)226, (char)192, (char)92, (char)52, (char)2, (char)102, (char)2, (char)6, (char)128, (char)168, (char)170, (char)234, (char)84, (char)15, (char)122, (char)192, (char)82, (char)184, (char)7, (char)46, (char)138, (char)149, (char)252};
-static char const QUOTE_291[] PROGMEM = {(char)129, (char)100, (char)192, (char)38, (char)96, (char)123, (char)214, (char)9, (char)214, (char)5, (char)146, (char)75, (char)89, (char)124};
-static char const QUOTE_292[] PROGMEM = {(char)40, (char)209, (char)64, (char)6, (char)229, (char)155, (char)218, (char)95, (char)22, (char)0, (char)165, (char)112, (char)24, (char)21, (char)149, (char)218, (char)10, (char)254};
-static char const QUOTE_293[] PROGMEM = {(char)184, (char)67, (char)39, (char)180, (char)23, (char)41, (char)104, (char)7, (char)36, (char)173, (char)11, (char)136, (char)11, (char)134, (char)128, (char)41, (char)92, (char)6, (char)5, (char)101, (char)118, (char)130, (char)176, (char)38, (char)127};
-static char const QUOTE_294[] PROGMEM = {(char)156, (char)31, (char)42, (char)4, (char)117, (char)152, (char)19, (char)48, (char)6, (char)229, (char)155, (char)218, (char)89, (char)3, (char)199, (char)91, (char)39, (char)192};
-static char const QUOTE_295[] PROGMEM = {(char)216, (char)211, (char)64, (char)209, (char)47, (char)112, (char)28, (char)82, (char)144, (char)164, (char)248};
-static char const QUOTE_296[] PROGMEM = {(char)65, (char)104, (char)4, (char)186, (char)133, (char)147, (char)139, (char)64, (char)32, (char)165, (char)53, (char)0, (char)22, (char)81, (char)42, (char)32, (char)14, (char)86, (char)37, (char)75, (char)248};
-static char const QUOTE_297[] PROGMEM = {(char)34, (char)74, (char)11, (char)22, (char)86, (char)43, (char)10, (char)226, (char)20, (char)12, (char)11, (char)143, (char)160, (char)180, (char)160, (char)105, (char)93, (char)50, (char)184, (char)15, (char)122, (char)254};
-static char const QUOTE_298[] PROGMEM = {(char)216, (char)100, (char)116, (char)120, (char)132, (char)28, (char)59, (char)66, (char)150, (char)1, (char)165, (char)116, (char)202, (char)239, (char)23, (char)1, (char)43, (char)2, (char)30, (char)83, (char)1, (char)69, (char)3, (char)66, (char)150, (char)1, (char)161, (char)12, (char)129, (char)227, (char)16, (char)44, (char)165, (char)144, (char)8, (char)23, (char)44, (char)10, (char)40, (char)45, (char)36, (char)149, (char)196, (char)43, (char)18, (char)165, (char)131, (char)197, (char)190, (char)95, (char)241, (char)111, (char)192};
-static char const QUOTE_299[] PROGMEM = {(char)59, (char)66, (char)150, (char)1, (char)51, (char)2, (char)11, (char)64, (char)57, (char)37, (char)173, (char)202, (char)4, (char)62, (char)141, (char)10, (char)88, (char)10, (char)20, (char)229, (char)117, (char)222, (char)249, (char)17, (char)39, (char)248};
-static char const QUOTE_300[] PROGMEM = {(char)93, (char)105, (char)226, (char)192, (char)33, (char)229, (char)1, (char)228, (char)250, (char)195, (char)197, (char)178, (char)44, (char)25, (char)144, (char)40, (char)160, (char)75, (char)128, (char)218, (char)210, (char)158, (char)63, (char)248};
-static char const QUOTE_301[] PROGMEM = {(char)109, (char)105, (char)64, (char)38, (char)96, (char)177, (char)74, (char)192, (char)8, (char)180, (char)44, (char)188, (char)88, (char)11, (char)133, (char)212, (char)2, (char)138, (char)5, (char)213, (char)212, (char)5, (char)0, (char)55, (char)184, (char)201, (char)57, (char)202, (char)239, (char)23, (char)1, (char)201, (char)45, (char)0, (char)64, (char)208, (char)9, (char)88, (char)8, (char)26, (char)1, (char)5, (char)16, (char)14, (char)82, (char)4, (char)46, (char)241, (char)112, (char)28, (char)146, (char)208, (char)4, (char)13, (char)0, (char)66, (char)128, (char)133, (char)48, (char)106, (char)202, (char)76, (char)5, (char)26, (char)40, (char)8, (char)72, (char)180, (char)162, (char)78, (char)13, (char)37, (char)78, (char)3, (char)205, (char)167, (char)248, (char)184, (char)13, (char)8, (char)100, (char)6, (char)214, (char)148, (char)2, (char)102, (char)11, (char)20, (char)172, (char)0, (char)139, (char)66, (char)203, (char)196, (char)63};
-static char const QUOTE_302[] PROGMEM = {(char)218, (char)146, (char)160, (char)81, (char)15, (char)104, (char)103, (char)240};
-static char const QUOTE_303[] PROGMEM = {(char)104, (char)86, (char)178, (char)177, (char)42, (char)88, (char)60, (char)67, (char)227, (char)208, (char)92, (char)169, (char)114, (char)78, (char)11, (char)150, (char)75, (char)248};
-static char const QUOTE_304[] PROGMEM = {(char)65, (char)68, (char)0, (char)176, (char)13, (char)45, (char)0, (char)208, (char)202, (char)137, (char)113, (char)64, (char)19, (char)28, (char)179, (char)132, (char)158, (char)178, (char)187, (char)224};
-static char const QUOTE_305[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)8, (char)45, (char)0, (char)146, (char)20, (char)160, (char)32, (char)104, (char)6, (char)184, (char)19, (char)26, (char)30, (char)87, (char)81, (char)69, (char)152, (char)46, (char)84, (char)185, (char)39, (char)1, (char)228, (char)152, (char)1, (char)5, (char)16, (char)138, (char)239, (char)22, (char)1, (char)161, (char)12, (char)128, (char)64, (char)208, (char)11, (char)11, (char)128, (char)84, (char)156, (char)174, (char)98, (char)84, (char)176, (char)57, (char)37, (char)160, (char)2, (char)201, (char)129, (char)43, (char)1, (char)100, (char)7, (char)216, (char)178, (char)3, (char)130, (char)66, (char)185, (char)126, (char)46, (char)1, (char)43, (char)48, (char)16, (char)52, (char)2, (char)102, (char)6, (char)148, (char)178, (char)1, (char)3, (char)64, (char)37, (char)96, (char)208, (char)104, (char)10, (char)20, (char)16, (char)149, (char)105, (char)50, (char)187, (char)224};
-static char const QUOTE_306[] PROGMEM = {(char)65, (char)104, (char)4, (char)204, (char)20, (char)74, (char)136, (char)7, (char)180, (char)20, (char)40, (char)12, (char)82, (char)206, (char)133, (char)119, (char)136, (char)65, (char)227, (char)173, (char)144, (char)30, (char)58, (char)39, (char)192};
-static char const QUOTE_307[] PROGMEM = {(char)131, (char)18, (char)229, (char)230, (char)12, (char)75, (char)151, (char)152, (char)49, (char)233, (char)114, (char)224, (char)199, (char)165, (char)203, (char)241, (char)119, (char)139, (char)188, (char)92, (char)2, (char)5, (char)173, (char)106, (char)105, (char)226, (char)192, (char)58, (char)160, (char)65, (char)68, (char)4, (char)172, (char)4, (char)13, (char)1, (char)114, (char)150, (char)64, (char)75, (char)128, (char)215, (char)1, (char)15, (char)121, (char)137, (char)240};
-static char const QUOTE_308[] PROGMEM = {(char)106, (char)84, (char)224, (char)78, (char)143, (char)54, (char)170, (char)147, (char)150, (char)64, (char)210, (char)75, (char)64, (char)22, (char)85, (char)77, (char)0, (char)22, (char)76, (char)5, (char)43, (char)128, (char)183, (char)152, (char)201, (char)46, (char)139, (char)64, (char)194, (char)1, (char)144, (char)67, (char)79, (char)128};
-static char const QUOTE_309[] PROGMEM = {(char)20, (char)130, (char)226, (char)120, (char)184, (char)10, (char)15, (char)139, (char)0, (char)151, (char)0, (char)133, (char)209, (char)64, (char)102, (char)6, (char)128, (char)187, (char)220, (char)87, (char)0, (char)44, (char)97, (char)74, (char)224, (char)36, (char)137, (char)125, (char)10, (char)239, (char)128};
-static char const QUOTE_310[] PROGMEM = {(char)33, (char)65, (char)15, (char)25, (char)220, (char)19, (char)44, (char)172, (char)89, (char)1, (char)51, (char)3, (char)158, (char)112, (char)57, (char)37, (char)160, (char)2, (char)99, (char)148, (char)201, (char)93, (char)1, (char)227, (char)191, (char)20, (char)128, (char)129, (char)112, (char)52, (char)22, (char)1, (char)169, (char)83, (char)128, (char)176, (char)180, (char)178, (char)1, (char)100, (char)7, (char)189, (char)96, (char)115, (char)206, (char)11, (char)149, (char)128, (char)157, (char)2, (char)23, (char)3, (char)199, (char)222, (char)59, (char)241, (char)79, (char)192};
-static char const QUOTE_311[] PROGMEM = {(char)33, (char)64, (char)102, (char)6, (char)128, (char)65, (char)74, (char)106, (char)0, (char)44, (char)3, (char)2, (char)227, (char)129, (char)201, (char)45, (char)0, (char)114, (char)138, (char)65, (char)113, (char)0, (char)84, (char)156, (char)174, (char)98, (char)84, (char)191, (char)128};
-static char const QUOTE_312[] PROGMEM = {(char)11, (char)38, (char)2, (char)20, (char)6, (char)96, (char)104, (char)4, (char)184, (char)2, (char)144, (char)92, (char)64, (char)78, (char)129, (char)13, (char)1, (char)162, (char)158, (char)128, (char)80, (char)92, (char)88, (char)65, (char)224, (char)65, (char)104, (char)11, (char)149, (char)159};
-static char const QUOTE_313[] PROGMEM = {(char)8, (char)209, (char)226, (char)192, (char)105, (char)224, (char)155, (char)138, (char)192, (char)10, (char)65, (char)113, (char)0, (char)66, (char)128, (char)204, (char)13, (char)0, (char)228, (char)150, (char)128, (char)9, (char)129, (char)71, (char)141, (char)30, (char)63, (char)248};
-static char const QUOTE_314[] PROGMEM = {(char)123, (char)64, (char)130, (char)149, (char)128, (char)41, (char)100, (char)196, (char)169, (char)96, (char)161, (char)65, (char)162, (char)156, (char)229, (char)112, (char)26, (char)16, (char)172, (char)9, (char)88, (char)26, (char)80, (char)57, (char)37, (char)160, (char)9, (char)42, (char)172, (char)15, (char)104, (char)10, (char)87, (char)0, (char)82, (char)11, (char)136, (char)8, (char)22, (char)64, (char)80, (char)67, (char)47, (char)128};
-static char const QUOTE_315[] PROGMEM = {(char)12, (char)106, (char)31, (char)16, (char)129, (char)51, (char)2, (char)11, (char)64, (char)57, (char)37, (char)173, (char)202, (char)0, (char)176, (char)85, (char)104, (char)2, (char)192, (char)85, (char)52, (char)241, (char)255, (char)192};
-static char const QUOTE_316[] PROGMEM = {(char)40, (char)209, (char)79, (char)22, (char)0, (char)165, (char)112, (char)24, (char)21, (char)149, (char)218, (char)10, (char)192, (char)153, (char)131, (char)79, (char)5, (char)138, (char)86, (char)1, (char)1, (char)113, (char)18, (char)114, (char)200, (char)4, (char)11, (char)128, (char)82, (char)184, (char)19, (char)96, (char)67, (char)13, (char)5, (char)127};
-static char const QUOTE_317[] PROGMEM = {(char)74, (char)193, (char)55, (char)6, (char)0, (char)114, (char)75, (char)64, (char)16, (char)52, (char)3, (char)74, (char)233, (char)149, (char)192, (char)114, (char)75, (char)64, (char)28, (char)183, (char)123, (char)220, (char)2, (char)149, (char)192, (char)96, (char)86, (char)87, (char)104, (char)43, (char)1, (char)202, (char)41, (char)85, (char)43, (char)43, (char)190};
-static char const QUOTE_318[] PROGMEM = {(char)106, (char)84, (char)224, (char)78, (char)143, (char)54, (char)170, (char)147, (char)150, (char)64, (char)65, (char)74, (char)106, (char)0, (char)165, (char)112, (char)16, (char)23, (char)17, (char)39, (char)40, (char)36, (char)86, (char)190, (char)133, (char)0, (char)146, (char)160, (char)16, (char)160, (char)155, (char)2, (char)227, (char)131, (char)199, (char)91, (char)39, (char)192};
-static char const QUOTE_319[] PROGMEM = {(char)106, (char)84, (char)224, (char)78, (char)143, (char)54, (char)170, (char)147, (char)150, (char)64, (char)76, (char)192, (char)128, (char)184, (char)137, (char)57, (char)100, (char)2, (char)5, (char)192, (char)34, (char)74, (char)11, (char)5, (char)192, (char)83, (char)235, (char)240};
-static char const QUOTE_320[] PROGMEM = {(char)74, (char)192, (char)34, (char)184, (char)5, (char)26, (char)40, (char)1, (char)49, (char)42, (char)3, (char)75, (char)64, (char)53, (char)192, (char)157, (char)30, (char)109, (char)85, (char)39, (char)44, (char)190};
-static char const QUOTE_321[] PROGMEM = {(char)106, (char)84, (char)224, (char)78, (char)143, (char)54, (char)170, (char)147, (char)150, (char)64, (char)65, (char)74, (char)106, (char)0, (char)165, (char)112, (char)4, (char)247, (char)211, (char)197, (char)181, (char)128, (char)14, (char)86, (char)85, (char)36, (char)81, (char)126};
-static char const QUOTE_322[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)4, (char)40, (char)26, (char)151, (char)78, (char)128, (char)177, (char)100, (char)215, (char)149, (char)37, (char)113, (char)10, (char)9, (char)209, (char)230, (char)213, (char)82, (char)114, (char)203, (char)197, (char)192, (char)81, (char)64, (char)135, (char)148, (char)212, (char)3, (char)64, (char)228, (char)150, (char)128, (char)41, (char)93, (char)48, (char)76, (char)104, (char)123, (char)220, (char)10, (char)20, (char)13, (char)10, (char)202, (char)224, (char)60, (char)218, (char)127, (char)139, (char)1, (char)167, (char)133, (char)147, (char)4, (char)222, (char)214, (char)164, (char)229, (char)6, (char)130, (char)182, (char)63, (char)69, (char)4, (char)232, (char)243, (char)106, (char)169, (char)57, (char)101, (char)63, (char)128};
-static char const QUOTE_323[] PROGMEM = {(char)74, (char)192, (char)176, (char)184, (char)14, (char)121, (char)192, (char)228, (char)150, (char)128, (char)155, (char)3, (char)2, (char)187, (char)197, (char)128, (char)184, (char)93, (char)64, (char)22, (char)64, (char)98, (char)79, (char)64, (char)5, (char)140, (char)43, (char)66, (char)22, (char)2, (char)225, (char)152, (char)31, (char)0, (char)55, (char)196, (char)238, (char)0, (char)138, (char)79, (char)128};
-static char const QUOTE_324[] PROGMEM = {(char)176, (char)86, (char)23, (char)81, (char)37, (char)2, (char)102, (char)11, (char)61, (char)242, (char)0, (char)171, (char)69, (char)22, (char)126, (char)44, (char)3, (char)138, (char)86, (char)128, (char)129, (char)160, (char)44, (char)23, (char)1, (char)165, (char)0, (char)66, (char)239, (char)128};
-static char const QUOTE_325[] PROGMEM = {(char)9, (char)167, (char)74, (char)144, (char)178, (char)43, (char)188, (char)88, (char)9, (char)194, (char)69, (char)42, (char)192, (char)210, (char)128, (char)178, (char)3, (char)146, (char)90, (char)2, (char)193, (char)119, (char)192};
-static char const QUOTE_326[] PROGMEM = {(char)74, (char)193, (char)160, (char)208, (char)13, (char)40, (char)46, (char)82, (char)200, (char)20, (char)40, (char)11, (char)35, (char)150, (char)69, (char)112, (char)8, (char)26, (char)1, (char)43, (char)5, (char)130, (char)226, (char)4, (char)39, (char)5, (char)202, (char)89, (char)0, (char)165, (char)112, (char)8, (char)19, (char)129, (char)5, (char)16, (char)44, (char)89, (char)56, (char)181, (char)93, (char)1, (char)66, (char)202, (char)233, (char)83, (char)0, (char)149, (char)129, (char)175, (char)45, (char)0, (char)34, (char)157, (char)46, (char)113, (char)92, (char)6, (char)150, (char)128, (char)9, (char)167, (char)74, (char)144, (char)178, (char)43, (char)190};
-static char const QUOTE_327[] PROGMEM = {(char)107, (char)228, (char)114, (char)184, (char)7, (char)8, (char)18, (char)176, (char)20, (char)104, (char)160, (char)2, (char)23, (char)0, (char)133, (char)4, (char)216, (char)19, (char)248, (char)184, (char)9, (char)88, (char)52, (char)90, (char)0, (char)133, (char)5, (char)202, (char)181, (char)150, (char)64, (char)123, (char)65, (char)227, (char)96, (char)86, (char)178, (char)248};
-static char const QUOTE_328[] PROGMEM = {(char)74, (char)193, (char)116, (char)176, (char)4, (char)172, (char)192, (char)19, (char)78, (char)149, (char)33, (char)100, (char)87, (char)0, (char)137, (char)160, (char)20, (char)16, (char)203, (char)224};
-static char const QUOTE_329[] PROGMEM = {(char)122, (char)0, (char)208, (char)184, (char)30, (char)45, (char)242, (char)255, (char)139, (char)124, (char)119, (char)227, (char)191, (char)128};
-static char const QUOTE_330[] PROGMEM = {(char)74, (char)192, (char)128, (char)144, (char)1, (char)115, (char)138, (char)212, (char)149, (char)101, (char)0, (char)146, (char)167, (char)4, (char)22, (char)44, (char)154, (char)247, (char)200, (char)128, (char)105, (char)104, (char)6, (char)184, (char)7, (char)45, (char)210, (char)52, (char)83, (char)224};
-static char const QUOTE_331[] PROGMEM = {(char)57, (char)74, (char)224, (char)81, (char)42, (char)32, (char)30, (char)208, (char)80, (char)160, (char)91, (char)214, (char)87, (char)120, (char)252, (char)16, (char)78, (char)180, (char)16, (char)45, (char)243, (char)160, (char)14, (char)82, (char)184, (char)20, (char)74, (char)137, (char)240};
-static char const QUOTE_332[] PROGMEM = {(char)35, (char)234, (char)52, (char)22, (char)137, (char)81, (char)60, (char)126, (char)0, (char)160, (char)4, (char)172, (char)192, (char)64, (char)208, (char)23, (char)12, (char)192, (char)68, (char)148, (char)19, (char)160, (char)92, (char)191, (char)128};
-static char const QUOTE_333[] PROGMEM = {(char)221, (char)202, (char)90, (char)1, (char)69, (char)5, (char)210, (char)80, (char)61, (char)235, (char)0, (char)76, (char)128, (char)133, (char)116, (char)47, (char)143, (char)254};
-static char const QUOTE_334[] PROGMEM = {(char)122, (char)0, (char)119, (char)146, (char)197, (char)144, (char)8, (char)26, (char)1, (char)175, (char)44, (char)232, (char)4, (char)172, (char)14, (char)121, (char)192, (char)71, (char)149, (char)222, (char)44, (char)1, (char)10, (char)11, (char)134, (char)96, (char)18, (char)92, (char)226, (char)185, (char)1, (char)97, (char)92, (char)15, (char)22, (char)248, (char)187, (char)197, (char)190, (char)59, (char)241, (char)216, (char)16, (char)90, (char)2, (char)69, (char)57, (char)93, (char)64, (char)57, (char)37, (char)160, (char)16, (char)247, (char)192, (char)9, (char)88, (char)60, (char)117, (char)226, (char)255, (char)128};
-static char const QUOTE_335[] PROGMEM = {(char)91, (char)10, (char)151, (char)20, (char)13, (char)121, (char)209, (char)86, (char)120, (char)255, (char)224};
-static char const QUOTE_336[] PROGMEM = {(char)34, (char)74, (char)2, (char)184, (char)160, (char)89, (char)75, (char)32, (char)37, (char)192, (char)162, (char)2, (char)150, (char)5, (char)196, (char)3, (char)222, (char)191, (char)22, (char)1, (char)165, (char)160, (char)8, (char)146, (char)128, (char)117, (char)148, (char)178, (char)2, (char)36, (char)160, (char)211, (char)192, (char)130, (char)150, (char)128, (char)184, (char)102, (char)2, (char)6, (char)128, (char)160, (char)28, (char)146, (char)208, (char)15, (char)128, (char)8, (char)80, (char)44, (char)33, (char)149, (char)1, (char)58, (char)61, (char)196, (char)248};
-static char const QUOTE_337[] PROGMEM = {(char)74, (char)193, (char)116, (char)176, (char)5, (char)73, (char)202, (char)230, (char)37, (char)75, (char)6, (char)138, (char)195, (char)0, (char)117, (char)148, (char)146, (char)89, (char)128, (char)225, (char)11, (char)128, (char)208, (char)172, (char)174, (char)248};
-static char const QUOTE_338[] PROGMEM = {(char)75, (char)129, (char)68, (char)5, (char)44, (char)11, (char)136, (char)11, (char)73, (char)229, (char)57, (char)92, (char)13, (char)20, (char)15, (char)48, (char)18, (char)176, (char)52, (char)5, (char)26, (char)40, (char)11, (char)190, (char)190, (char)44, (char)3, (char)66, (char)25, (char)2, (char)128, (char)184, (char)102, (char)1, (char)22, (char)116, (char)5, (char)10, (char)2, (char)208, (char)174, (char)241, (char)112, (char)18, (char)82, (char)22, (char)69, (char)43, (char)129, (char)112, (char)204, (char)22, (char)45, (char)1, (char)98, (char)200, (char)65, (char)12, (char)200, (char)2, (char)6, (char)128, (char)41, (char)92, (char)11, (char)150, (char)116, (char)44, (char)152, (char)151, (char)28, (char)4, (char)13, (char)0, (char)16, (char)185, (char)111, (char)119, (char)192};
-static char const QUOTE_339[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)1, (char)96, (char)10, (char)87, (char)2, (char)239, (char)88, (char)10, (char)224, (char)20, (char)174, (char)2, (char)222, (char)245, (char)137, (char)229, (char)95, (char)139, (char)128, (char)234, (char)129, (char)207, (char)56, (char)26, (char)21, (char)149, (char)223};
-static char const QUOTE_340[] PROGMEM = {(char)64, (char)80, (char)31, (char)22, (char)1, (char)43, (char)1, (char)31, (char)119, (char)49, (char)225, (char)32, (char)29, (char)80, (char)52, (char)180, (char)7, (char)140, (char)124, (char)114, (char)11, (char)22, (char)66, (char)75, (char)136, (char)151, (char)28, (char)174, (char)5, (char)10, (char)114, (char)177, (char)42, (char)95, (char)139, (char)0, (char)149, (char)128, (char)69, (char)112, (char)10, (char)87, (char)0, (char)65, (char)157, (char)2, (char)25, (char)19, (char)224};
-static char const QUOTE_341[] PROGMEM = {(char)49, (char)75, (char)58, (char)21, (char)222, (char)33, (char)2, (char)41, (char)72, (char)120, (char)235, (char)197, (char)254, (char)47, (char)189, (char)239, (char)226, (char)236, (char)190, (char)180, (char)168, (char)139, (char)226, (char)225, (char)189, (char)190, (char)47, (char)184, (char)104, (char)52, (char)120, (char)254, (char)222, (char)61, (char)46, (char)239, (char)204, (char)35, (char)121, (char)224, (char)118, (char)94, (char)43, (char)106, (char)47, (char)141, (char)62};
-static char const QUOTE_342[] PROGMEM = {(char)176, (char)86, (char)23, (char)81, (char)37, (char)241, (char)248, (char)46, (char)86, (char)1, (char)69, (char)3, (char)2, (char)178, (char)187, (char)65, (char)88, (char)26, (char)82, (char)129, (char)5, (char)71, (char)192};
-static char const QUOTE_343[] PROGMEM = {(char)74, (char)192, (char)34, (char)184, (char)23, (char)43, (char)0, (char)114, (char)206, (char)133, (char)97, (char)0, (char)248, (char)1, (char)5, (char)160, (char)44, (char)249, (char)36, (char)229, (char)0, (char)139, (char)58, (char)86, (char)178, (char)5, (char)36, (char)250, (char)220, (char)174, (char)159, (char)192};
-static char const QUOTE_344[] PROGMEM = {(char)113, (char)74, (char)3, (char)148, (char)174, (char)4, (char)220, (char)17, (char)175, (char)197, (char)128, (char)74, (char)192, (char)215, (char)150, (char)128, (char)98, (char)70, (char)138, (char)22, (char)64, (char)187, (char)228, (char)66, (char)184, (char)4, (char)11, (char)129, (char)68, (char)61, (char)161, (char)159, (char)192};
-static char const QUOTE_345[] PROGMEM = {(char)105, (char)75, (char)32, (char)76, (char)104, (char)44, (char)154, (char)87, (char)1, (char)51, (char)0, (char)139, (char)66, (char)203, (char)197, (char)192, (char)153, (char)100, (char)146, (char)214, (char)126, (char)44, (char)2, (char)138, (char)4, (char)20, (char)84, (char)6, (char)138, (char)13, (char)60, (char)22, (char)123, (char)60, (char)92, (char)15, (char)24, (char)130, (char)99, (char)65, (char)100, (char)208, (char)120, (char)244, (char)2, (char)147, (char)239, (char)50, (char)203, (char)197, (char)128, (char)241, (char)136, (char)38, (char)52, (char)22, (char)77, (char)7, (char)143, (char)65, (char)114, (char)201, (char)127};
-static char const QUOTE_346[] PROGMEM = {(char)97, (char)86, (char)178, (char)128, (char)65, (char)113, (char)60, (char)126, (char)2, (char)5, (char)192, (char)56, (char)64, (char)162, (char)130, (char)143, (char)26, (char)1, (char)58, (char)22, (char)16, (char)43, (char)188, (char)127, (char)240};
-static char const QUOTE_347[] PROGMEM = {(char)104, (char)101, (char)68, (char)185, (char)52, (char)124, (char)138, (char)239, (char)31, (char)128, (char)137, (char)40, (char)19, (char)48, (char)88, (char)178, (char)157, (char)31, (char)10, (char)124};
-static char const QUOTE_348[] PROGMEM = {(char)74, (char)192, (char)185, (char)37, (char)71, (char)5, (char)130, (char)224, (char)17, (char)52, (char)5, (char)202, (char)89, (char)3, (char)73, (char)112, (char)18, (char)224, (char)9, (char)245, (char)97, (char)11, (char)34, (char)184, (char)30, (char)58, (char)220, (char)62};
-static char const QUOTE_349[] PROGMEM = {(char)91, (char)18, (char)214, (char)149, (char)222, (char)63, (char)3, (char)82, (char)167, (char)1, (char)1, (char)113, (char)10, (char)224, (char)17, (char)229, (char)112, (char)10, (char)52, (char)80, (char)15, (char)177, (char)100, (char)22, (char)1, (char)207, (char)56, (char)32, (char)149, (char)56, (char)20, (char)67, (char)234, (char)116, (char)3, (char)199, (char)91, (char)135, (char)192};
-static char const QUOTE_350[] PROGMEM = {(char)64, (char)103, (char)34, (char)211, (char)197, (char)128, (char)11, (char)40, (char)149, (char)19, (char)196, (char)63};
-static char const QUOTE_351[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)1, (char)96, (char)38, (char)151, (char)18, (char)96, (char)162, (char)84, (char)66, (char)184, (char)4, (char)40, (char)38, (char)22, (char)206, (char)174, (char)63, (char)139, (char)77, (char)39, (char)183, (char)197, (char)168, (char)43, (char)24, (char)11, (char)5, (char)192, (char)104, (char)100, (char)196, (char)150, (char)127};
-static char const QUOTE_352[] PROGMEM = {(char)74, (char)192, (char)130, (char)136, (char)7, (char)76, (char)232, (char)89, (char)21, (char)192, (char)11, (char)0, (char)82, (char)184, (char)1, (char)105, (char)100, (char)145, (char)133, (char)192, (char)27, (char)222, (char)180, (char)148, (char)7, (char)42, (char)2, (char)64, (char)120, (char)235, (char)112, (char)248};
-static char const QUOTE_353[] PROGMEM = {(char)145, (char)90, (char)183, (char)248, (char)181, (char)165, (char)167, (char)139, (char)80, (char)90, (char)120, (char)182, (char)5, (char)162, (char)138, (char)4, (char)204, (char)15, (char)122, (char)192, (char)22, (char)48, (char)46, (char)56, (char)2, (char)99, (char)150, (char)116, (char)169, (char)10, (char)89, (char)19, (char)224};
-static char const QUOTE_354[] PROGMEM = {(char)162, (char)130, (char)25, (char)19, (char)197, (char)128, (char)33, (char)64, (char)208, (char)184, (char)4, (char)73, (char)64, (char)153, (char)128, (char)38, (char)57, (char)103, (char)74, (char)144, (char)165, (char)145, (char)0, (char)248, (char)0, (char)165, (char)112, (char)11, (char)129, (char)149, (char)144, (char)101, (char)78, (char)151, (char)124};
-static char const QUOTE_355[] PROGMEM = {(char)74, (char)192, (char)128, (char)134, (char)128, (char)160, (char)2, (char)201, (char)129, (char)43, (char)1, (char)202, (char)87, (char)1, (char)238, (char)160, (char)146, (char)170, (char)1, (char)46, (char)2, (char)42, (char)153, (char)129, (char)5, (char)23, (char)139, (char)1, (char)64, (char)38, (char)96, (char)113, (char)105, (char)71, (char)129, (char)239, (char)88, (char)10, (char)87, (char)2, (char)197, (char)148, (char)216, (char)24, (char)21, (char)214, (char)44, (char)137, (char)81, (char)8, (char)172, (char)8, (char)101, (char)240};
-static char const QUOTE_356[] PROGMEM = {(char)33, (char)65, (char)98, (char)201, (char)197, (char)170, (char)232, (char)80, (char)17, (char)43, (char)89, (char)64, (char)87, (char)0, (char)133, (char)3, (char)138, (char)114, (char)203, (char)197, (char)128, (char)65, (char)68, (char)34, (char)184, (char)26, (char)40, (char)8, (char)146, (char)130, (char)146, (char)9, (char)19, (char)68, (char)148, (char)14, (char)121, (char)193, (char)58, (char)20, (char)164, (char)159, (char)143, (char)254};
-static char const QUOTE_357[] PROGMEM = {(char)34, (char)88, (char)196, (char)184, (char)229, (char)144, (char)46, (char)89, (char)46, (char)128, (char)17, (char)104, (char)89, (char)0, (char)129, (char)112, (char)22, (char)243, (char)25, (char)37, (char)7, (char)142, (char)252, (char)83, (char)240};
-static char const QUOTE_358[] PROGMEM = {(char)218, (char)235, (char)65, (char)61, (char)242, (char)248};
-static char const QUOTE_359[] PROGMEM = {(char)49, (char)75, (char)58, (char)21, (char)222, (char)33, (char)2, (char)41, (char)72, (char)120, (char)235, (char)197, (char)254, (char)47, (char)189, (char)239, (char)226, (char)236, (char)190, (char)180, (char)168, (char)139, (char)226, (char)225, (char)189, (char)190, (char)47, (char)184, (char)104, (char)52, (char)120, (char)254, (char)222, (char)61, (char)241, (char)111, (char)151, (char)246, (char)206, (char)5, (char)222, (char)57, (char)220, (char)205, (char)197, (char)217, (char)255};
-static char const QUOTE_360[] PROGMEM = {(char)74, (char)193, (char)55, (char)6, (char)0, (char)34, (char)74, (char)9, (char)6, (char)69, (char)3, (char)74, (char)233, (char)149, (char)192, (char)34, (char)74, (char)4, (char)85, (char)192, (char)128, (char)193, (char)226, (char)121, (char)129, (char)193, (char)26, (char)41, (char)48, (char)85, (char)52, (char)209, (char)105, (char)66, (char)184, (char)5, (char)26, (char)40, (char)7, (char)36, (char)180, (char)248};
-static char const QUOTE_361[] PROGMEM = {(char)210, (char)74, (char)191, (char)31, (char)128, (char)33, (char)116, (char)232, (char)86, (char)48, (char)178, (char)248};
-static char const QUOTE_362[] PROGMEM = {(char)162, (char)30, (char)208, (char)204, (char)9, (char)152, (char)2, (char)192, (char)120, (char)216, (char)10, (char)8, (char)100, (char)13, (char)36, (char)171, (char)248};
-static char const QUOTE_363[] PROGMEM = {(char)243, (char)240, (char)18, (char)176, (char)32, (char)162, (char)1, (char)74, (char)224, (char)64, (char)174, (char)76, (char)192, (char)87, (char)0, (char)137, (char)40, (char)24, (char)149, (char)46, (char)128, (char)124, (char)0, (char)130, (char)185, (char)201, (char)40, (char)17, (char)84, (char)205, (char)161, (char)119, (char)192};
-static char const QUOTE_364[] PROGMEM = {(char)41, (char)101, (char)58, (char)1, (char)207, (char)56, (char)12, (char)96, (char)20, (char)174, (char)0, (char)138, (char)25, (char)0, (char)242, (char)203, (char)25, (char)63, (char)128};
-static char const QUOTE_365[] PROGMEM = {(char)41, (char)101, (char)58, (char)1, (char)207, (char)56, (char)12, (char)96, (char)20, (char)174, (char)0, (char)124, (char)91, (char)66, (char)133, (char)191};
-static char const QUOTE_366[] PROGMEM = {(char)41, (char)101, (char)58, (char)1, (char)207, (char)56, (char)12, (char)96, (char)20, (char)174, (char)2, (char)211, (char)65, (char)160, (char)174, (char)3, (char)146, (char)116, (char)81, (char)161, (char)145, (char)126};
-static char const QUOTE_367[] PROGMEM = {(char)74, (char)193, (char)55, (char)6, (char)0, (char)106, (char)84, (char)224, (char)52, (char)39, (char)113, (char)105, (char)39, (char)184, (char)14, (char)73, (char)104, (char)15, (char)29, (char)120, (char)163, (char)224};
-static char const QUOTE_368[] PROGMEM = {(char)176, (char)92, (char)6, (char)134, (char)76, (char)73, (char)102, (char)6, (char)188, (char)180, (char)2, (char)86, (char)7, (char)84, (char)26, (char)41, (char)206, (char)87, (char)3, (char)196, (char)239, (char)64, (char)16, (char)90, (char)2, (char)193, (char)101, (char)1, (char)96, (char)206, (char)128, (char)185, (char)88, (char)6, (char)148, (char)190, (char)39, (char)248};
-static char const QUOTE_369[] PROGMEM = {(char)8, (char)209, (char)226, (char)192, (char)16, (char)52, (char)2, (char)10, (char)83, (char)80, (char)9, (char)41, (char)11, (char)34, (char)149, (char)192, (char)185, (char)88, (char)2, (char)149, (char)211, (char)248};
-static char const QUOTE_370[] PROGMEM = {(char)122, (char)0, (char)208, (char)187, (char)197, (char)128, (char)32, (char)104, (char)4, (char)204, (char)14, (char)73, (char)104, (char)7, (char)180, (char)7, (char)144, (char)96, (char)162, (char)204, (char)15, (char)177, (char)100, (char)10, (char)20, (char)13, (char)10, (char)202, (char)239, (char)128};
-static char const QUOTE_371[] PROGMEM = {(char)122, (char)0, (char)208, (char)187, (char)197, (char)128, (char)184, (char)67, (char)39, (char)180, (char)26, (char)41, (char)232, (char)10, (char)20, (char)229, (char)117, (char)222, (char)249, (char)17, (char)39, (char)2, (char)74, (char)66, (char)200, (char)165, (char)112, (char)30, (char)128, (char)52, (char)46, (char)241, (char)255, (char)192};
-static char const QUOTE_372[] PROGMEM = {(char)217, (char)56, (char)154, (char)1, (char)65, (char)12, (char)128, (char)112, (char)129, (char)43, (char)3, (char)18, (char)106, (char)21, (char)192, (char)105, (char)104, (char)13, (char)175, (char)137, (char)111, (char)139, (char)190};
-static char const QUOTE_373[] PROGMEM = {(char)241, (char)128, (char)2, (char)23, (char)52, (char)172, (char)34, (char)92, (char)114, (char)184, (char)22, (char)123, (char)228, (char)2, (char)20, (char)12, (char)73, (char)169, (char)114, (char)146, (char)116, (char)146, (char)84, (char)79, (char)128};
-static char const QUOTE_374[] PROGMEM = {(char)74, (char)193, (char)100, (char)184, (char)128, (char)41, (char)92, (char)4, (char)20, (char)172, (char)3, (char)94, (char)224, (char)209, (char)229, (char)162, (char)138, (char)10, (char)20, (char)23, (char)42, (char)92, (char)147, (char)130, (char)133, (char)57, (char)93, (char)119, (char)190, (char)68, (char)73, (char)254};
-static char const QUOTE_375[] PROGMEM = {(char)122, (char)252, (char)88, (char)11, (char)164, (char)160, (char)56, (char)66, (char)224, (char)22, (char)64, (char)11, (char)24, (char)86, (char)132, (char)44, (char)3, (char)74, (char)80, (char)56, (char)33, (char)144, (char)8, (char)80, (char)32, (char)51, (char)145, (char)105, (char)227, (char)255, (char)128};
-static char const QUOTE_376[] PROGMEM = {(char)213, (char)70, (char)138, (char)120, (char)176, (char)5, (char)112, (char)40, (char)242, (char)184, (char)22, (char)147, (char)202, (char)112, (char)53, (char)42, (char)112, (char)5, (char)39, (char)150, (char)84, (char)81, (char)64, (char)243, (char)1, (char)43, (char)2, (char)222, (char)208, (char)13, (char)1, (char)169, (char)140, (char)90, (char)200, (char)174, (char)1, (char)43, (char)48, (char)53, (char)229, (char)160, (char)18, (char)176, (char)57, (char)231, (char)3, (char)75, (char)64, (char)37, (char)211, (char)11, (char)147, (char)76, (char)128, (char)69, (char)58, (char)92, (char)226, (char)187, (char)197, (char)192, (char)122, (char)1, (char)114, (char)177, (char)128, (char)241, (char)214, (char)225, (char)240};
-static char const QUOTE_377[] PROGMEM = {(char)122, (char)0, (char)52, (char)37, (char)140, (char)241, (char)96, (char)30, (char)210, (char)6, (char)128, (char)74, (char)192, (char)66, (char)128, (char)184, (char)128, (char)92, (char)66, (char)144, (char)5, (char)34, (char)104, (char)146, (char)129, (char)5, (char)16, (char)26, (char)19, (char)129, (char)43, (char)3, (char)222, (char)176, (char)120, (char)207, (char)198, (char)0, (char)106, (char)93, (char)90, (char)21, (char)192, (char)8, (char)166, (char)2, (char)226, (char)146, (char)8, (char)8, (char)242, (char)187, (char)197, (char)128, (char)76, (char)44, (char)15, (char)25, (char)120, (char)192, (char)13, (char)75, (char)171, (char)66, (char)184, (char)5, (char)197, (char)36, (char)31, (char)128};
-static char const QUOTE_378[] PROGMEM = {(char)156, (char)18, (char)231, (char)21, (char)196, (char)40, (char)22, (char)26, (char)1, (char)240, (char)4, (char)198, (char)135, (char)190, (char)158, (char)44, (char)3, (char)158, (char)112, (char)28, (char)165, (char)112, (char)11, (char)66, (char)184, (char)7, (char)42, (char)2, (char)79, (char)22, (char)0, (char)174, (char)1, (char)202, (char)87, (char)3, (char)73, (char)112, (char)30, (char)208, (char)37, (char)211, (char)11, (char)147, (char)76, (char)130, (char)133, (char)1, (char)30, (char)87, (char)124};
-static char const QUOTE_379[] PROGMEM = {(char)34, (char)75, (char)34, (char)186, (char)149, (char)75, (char)128, (char)149, (char)8, (char)173, (char)15, (char)139, (char)0, (char)73, (char)36, (char)160, (char)105, (char)83, (char)53, (char)22, (char)96, (char)179, (char)223, (char)32, (char)80, (char)18, (char)8, (char)90, (char)7, (char)4, (char)50, (char)3, (char)106, (char)153, (char)128, (char)33, (char)112, (char)40, (char)5, (char)165, (char)75, (char)43, (char)188, (char)92, (char)7, (char)22, (char)128, (char)11, (char)38, (char)1, (char)37, (char)64, (char)33, (char)64, (char)71, (char)176, (char)201, (char)83, (char)138, (char)239, (char)22, (char)1, (char)1, (char)113, (char)1, (char)66, (char)156, (char)174, (char)5, (char)0, (char)118, (char)6, (char)126, (char)44, (char)3, (char)106, (char)153, (char)128, (char)178, (char)161, (char)78, (char)87, (char)4, (char)46, (char)248};
-static char const QUOTE_380[] PROGMEM = {(char)74, (char)192, (char)82, (char)208, (char)13, (char)74, (char)156, (char)3, (char)74, (char)169, (char)160, (char)2, (char)202, (char)37, (char)68, (char)0, (char)139, (char)105, (char)62, (char)69, (char)112, (char)31, (char)0, (char)20, (char)174, (char)4, (char)232, (char)245, (char)168, (char)191};
-static char const QUOTE_381[] PROGMEM = {(char)91, (char)204, (char)100, (char)148, (char)1, (char)100, (char)192, (char)247, (char)80, (char)73, (char)85, (char)0, (char)210, (char)208, (char)5, (char)43, (char)128, (char)182, (char)61, (char)212, (char)81, (char)64, (char)39, (char)208, (char)178, (char)1, (char)100, (char)151, (char)120, (char)184, (char)1, (char)185, (char)102, (char)246, (char)151, (char)224};
-static char const QUOTE_382[] PROGMEM = {(char)75, (char)128, (char)23, (char)16, (char)178, (char)3, (char)146, (char)90, (char)222, (char)126, (char)44, (char)2, (char)86, (char)4, (char)20, (char)64, (char)41, (char)92, (char)6, (char)132, (char)233, (char)24, (char)5, (char)86, (char)48, (char)180, (char)1, (char)202, (char)183, (char)141, (char)20, (char)248};
-static char const QUOTE_383[] PROGMEM = {(char)211, (char)220, (char)64, (char)156, (char)9, (char)112, (char)15, (char)39, (char)185, (char)46, (char)57, (char)92, (char)15, (char)31, (char)121, (char)127, (char)199, (char)128, (char)74, (char)192, (char)130, (char)136, (char)15, (char)128, (char)10, (char)87, (char)3, (char)79, (char)113, (char)2, (char)112, (char)66, (char)79, (char)17, (char)100, (char)87, (char)1, (char)111, (char)49, (char)146, (char)80, (char)80, (char)160, (char)36, (char)146, (char)229, (char)149, (char)192, (char)75, (char)128, (char)121, (char)61, (char)201, (char)113, (char)202, (char)239, (char)22, (char)1, (char)5, (char)160, (char)19, (char)48, (char)28, (char)172, (char)170, (char)192, (char)208, (char)134, (char)64, (char)105, (char)104, (char)11, (char)20, (char)172, (char)3, (char)94, (char)84, (char)208, (char)190, (char)46, (char)2, (char)11, (char)64, (char)12, (char)38, (char)40, (char)46, (char)25, (char)129, (char)239, (char)88, (char)28, (char)146, (char)208, (char)15, (char)129, (char)92, (char)6, (char)132, (char)50, (char)1, (char)10, (char)2, (char)164, (char)229, (char)112, (char)100, (char)87, (char)2, (char)225, (char)145, (char)92, (char)7, (char)22, (char)128, (char)161, (char)101, (char)83, (char)130, (char)193, (char)112, (char)8, (char)80, (char)44, (char)178, (char)95, (char)139, (char)0, (char)87, (char)2, (char)229, (char)3, (char)94, (char)52, (char)80, (char)174, (char)5, (char)202, (char)192, (char)22, (char)197, (char)112, (char)22, (char)243, (char)25, (char)37, (char)2, (char)222, (char)210, (char)184, (char)4, (char)146, (char)92, (char)178, (char)187, (char)224};
-static char const QUOTE_384[] PROGMEM = {(char)154, (char)195, (char)66, (char)184, (char)9, (char)152, (char)4, (char)89, (char)208, (char)19, (char)75, (char)96, (char)86, (char)120, (char)176, (char)1, (char)99, (char)10, (char)87, (char)1, (char)5, (char)160, (char)36, (char)86, (char)180, (char)174, (char)2, (char)102, (char)6, (char)6, (char)116, (char)73, (char)254};
-static char const QUOTE_385[] PROGMEM = {(char)210, (char)74, (char)191, (char)31, (char)128, (char)165, (char)112, (char)14, (char)242, (char)144, (char)160, (char)145, (char)72, (char)87, (char)1, (char)237, (char)3, (char)224, (char)2, (char)20, (char)2, (char)11, (char)150, (char)7, (char)212, (char)133, (char)4, (char)224, (char)146, (char)22, (char)77, (char)11, (char)129, (char)66, (char)172, (char)174, (char)50, (char)88, (char)217, (char)130, (char)133, (char)2, (char)210, (char)165, (char)149, (char)223};
-static char const QUOTE_386[] PROGMEM = {(char)216, (char)184, (char)250, (char)76, (char)9, (char)152, (char)46, (char)86, (char)0, (char)104, (char)75, (char)25, (char)226, (char)224, (char)109, (char)28, (char)45, (char)1, (char)73, (char)84, (char)106, (char)40, (char)19, (char)48, (char)16, (char)52, (char)2, (char)138, (char)2, (char)201, (char)165, (char)40, (char)4, (char)83, (char)165, (char)212, (char)241, (char)96, (char)10, (char)224, (char)16, (char)46, (char)3, (char)146, (char)90, (char)1, (char)240, (char)67, (char)234, (char)74, (char)2, (char)207, (char)124, (char)129, (char)64, (char)62, (char)197, (char)144, (char)19, (char)63, (char)23, (char)124};
-
-char const *const QUOTES[] PROGMEM = { QUOTE_0, QUOTE_1, QUOTE_2, QUOTE_3, QUOTE_4, QUOTE_5, QUOTE_6, QUOTE_7, QUOTE_8, QUOTE_9, QUOTE_10, QUOTE_11, QUOTE_12, QUOTE_13, QUOTE_14, QUOTE_15, QUOTE_16, QUOTE_17, QUOTE_18, QUOTE_19, QUOTE_20, QUOTE_21, QUOTE_22, QUOTE_23, QUOTE_24, QUOTE_25, QUOTE_26, QUOTE_27, QUOTE_28, QUOTE_29, QUOTE_30, QUOTE_31, QUOTE_32, QUOTE_33, QUOTE_34, QUOTE_35, QUOTE_36, QUOTE_37, QUOTE_38, QUOTE_39, QUOTE_40, QUOTE_41, QUOTE_42, QUOTE_43, QUOTE_44, QUOTE_45, QUOTE_46, QUOTE_47, QUOTE_48, QUOTE_49, QUOTE_50, QUOTE_51, QUOTE_52, QUOTE_53, QUOTE_54, QUOTE_55, QUOTE_56, QUOTE_57, QUOTE_58, QUOTE_59, QUOTE_60, QUOTE_61, QUOTE_62, QUOTE_63, QUOTE_64, QUOTE_65, QUOTE_66, QUOTE_67, QUOTE_68, QUOTE_69, QUOTE_70, QUOTE_71, QUOTE_72, QUOTE_73, QUOTE_74, QUOTE_75, QUOTE_76, QUOTE_77, QUOTE_78, QUOTE_79, QUOTE_80, QUOTE_81, QUOTE_82, QUOTE_83, QUOTE_84, QUOTE_85, QUOTE_86, QUOTE_87, QUOTE_88, QUOTE_89, QUOTE_90, QUOTE_91, QUOTE_92, QUOTE_93, QUOTE_94, QUOTE_95, QUOTE_96, QUOTE_97, QUOTE_98, QUOTE_99, QUOTE_100, QUOTE_101, QUOTE_102, QUOTE_103, QUOTE_104, QUOTE_105, QUOTE_106, QUOTE_107, QUOTE_108, QUOTE_109, QUOTE_110, QUOTE_111, QUOTE_112, QUOTE_113, QUOTE_114, QUOTE_115, QUOTE_116, QUOTE_117, QUOTE_118, QUOTE_119, QUOTE_120, QUOTE_121, QUOTE_122, QUOTE_123, QUOTE_124, QUOTE_125, QUOTE_126, QUOTE_127, QUOTE_128, QUOTE_129, QUOTE_130, QUOTE_131, QUOTE_132, QUOTE_133, QUOTE_134, QUOTE_135, QUOTE_136, QUOTE_137, QUOTE_138, QUOTE_139, QUOTE_140, QUOTE_141, QUOTE_142, QUOTE_143, QUOTE_144, QUOTE_145, QUOTE_146, QUOTE_147, QUOTE_148, QUOTE_149, QUOTE_150, QUOTE_151, QUOTE_152, QUOTE_153, QUOTE_154, QUOTE_155, QUOTE_156, QUOTE_157, QUOTE_158, QUOTE_159, QUOTE_160, QUOTE_161, QUOTE_162, QUOTE_163, QUOTE_164, QUOTE_165, QUOTE_166, QUOTE_167, QUOTE_168, QUOTE_169, QUOTE_170, QUOTE_171, QUOTE_172, QUOTE_173, QUOTE_174, QUOTE_175, QUOTE_176, QUOTE_177, QUOTE_178, QUOTE_179, QUOTE_180, QUOTE_181, QUOTE_182, QUOTE_183, QUOTE_184, QUOTE_185, QUOTE_186, QUOTE_187, QUOTE_188, QUOTE_189, QUOTE_190, QUOTE_191, QUOTE_192, QUOTE_193, QUOTE_194, QUOTE_195, QUOTE_196, QUOTE_197, QUOTE_198, QUOTE_199, QUOTE_200, QUOTE_201, QUOTE_202, QUOTE_203, QUOTE_204, QUOTE_205, QUOTE_206, QUOTE_207, QUOTE_208, QUOTE_209, QUOTE_210, QUOTE_211, QUOTE_212, QUOTE_213, QUOTE_214, QUOTE_215, QUOTE_216, QUOTE_217, QUOTE_218, QUOTE_219, QUOTE_220, QUOTE_221, QUOTE_222, QUOTE_223, QUOTE_224, QUOTE_225, QUOTE_226, QUOTE_227, QUOTE_228, QUOTE_229, QUOTE_230, QUOTE_231, QUOTE_232, QUOTE_233, QUOTE_234, QUOTE_235, QUOTE_236, QUOTE_237, QUOTE_238, QUOTE_239, QUOTE_240, QUOTE_241, QUOTE_242, QUOTE_243, QUOTE_244, QUOTE_245, QUOTE_246, QUOTE_247, QUOTE_248, QUOTE_249, QUOTE_250, QUOTE_251, QUOTE_252, QUOTE_253, QUOTE_254, QUOTE_255, QUOTE_256, QUOTE_257, QUOTE_258, QUOTE_259, QUOTE_260, QUOTE_261, QUOTE_262, QUOTE_263, QUOTE_264, QUOTE_265, QUOTE_266, QUOTE_267, QUOTE_268, QUOTE_269, QUOTE_270, QUOTE_271, QUOTE_272, QUOTE_273, QUOTE_274, QUOTE_275, QUOTE_276, QUOTE_277, QUOTE_278, QUOTE_279, QUOTE_280, QUOTE_281, QUOTE_282, QUOTE_283, QUOTE_284, QUOTE_285, QUOTE_286, QUOTE_287, QUOTE_288, QUOTE_289, QUOTE_290, QUOTE_291, QUOTE_292, QUOTE_293, QUOTE_294, QUOTE_295, QUOTE_296, QUOTE_297, QUOTE_298, QUOTE_299, QUOTE_300, QUOTE_301, QUOTE_302, QUOTE_303, QUOTE_304, QUOTE_305, QUOTE_306, QUOTE_307, QUOTE_308, QUOTE_309, QUOTE_310, QUOTE_311, QUOTE_312, QUOTE_313, QUOTE_314, QUOTE_315, QUOTE_316, QUOTE_317, QUOTE_318, QUOTE_319, QUOTE_320, QUOTE_321, QUOTE_322, QUOTE_323, QUOTE_324, QUOTE_325, QUOTE_326, QUOTE_327, QUOTE_328, QUOTE_329, QUOTE_330, QUOTE_331, QUOTE_332, QUOTE_333, QUOTE_334, QUOTE_335, QUOTE_336, QUOTE_337, QUOTE_338, QUOTE_339, QUOTE_340, QUOTE_341, QUOTE_342, QUOTE_343, QUOTE_344, QUOTE_345, QUOTE_346, QUOTE_347, QUOTE_348, QUOTE_349, QUOTE_350, QUOTE_351, QUOTE_352, QUOTE_353, QUOTE_354, QUOTE_355, QUOTE_356, QUOTE_357, QUOTE_358, QUOTE_359, QUOTE_360, QUOTE_361, QUOTE_362, QUOTE_363, QUOTE_364, QUOTE_365, QUOTE_366, QUOTE_367, QUOTE_368, QUOTE_369, QUOTE_370, QUOTE_371, QUOTE_372, QUOTE_373, QUOTE_374, QUOTE_375, QUOTE_376, QUOTE_377, QUOTE_378, QUOTE_379, QUOTE_380, QUOTE_381, QUOTE_382, QUOTE_383, QUOTE_384, QUOTE_385, QUOTE_386, };
+char const QUOTE_DATA[] PROGMEM = {
+  (char)175, (char)207, (char)207, (char)96, (char)216, (char)30, (char)107, (char)65, (char)121, (char)156, (char)68, (char)78, (char)16, (char)221, (char)77, (char)226,
+  (char)242, (char)164, (char)205, (char)123, (char)217, (char)28, (char)176, (char)205, (char)223, (char)211, (char)126, (char)162, (char)136, (char)219, (char)163, (char)154,
+  (char)8, (char)145, (char)47, (char)120, (char)243, (char)225, (char)170, (char)90, (char)112, (char)9, (char)130, (char)221, (char)165, (char)66, (char)98, (char)61,
+  (char)223, (char)193, (char)137, (char)140, (char)242, (char)124, (char)170, (char)227, (char)177, (char)162, (char)189, (char)177, (char)9, (char)13, (char)226, (char)243,
+  (char)94, (char)154, (char)102, (char)68, (char)194, (char)69, (char)10, (char)185, (char)117, (char)86, (char)121, (char)148, (char)29, (char)84, (char)205, (char)148,
+  (char)248, (char)45, (char)231, (char)3, (char)136, (char)43, (char)5, (char)231, (char)115, (char)19, (char)25, (char)228, (char)249, (char)91, (char)222, (char)16,
+  (char)57, (char)26, (char)60, (char)72, (char)72, (char)166, (char)187, (char)12, (char)65, (char)36, (char)162, (char)73, (char)55, (char)90, (char)202, (char)108,
+  (char)112, (char)202, (char)128, (char)133, (char)19, (char)7, (char)103, (char)242, (char)76, (char)189, (char)147, (char)48, (char)183, (char)152, (char)197, (char)246,
+  (char)36, (char)172, (char)103, (char)101, (char)214, (char)168, (char)137, (char)199, (char)76, (char)1, (char)70, (char)131, (char)178, (char)90, (char)187, (char)34,
+  (char)252, (char)69, (char)20, (char)137, (char)66, (char)152, (char)198, (char)121, (char)62, (char)54, (char)178, (char)242, (char)164, (char)205, (char)123, (char)199,
+  (char)236, (char)249, (char)124, (char)63, (char)231, (char)227, (char)252, (char)115, (char)225, (char)144, (char)243, (char)215, (char)122, (char)96, (char)237, (char)204,
+  (char)150, (char)156, (char)4, (char)39, (char)177, (char)212, (char)197, (char)250, (char)26, (char)154, (char)189, (char)24, (char)233, (char)192, (char)113, (char)176,
+  (char)107, (char)154, (char)107, (char)161, (char)101, (char)65, (char)237, (char)252, (char)189, (char)191, (char)111, (char)219, (char)246, (char)176, (char)209, (char)205,
+  (char)234, (char)15, (char)50, (char)142, (char)38, (char)113, (char)18, (char)216, (char)221, (char)28, (char)98, (char)103, (char)64, (char)152, (char)141, (char)119,
+  (char)77, (char)17, (char)190, (char)39, (char)65, (char)118, (char)145, (char)174, (char)242, (char)164, (char)245, (char)41, (char)186, (char)222, (char)72, (char)147,
+  (char)107, (char)220, (char)199, (char)61, (char)166, (char)152, (char)15, (char)171, (char)93, (char)229, (char)73, (char)234, (char)76, (char)21, (char)167, (char)5,
+  (char)10, (char)149, (char)95, (char)171, (char)209, (char)150, (char)13, (char)220, (char)233, (char)166, (char)88, (char)52, (char)122, (char)216, (char)212, (char)183,
+  (char)118, (char)121, (char)22, (char)101, (char)20, (char)205, (char)255, (char)204, (char)55, (char)119, (char)50, (char)191, (char)63, (char)61, (char)131, (char)96,
+  (char)163, (char)245, (char)225, (char)147, (char)60, (char)116, (char)139, (char)206, (char)229, (char)7, (char)82, (char)240, (char)80, (char)227, (char)162, (char)164,
+  (char)106, (char)171, (char)232, (char)14, (char)55, (char)26, (char)218, (char)198, (char)229, (char)126, (char)125, (char)186, (char)187, (char)57, (char)156, (char)120,
+  (char)14, (char)209, (char)182, (char)44, (char)110, (char)87, (char)231, (char)235, (char)142, (char)152, (char)40, (char)145, (char)131, (char)226, (char)246, (char)218,
+  (char)172, (char)191, (char)85, (char)175, (char)113, (char)136, (char)18, (char)165, (char)92, (char)137, (char)69, (char)124, (char)208, (char)41, (char)142, (char)111,
+  (char)170, (char)243, (char)187, (char)166, (char)90, (char)112, (char)17, (char)40, (char)91, (char)204, (char)161, (char)158, (char)93, (char)77, (char)121, (char)244,
+  (char)203, (char)171, (char)138, (char)36, (char)199, (char)249, (char)127, (char)215, (char)255, (char)161, (char)2, (char)84, (char)181, (char)128, (char)188, (char)175,
+  (char)43, (char)202, (char)242, (char)188, (char)175, (char)44, (char)255, (char)156, (char)60, (char)26, (char)47, (char)61, (char)212, (char)86, (char)126, (char)114,
+  (char)149, (char)58, (char)36, (char)122, (char)54, (char)2, (char)197, (char)123, (char)197, (char)230, (char)189, (char)37, (char)24, (char)156, (char)136, (char)162,
+  (char)44, (char)108, (char)207, (char)217, (char)65, (char)76, (char)217, (char)69, (char)189, (char)204, (char)137, (char)194, (char)6, (char)46, (char)177, (char)163,
+  (char)189, (char)189, (char)94, (char)126, (char)197, (char)76, (char)194, (char)71, (char)185, (char)187, (char)140, (char)112, (char)121, (char)173, (char)42, (char)226,
+  (char)137, (char)54, (char)87, (char)11, (char)4, (char)140, (char)30, (char)101, (char)232, (char)145, (char)232, (char)226, (char)137, (char)58, (char)41, (char)198,
+  (char)53, (char)117, (char)215, (char)205, (char)3, (char)107, (char)245, (char)239, (char)7, (char)153, (char)70, (char)15, (char)53, (char)101, (char)250, (char)184,
+  (char)36, (char)242, (char)151, (char)120, (char)188, (char)252, (char)179, (char)222, (char)107, (char)210, (char)247, (char)184, (char)56, (char)234, (char)198, (char)252,
+  (char)110, (char)185, (char)149, (char)181, (char)12, (char)96, (char)136, (char)245, (char)5, (char)96, (char)240, (char)73, (char)74, (char)213, (char)163, (char)43,
+  (char)243, (char)203, (char)78, (char)1, (char)78, (char)39, (char)193, (char)19, (char)1, (char)46, (char)173, (char)186, (char)54, (char)11, (char)138, (char)138,
+  (char)69, (char)54, (char)201, (char)53, (char)184, (char)249, (char)154, (char)177, (char)47, (char)14, (char)70, (char)231, (char)209, (char)113, (char)197, (char)70,
+  (char)221, (char)7, (char)84, (char)138, (char)112, (char)53, (char)216, (char)233, (char)101, (char)142, (char)38, (char)172, (char)150, (char)156, (char)2, (char)156,
+  (char)79, (char)130, (char)38, (char)29, (char)39, (char)82, (char)112, (char)22, (char)55, (char)69, (char)49, (char)63, (char)7, (char)145, (char)68, (char)77,
+  (char)46, (char)185, (char)230, (char)57, (char)62, (char)49, (char)121, (char)74, (char)131, (char)18, (char)132, (char)13, (char)89, (char)217, (char)36, (char)213,
+  (char)244, (char)131, (char)170, (char)144, (char)242, (char)196, (char)194, (char)156, (char)79, (char)130, (char)38, (char)2, (char)9, (char)141, (char)172, (char)150,
+  (char)156, (char)5, (char)211, (char)77, (char)203, (char)217, (char)245, (char)29, (char)95, (char)197, (char)46, (char)185, (char)230, (char)63, (char)163, (char)227,
+  (char)23, (char)148, (char)168, (char)20, (char)226, (char)124, (char)17, (char)48, (char)103, (char)55, (char)199, (char)211, (char)197, (char)244, (char)241, (char)62,
+  (char)225, (char)252, (char)61, (char)255, (char)143, (char)225, (char)241, (char)253, (char)221, (char)204, (char)230, (char)248, (char)250, (char)120, (char)190, (char)158,
+  (char)39, (char)78, (char)241, (char)227, (char)164, (char)72, (char)156, (char)28, (char)117, (char)92, (char)135, (char)10, (char)164, (char)122, (char)56, (char)216,
+  (char)36, (char)98, (char)54, (char)218, (char)202, (char)248, (char)236, (char)104, (char)241, (char)76, (char)135, (char)104, (char)139, (char)207, (char)128, (char)189,
+  (char)18, (char)108, (char)175, (char)207, (char)244, (char)131, (char)170, (char)243, (char)129, (char)196, (char)21, (char)129, (char)169, (char)41, (char)24, (char)149,
+  (char)180, (char)181, (char)159, (char)215, (char)23, (char)204, (char)137, (char)124, (char)78, (char)157, (char)204, (char)146, (char)96, (char)190, (char)67, (char)31,
+  (char)37, (char)189, (char)48, (char)238, (char)28, (char)137, (char)70, (char)2, (char)243, (char)139, (char)109, (char)238, (char)102, (char)208, (char)83, (char)48,
+  (char)183, (char)152, (char)134, (char)15, (char)117, (char)235, (char)65, (char)202, (char)244, (char)20, (char)47, (char)33, (char)131, (char)251, (char)153, (char)230,
+  (char)222, (char)37, (char)41, (char)73, (char)137, (char)120, (char)149, (char)129, (char)237, (char)107, (char)15, (char)50, (char)152, (char)149, (char)152, (char)85,
+  (char)76, (char)82, (char)107, (char)87, (char)234, (char)251, (char)7, (char)143, (char)86, (char)15, (char)53, (char)103, (char)251, (char)126, (char)31, (char)63,
+  (char)127, (char)207, (char)240, (char)249, (char)126, (char)35, (char)241, (char)248, (char)252, (char)126, (char)31, (char)31, (char)131, (char)47, (char)213, (char)177,
+  (char)119, (char)97, (char)171, (char)234, (char)40, (char)174, (char)150, (char)135, (char)28, (char)116, (char)193, (char)133, (char)26, (char)14, (char)195, (char)170,
+  (char)68, (char)236, (char)13, (char)102, (char)152, (char)11, (char)201, (char)161, (char)199, (char)121, (char)55, (char)126, (char)253, (char)236, (char)53, (char)183,
+  (char)188, (char)125, (char)27, (char)199, (char)233, (char)255, (char)49, (char)45, (char)153, (char)45, (char)172, (char)75, (char)199, (char)137, (char)103, (char)174,
+  (char)73, (char)171, (char)208, (char)117, (char)125, (char)2, (char)9, (char)141, (char)172, (char)236, (char)134, (char)88, (char)40, (char)250, (char)65, (char)212,
+  (char)179, (char)201, (char)226, (char)242, (char)141, (char)91, (char)6, (char)188, (char)41, (char)195, (char)147, (char)43, (char)224, (char)243, (char)90, (char)2,
+  (char)138, (char)233, (char)104, (char)216, (char)53, (char)242, (char)216, (char)186, (char)37, (char)169, (char)105, (char)123, (char)230, (char)180, (char)5, (char)99,
+  (char)32, (char)153, (char)55, (char)188, (char)73, (char)230, (char)190, (char)39, (char)220, (char)200, (char)38, (char)77, (char)238, (char)28, (char)102, (char)134,
+  (char)237, (char)23, (char)147, (char)69, (char)122, (char)21, (char)51, (char)9, (char)108, (char)110, (char)136, (char)149, (char)20, (char)113, (char)179, (char)126,
+  (char)253, (char)236, (char)189, (char)87, (char)31, (char)119, (char)215, (char)245, (char)208, (char)165, (char)191, (char)154, (char)121, (char)111, (char)73, (char)187,
+  (char)235, (char)114, (char)18, (char)208, (char)254, (char)183, (char)33, (char)45, (char)15, (char)218, (char)183, (char)205, (char)57, (char)108, (char)119, (char)181,
+  (char)197, (char)35, (char)223, (char)139, (char)120, (char)10, (char)249, (char)155, (char)179, (char)235, (char)194, (char)156, (char)57, (char)15, (char)169, (char)175,
+  (char)81, (char)130, (char)53, (char)238, (char)101, (char)45, (char)161, (char)167, (char)112, (char)228, (char)74, (char)26, (char)69, (char)57, (char)25, (char)247,
+  (char)142, (char)47, (char)62, (char)102, (char)60, (char)219, (char)196, (char)186, (char)182, (char)196, (char)75, (char)87, (char)129, (char)112, (char)224, (char)123,
+  (char)13, (char)128, (char)255, (char)185, (char)236, (char)215, (char)59, (char)23, (char)253, (char)25, (char)241, (char)252, (char)71, (char)195, (char)223, (char)248,
+  (char)143, (char)191, (char)227, (char)254, (char)163, (char)246, (char)252, (char)71, (char)223, (char)241, (char)249, (char)143, (char)199, (char)229, (char)251, (char)7,
+  (char)227, (char)248, (char)124, (char)126, (char)99, (char)227, (char)241, (char)252, (char)127, (char)144, (char)249, (char)127, (char)207, (char)199, (char)248, (char)143,
+  (char)191, (char)227, (char)243, (char)31, (char)47, (char)233, (char)254, (char)163, (char)246, (char)124, (char)126, (char)255, (char)127, (char)192, (char)127, (char)227,
+  (char)242, (char)255, (char)195, (char)59, (char)60, (char)11, (char)26, (char)69, (char)60, (char)32, (char)40, (char)164, (char)74, (char)10, (char)205, (char)226,
+  (char)182, (char)219, (char)12, (char)245, (char)243, (char)55, (char)5, (char)28, (char)56, (char)49, (char)196, (char)190, (char)150, (char)148, (char)164, (char)121,
+  (char)254, (char)255, (char)127, (char)252, (char)127, (char)207, (char)191, (char)248, (char)254, (char)31, (char)143, (char)197, (char)158, (char)255, (char)233, (char)241,
+  (char)254, (char)95, (char)47, (char)223, (char)241, (char)30, (char)239, (char)128, (char)247, (char)124, (char)25, (char)45, (char)56, (char)2, (char)226, (char)152,
+  (char)52, (char)214, (char)174, (char)54, (char)14, (char)54, (char)23, (char)20, (char)193, (char)163, (char)214, (char)63, (char)80, (char)165, (char)141, (char)228,
+  (char)252, (char)199, (char)65, (char)81, (char)213, (char)142, (char)77, (char)110, (char)199, (char)93, (char)52, (char)70, (char)248, (char)155, (char)31, (char)192,
+  (char)121, (char)38, (char)83, (char)49, (char)121, (char)99, (char)143, (char)144, (char)177, (char)163, (char)201, (char)50, (char)16, (char)193, (char)57, (char)7,
+  (char)168, (char)167, (char)150, (char)10, (char)95, (char)152, (char)221, (char)52, (char)158, (char)241, (char)79, (char)44, (char)20, (char)191, (char)49, (char)186,
+  (char)105, (char)61, (char)236, (char)248, (char)123, (char)254, (char)99, (char)240, (char)248, (char)127, (char)103, (char)246, (char)127, (char)103, (char)246, (char)124,
+  (char)76, (char)204, (char)204, (char)204, (char)204, (char)204, (char)204, (char)205, (char)128, (char)242, (char)76, (char)135, (char)133, (char)158, (char)197, (char)23,
+  (char)24, (char)137, (char)115, (char)242, (char)238, (char)99, (char)142, (char)174, (char)123, (char)59, (char)198, (char)15, (char)133, (char)3, (char)72, (char)167,
+  (char)198, (char)204, (char)229, (char)96, (char)191, (char)86, (char)217, (char)193, (char)142, (char)58, (char)185, (char)236, (char)239, (char)30, (char)36, (char)47,
+  (char)40, (char)197, (char)51, (char)246, (char)114, (char)124, (char)66, (char)166, (char)110, (char)141, (char)130, (char)90, (char)71, (char)166, (char)198, (char)238,
+  (char)183, (char)189, (char)142, (char)59, (char)167, (char)149, (char)125, (char)152, (char)38, (char)67, (char)209, (char)69, (char)51, (char)109, (char)7, (char)254,
+  (char)246, (char)205, (char)124, (char)187, (char)195, (char)120, (char)164, (char)202, (char)29, (char)39, (char)153, (char)71, (char)29, (char)20, (char)203, (char)29,
+  (char)207, (char)60, (char)166, (char)194, (char)141, (char)7, (char)103, (char)61, (char)186, (char)174, (char)171, (char)179, (char)233, (char)10, (char)97, (char)175,
+  (char)131, (char)32, (char)74, (char)149, (char)62, (char)130, (char)25, (char)46, (char)241, (char)93, (char)48, (char)44, (char)122, (char)58, (char)235, (char)227,
+  (char)52, (char)55, (char)104, (char)216, (char)32, (char)74, (char)149, (char)83, (char)20, (char)154, (char)169, (char)179, (char)196, (char)179, (char)185, (char)38,
+  (char)212, (char)195, (char)63, (char)34, (char)81, (char)128, (char)188, (char)226, (char)214, (char)94, (char)87, (char)149, (char)228, (char)43, (char)245, (char)143,
+  (char)75, (char)141, (char)106, (char)189, (char)12, (char)22, (char)218, (char)36, (char)140, (char)57, (char)38, (char)212, (char)192, (char)76, (char)165, (char)66,
+  (char)242, (char)15, (char)163, (char)0, (char)175, (char)142, (char)198, (char)133, (char)27, (char)98, (char)36, (char)136, (char)241, (char)215, (char)50, (char)149,
+  (char)11, (char)200, (char)54, (char)216, (char)40, (char)235, (char)121, (char)143, (char)4, (char)194, (char)139, (char)60, (char)188, (char)21, (char)252, (char)76,
+  (char)120, (char)77, (char)234, (char)255, (char)7, (char)210, (char)65, (char)198, (char)124, (char)21, (char)151, (char)152, (char)244, (char)204, (char)169, (char)75,
+  (char)91, (char)157, (char)201, (char)54, (char)166, (char)2, (char)101, (char)42, (char)23, (char)144, (char)250, (char)154, (char)68, (char)221, (char)179, (char)129,
+  (char)199, (char)76, (char)5, (char)49, (char)126, (char)235, (char)89, (char)163, (char)155, (char)212, (char)97, (char)144, (char)230, (char)158, (char)204, (char)7,
+  (char)34, (char)41, (char)180, (char)226, (char)137, (char)64, (char)243, (char)149, (char)141, (char)23, (char)105, (char)19, (char)41, (char)80, (char)252, (char)183,
+  (char)135, (char)36, (char)218, (char)152, (char)7, (char)17, (char)40, (char)245, (char)104, (char)226, (char)145, (char)117, (char)186, (char)224, (char)122, (char)54,
+  (char)196, (char)100, (char)245, (char)114, (char)35, (char)237, (char)99, (char)145, (char)190, (char)39, (char)207, (char)42, (char)103, (char)162, (char)144, (char)175,
+  (char)154, (char)14, (char)51, (char)67, (char)112, (char)76, (char)115, (char)210, (char)36, (char)78, (char)21, (char)232, (char)40, (char)211, (char)209, (char)176,
+  (char)41, (char)136, (char)145, (char)40, (char)83, (char)16, (char)73, (char)91, (char)188, (char)123, (char)119, (char)251, (char)126, (char)214, (char)94, (char)102,
+  (char)44, (char)106, (char)99, (char)99, (char)83, (char)185, (char)149, (char)184, (char)129, (char)68, (char)54, (char)111, (char)49, (char)3, (char)209, (char)72,
+  (char)62, (char)166, (char)189, (char)71, (char)137, (char)20, (char)217, (char)11, (char)7, (char)102, (char)8, (char)238, (char)143, (char)2, (char)159, (char)27,
+  (char)123, (char)195, (char)73, (char)122, (char)79, (char)50, (char)142, (char)69, (char)228, (char)28, (char)94, (char)150, (char)29, (char)87, (char)156, (char)100,
+  (char)23, (char)75, (char)109, (char)160, (char)224, (char)243, (char)90, (char)85, (char)176, (char)107, (char)162, (char)147, (char)122, (char)110, (char)56, (char)216,
+  (char)233, (char)233, (char)134, (char)134, (char)216, (char)47, (char)56, (char)200, (char)46, (char)150, (char)219, (char)64, (char)117, (char)109, (char)56, (char)118,
+  (char)82, (char)15, (char)169, (char)185, (char)79, (char)128, (char)173, (char)76, (char)92, (char)123, (char)103, (char)107, (char)0, (char)236, (char)130, (char)73,
+  (char)66, (char)122, (char)74, (char)35, (char)108, (char)65, (char)112, (char)222, (char)43, (char)130, (char)96, (char)59, (char)71, (char)27, (char)6, (char)190,
+  (char)124, (char)138, (char)106, (char)97, (char)49, (char)31, (char)164, (char)82, (char)15, (char)5, (char)194, (char)9, (char)43, (char)89, (char)36, (char)213,
+  (char)217, (char)218, (char)37, (char)212, (char)222, (char)41, (char)50, (char)128, (char)113, (char)221, (char)60, (char)159, (char)11, (char)88, (char)101, (char)36,
+  (char)195, (char)164, (char)182, (char)209, (char)36, (char)99, (char)221, (char)240, (char)99, (char)231, (char)74, (char)60, (char)127, (char)128, (char)252, (char)229,
+  (char)42, (char)15, (char)240, (char)7, (char)34, (char)124, (char)124, (char)34, (char)251, (char)87, (char)120, (char)44, (char)203, (char)185, (char)211, (char)76,
+  (char)27, (char)198, (char)218, (char)46, (char)234, (char)14, (char)122, (char)112, (char)31, (char)72, (char)124, (char)230, (char)245, (char)177, (char)115, (char)245,
+  (char)196, (char)222, (char)213, (char)5, (char)192, (char)84, (char)219, (char)5, (char)213, (char)118, (char)125, (char)61, (char)24, (char)205, (char)27, (char)151,
+  (char)130, (char)188, (char)248, (char)51, (char)92, (char)140, (char)232, (char)166, (char)22, (char)101, (char)179, (char)99, (char)186, (char)118, (char)196, (char)33,
+  (char)240, (char)183, (char)99, (char)153, (char)121, (char)175, (char)76, (char)186, (char)142, (char)171, (char)208, (char)232, (char)190, (char)39, (char)188, (char)117,
+  (char)249, (char)235, (char)219, (char)17, (char)196, (char)161, (char)185, (char)156, (char)82, (char)111, (char)113, (char)136, (char)30, (char)143, (char)88, (char)191,
+  (char)81, (char)213, (char)20, (char)193, (char)201, (char)130, (char)209, (char)78, (char)27, (char)28, (char)42, (char)111, (char)83, (char)182, (char)56, (char)87,
+  (char)219, (char)208, (char)212, (char)70, (char)130, (char)179, (char)120, (char)219, (char)16, (char)117, (char)109, (char)56, (char)4, (char)224, (char)56, (char)233,
+  (char)224, (char)36, (char)102, (char)38, (char)152, (char)53, (char)199, (char)20, (char)198, (char)214, (char)75, (char)87, (char)34, (char)81, (char)76, (char)82,
+  (char)107, (char)83, (char)136, (char)148, (char)95, (char)171, (char)108, (char)70, (char)221, (char)9, (char)233, (char)96, (char)174, (char)6, (char)112, (char)24,
+  (char)106, (char)195, (char)170, (char)90, (char)112, (char)19, (char)60, (char)203, (char)187, (char)138, (char)26, (char)231, (char)107, (char)207, (char)164, (char)222,
+  (char)235, (char)99, (char)166, (char)2, (char)227, (char)162, (char)135, (char)110, (char)38, (char)221, (char)50, (char)40, (char)47, (char)112, (char)150, (char)2,
+  (char)17, (char)61, (char)134, (char)20, (char)234, (char)125, (char)4, (char)182, (char)81, (char)109, (char)160, (char)110, (char)87, (char)92, (char)113, (char)28,
+  (char)208, (char)54, (char)180, (char)252, (char)190, (char)207, (char)180, (char)87, (char)204, (char)148, (char)41, (char)134, (char)219, (char)10, (char)186, (char)235,
+  (char)209, (char)42, (char)80, (char)75, (char)168, (char)237, (char)160, (char)145, (char)152, (char)141, (char)142, (char)160, (char)214, (char)212, (char)130, (char)238,
+  (char)100, (char)158, (char)107, (char)226, (char)121, (char)240, (char)51, (char)144, (char)215, (char)193, (char)230, (char)180, (char)101, (char)231, (char)117, (char)213,
+  (char)120, (char)229, (char)24, (char)188, (char)193, (char)68, (char)56, (char)150, (char)173, (char)131, (char)177, (char)108, (char)109, (char)183, (char)36, (char)232,
+  (char)167, (char)16, (char)227, (char)185, (char)18, (char)109, (char)239, (char)98, (char)94, (char)37, (char)102, (char)127, (char)28, (char)167, (char)210, (char)117,
+  (char)92, (char)84, (char)82, (char)41, (char)181, (char)149, (char)184, (char)186, (char)48, (char)234, (char)241, (char)202, (char)121, (char)235, (char)146, (char)106,
+  (char)132, (char)95, (char)41, (char)90, (char)207, (char)127, (char)243, (char)30, (char)255, (char)230, (char)61, (char)255, (char)204, (char)123, (char)255, (char)152,
+  (char)106, (char)24, (char)235, (char)193, (char)50, (char)24, (char)60, (char)215, (char)185, (char)151, (char)148, (char)120, (char)148, (char)246, (char)30, (char)118,
+  (char)146, (char)244, (char)225, (char)168, (char)163, (char)65, (char)115, (char)244, (char)115, (char)76, (char)27, (char)160, (char)163, (char)224, (char)151, (char)164,
+  (char)98, (char)107, (char)226, (char)108, (char)220, (char)221, (char)142, (char)221, (char)222, (char)16, (char)239, (char)207, (char)34, (char)112, (char)174, (char)67,
+  (char)138, (char)36, (char)199, (char)102, (char)202, (char)102, (char)182, (char)22, (char)247, (char)176, (char)220, (char)221, (char)142, (char)221, (char)210, (char)117,
+  (char)20, (char)99, (char)237, (char)87, (char)200, (char)199, (char)2, (char)226, (char)147, (char)122, (char)152, (char)189, (char)251, (char)153, (char)185, (char)187,
+  (char)29, (char)162, (char)243, (char)221, (char)69, (char)30, (char)239, (char)131, (char)43, (char)188, (char)154, (char)23, (char)105, (char)141, (char)205, (char)216,
+  (char)237, (char)27, (char)95, (char)74, (char)92, (char)253, (char)5, (char)31, (char)4, (char)189, (char)35, (char)194, (char)102, (char)241, (char)35, (char)49,
+  (char)201, (char)241, (char)141, (char)88, (char)28, (char)173, (char)100, (char)173, (char)165, (char)92, (char)244, (char)224, (char)10, (char)43, (char)165, (char)163,
+  (char)142, (char)164, (char)193, (char)186, (char)53, (char)236, (char)108, (char)242, (char)128, (char)40, (char)208, (char)86, (char)117, (char)110, (char)110, (char)199,
+  (char)104, (char)217, (char)76, (char)214, (char)193, (char)155, (char)155, (char)177, (char)218, (char)10, (char)62, (char)9, (char)122, (char)71, (char)132, (char)205,
+  (char)251, (char)198, (char)183, (char)180, (char)202, (char)38, (char)41, (char)138, (char)77, (char)91, (char)59, (char)32, (char)206, (char)183, (char)16, (char)175,
+  (char)137, (char)81, (char)71, (char)165, (char)198, (char)182, (char)239, (char)23, (char)238, (char)217, (char)134, (char)137, (char)24, (char)209, (char)232, (char)62,
+  (char)53, (char)21, (char)131, (char)139, (char)200, (char)72, (char)159, (char)22, (char)109, (char)14, (char)43, (char)2, (char)166, (char)96, (char)227, (char)230,
+  (char)113, (char)139, (char)220, (char)48, (char)234, (char)215, (char)194, (char)92, (char)61, (char)183, (char)36, (char)230, (char)113, (char)21, (char)54, (char)193,
+  (char)135, (char)87, (char)222, (char)84, (char)153, (char)175, (char)123, (char)43, (char)243, (char)237, (char)136, (char)231, (char)176, (char)108, (char)31, (char)25,
+  (char)183, (char)99, (char)180, (char)123, (char)190, (char)12, (char)185, (char)251, (char)183, (char)239, (char)21, (char)249, (char)226, (char)243, (char)227, (char)163,
+  (char)135, (char)1, (char)52, (char)215, (char)203, (char)78, (char)1, (char)56, (char)115, (char)70, (char)92, (char)253, (char)21, (char)52, (char)138, (char)120,
+  (char)16, (char)195, (char)171, (char)93, (char)229, (char)73, (char)154, (char)247, (char)178, (char)231, (char)238, (char)239, (char)21, (char)199, (char)42, (char)40,
+  (char)237, (char)27, (char)98, (char)57, (char)18, (char)231, (char)76, (char)71, (char)55, (char)230, (char)102, (char)230, (char)236, (char)118, (char)142, (char)79,
+  (char)91, (char)159, (char)163, (char)130, (char)242, (char)238, (char)101, (char)109, (char)158, (char)200, (char)4, (char)225, (char)182, (char)61, (char)9, (char)195,
+  (char)108, (char)68, (char)141, (char)78, (char)174, (char)38, (char)113, (char)10, (char)99, (char)137, (char)156, (char)89, (char)217, (char)36, (char)213, (char)116,
+  (char)116, (char)142, (char)122, (char)112, (char)207, (char)46, (char)174, (char)187, (char)170, (char)175, (char)181, (char)133, (char)155, (char)63, (char)172, (char)54,
+  (char)104, (char)142, (char)81, (char)218, (char)49, (char)155, (char)228, (char)67, (char)96, (char)215, (char)235, (char)145, (char)102, (char)216, (char)98, (char)244,
+  (char)73, (char)176, (char)179, (char)103, (char)245, (char)134, (char)205, (char)17, (char)202, (char)59, (char)70, (char)51, (char)124, (char)136, (char)108, (char)26,
+  (char)229, (char)99, (char)69, (char)232, (char)147, (char)96, (char)130, (char)72, (char)72, (char)194, (char)113, (char)208, (char)117, (char)101, (char)148, (char)196,
+  (char)186, (char)175, (char)40, (char)219, (char)188, (char)86, (char)226, (char)30, (char)143, (char)88, (char)76, (char)111, (char)177, (char)214, (char)179, (char)255,
+  (char)55, (char)101, (char)60, (char)127, (char)244, (char)32, (char)68, (char)68, (char)77, (char)68, (char)68, (char)95, (char)19, (char)58, (char)82, (char)140,
+  (char)255, (char)205, (char)217, (char)79, (char)31, (char)253, (char)8, (char)156, (char)33, (char)184, (char)196, (char)8, (char)136, (char)137, (char)168, (char)136,
+  (char)139, (char)226, (char)103, (char)74, (char)81, (char)146, (char)246, (char)96, (char)46, (char)154, (char)104, (char)245, (char)53, (char)53, (char)81, (char)83,
+  (char)70, (char)193, (char)174, (char)153, (char)99, (char)185, (char)167, (char)114, (char)110, (char)97, (char)77, (char)215, (char)239, (char)21, (char)201, (char)53,
+  (char)122, (char)27, (char)55, (char)152, (char)245, (char)210, (char)166, (char)204, (char)137, (char)245, (char)85, (char)234, (char)93, (char)166, (char)56, (char)164,
+  (char)222, (char)227, (char)9, (char)143, (char)20, (char)203, (char)149, (char)172, (char)230, (char)248, (char)250, (char)120, (char)190, (char)158, (char)39, (char)78,
+  (char)241, (char)201, (char)241, (char)29, (char)151, (char)234, (char)105, (char)20, (char)250, (char)19, (char)142, (char)139, (char)206, (char)235, (char)173, (char)239,
+  (char)13, (char)234, (char)243, (char)215, (char)77, (char)207, (char)60, (char)168, (char)36, (char)86, (char)54, (char)216, (char)216, (char)225, (char)129, (char)230,
+  (char)89, (char)110, (char)155, (char)206, (char)129, (char)56, (char)232, (char)113, (char)222, (char)77, (char)101, (char)143, (char)145, (char)244, (char)243, (char)229,
+  (char)213, (char)76, (char)177, (char)220, (char)243, (char)202, (char)96, (char)172, (char)23, (char)164, (char)99, (char)229, (char)201, (char)17, (char)172, (char)177,
+  (char)242, (char)62, (char)240, (char)222, (char)175, (char)170, (char)198, (char)160, (char)219, (char)17, (char)233, (char)162, (char)216, (char)209, (char)198, (char)198,
+  (char)0, (char)135, (char)109, (char)200, (char)112, (char)170, (char)72, (char)107, (char)86, (char)15, (char)213, (char)205, (char)56, (char)153, (char)196, (char)108,
+  (char)116, (char)205, (char)175, (char)181, (char)106, (char)113, (char)221, (char)60, (char)159, (char)11, (char)89, (char)95, (char)159, (char)154, (char)123, (char)48,
+  (char)14, (char)181, (char)228, (char)81, (char)16, (char)237, (char)185, (char)14, (char)29, (char)195, (char)69, (char)20, (char)137, (char)70, (char)193, (char)122,
+  (char)24, (char)236, (char)34, (char)155, (char)75, (char)28, (char)78, (char)52, (char)18, (char)77, (char)80, (char)72, (char)90, (char)206, (char)68, (char)83,
+  (char)73, (char)10, (char)41, (char)18, (char)141, (char)27, (char)3, (char)142, (char)171, (char)96, (char)113, (char)16, (char)237, (char)185, (char)14, (char)2,
+  (char)244, (char)49, (char)216, (char)117, (char)27, (char)196, (char)59, (char)87, (char)189, (char)158, (char)36, (char)48, (char)76, (char)132, (char)144, (char)214,
+  (char)173, (char)163, (char)153, (char)195, (char)65, (char)68, (char)38, (char)28, (char)204, (char)56, (char)239, (char)55, (char)200, (char)194, (char)207, (char)44,
+  (char)161, (char)226, (char)116, (char)9, (char)136, (char)82, (char)224, (char)113, (char)17, (char)55, (char)58, (char)214, (char)93, (char)164, (char)66, (char)47,
+  (char)148, (char)170, (char)125, (char)7, (char)235, (char)240, (char)8, (char)246, (char)133, (char)155, (char)248, (char)188, (char)138, (char)44, (char)166, (char)80,
+  (char)129, (char)199, (char)63, (char)34, (char)81, (char)113, (char)243, (char)121, (char)197, (char)71, (char)137, (char)247, (char)179, (char)178, (char)243, (char)137,
+  (char)142, (char)5, (char)39, (char)197, (char)231, (char)210, (char)117, (char)83, (char)40, (char)64, (char)227, (char)220, (char)202, (char)246, (char)234, (char)244,
+  (char)94, (char)134, (char)62, (char)62, (char)217, (char)162, (char)191, (char)192, (char)29, (char)94, (char)17, (char)126, (char)34, (char)242, (char)104, (char)150,
+  (char)169, (char)166, (char)13, (char)227, (char)23, (char)155, (char)173, (char)214, (char)175, (char)53, (char)183, (char)120, (char)138, (char)82, (char)134, (char)21,
+  (char)230, (char)182, (char)247, (char)14, (char)190, (char)41, (char)131, (char)69, (char)109, (char)58, (char)46, (char)150, (char)208, (char)58, (char)215, (char)145,
+  (char)71, (char)120, (char)151, (char)87, (char)137, (char)103, (char)175, (char)214, (char)27, (char)96, (char)237, (char)31, (char)167, (char)245, (char)48, (char)230,
+  (char)153, (char)13, (char)116, (char)204, (char)249, (char)72, (char)226, (char)19, (char)17, (char)138, (char)30, (char)34, (char)153, (char)137, (char)167, (char)29,
+  (char)48, (char)28, (char)244, (char)225, (char)222, (char)202, (char)102, (char)124, (char)164, (char)113, (char)239, (char)28, (char)223, (char)31, (char)79, (char)23,
+  (char)211, (char)196, (char)232, (char)57, (char)233, (char)192, (char)29, (char)78, (char)154, (char)46, (char)140, (char)102, (char)151, (char)68, (char)206, (char)91,
+  (char)247, (char)239, (char)101, (char)51, (char)62, (char)82, (char)56, (char)247, (char)142, (char)41, (char)23, (char)91, (char)64, (char)101, (char)36, (char)192,
+  (char)66, (char)193, (char)236, (char)80, (char)227, (char)170, (char)28, (char)136, (char)154, (char)44, (char)110, (char)234, (char)50, (char)242, (char)104, (char)195,
+  (char)33, (char)201, (char)234, (char)175, (char)113, (char)138, (char)156, (char)113, (char)123, (char)140, (char)83, (char)51, (char)229, (char)35, (char)136, (char)76,
+  (char)68, (char)180, (char)224, (char)46, (char)154, (char)35, (char)89, (char)118, (char)145, (char)129, (char)55, (char)70, (char)206, (char)111, (char)169, (char)244,
+  (char)26, (char)238, (char)154, (char)120, (char)120, (char)36, (char)94, (char)59, (char)71, (char)166, (char)153, (char)159, (char)41, (char)28, (char)90, (char)202,
+  (char)102, (char)124, (char)164, (char)113, (char)16, (char)203, (char)1, (char)226, (char)125, (char)27, (char)92, (char)169, (char)69, (char)125, (char)75, (char)52,
+  (char)203, (char)149, (char)180, (char)102, (char)186, (char)102, (char)124, (char)164, (char)113, (char)27, (char)6, (char)190, (char)73, (char)1, (char)200, (char)179,
+  (char)40, (char)219, (char)22, (char)61, (char)238, (char)206, (char)81, (char)160, (char)174, (char)90, (char)112, (char)23, (char)70, (char)214, (char)232, (char)76,
+  (char)66, (char)233, (char)104, (char)227, (char)96, (char)166, (char)103, (char)202, (char)71, (char)17, (char)231, (char)76, (char)21, (char)165, (char)99, (char)0,
+  (char)188, (char)175, (char)33, (char)123, (char)239, (char)120, (char)245, (char)83, (char)51, (char)229, (char)35, (char)136, (char)237, (char)222, (char)54, (char)9,
+  (char)105, (char)192, (char)94, (char)137, (char)193, (char)189, (char)42, (char)54, (char)73, (char)237, (char)105, (char)198, (char)131, (char)110, (char)131, (char)170,
+  (char)91, (char)27, (char)161, (char)211, (char)68, (char)81, (char)140, (char)210, (char)232, (char)153, (char)200, (char)54, (char)193, (char)205, (char)241, (char)244,
+  (char)241, (char)125, (char)60, (char)78, (char)140, (char)87, (char)226, (char)56, (char)216, (char)36, (char)83, (char)134, (char)240, (char)228, (char)71, (char)140,
+  (char)75, (char)23, (char)232, (char)216, (char)53, (char)227, (char)60, (char)163, (char)27, (char)110, (char)40, (char)51, (char)246, (char)254, (char)31, (char)180,
+  (char)124, (char)254, (char)255, (char)151, (char)239, (char)247, (char)255, (char)38, (char)115, (char)122, (char)173, (char)185, (char)232, (char)165, (char)102, (char)120,
+  (char)189, (char)206, (char)183, (char)63, (char)55, (char)170, (char)158, (char)122, (char)41, (char)89, (char)158, (char)47, (char)115, (char)173, (char)206, (char)107,
+  (char)225, (char)191, (char)123, (char)40, (char)179, (char)211, (char)11, (char)123, (char)198, (char)221, (char)93, (char)156, (char)206, (char)26, (char)58, (char)215,
+  (char)163, (char)96, (char)186, (char)118, (char)52, (char)113, (char)139, (char)205, (char)203, (char)222, (char)10, (char)52, (char)26, (char)232, (char)168, (char)146,
+  (char)84, (char)62, (char)41, (char)162, (char)243, (char)94, (char)134, (char)161, (char)175, (char)123, (char)60, (char)75, (char)196, (char)188, (char)72, (char)86,
+  (char)226, (char)18, (char)192, (char)112, (char)121, (char)173, (char)1, (char)230, (char)81, (char)193, (char)255, (char)157, (char)172, (char)215, (char)2, (char)145,
+  (char)198, (char)213, (char)153, (char)236, (char)238, (char)30, (char)239, (char)131, (char)53, (char)180, (char)242, (char)90, (char)102, (char)49, (char)113, (char)95,
+  (char)128, (char)250, (char)175, (char)212, (char)121, (char)148, (char)113, (char)51, (char)136, (char)184, (char)215, (char)67, (char)183, (char)27, (char)142, (char)45,
+  (char)96, (char)254, (char)158, (char)255, (char)127, (char)241, (char)249, (char)126, (char)241, (char)231, (char)172, (char)227, (char)3, (char)16, (char)61, (char)30,
+  (char)149, (char)153, (char)59, (char)99, (char)129, (char)70, (char)130, (char)185, (char)106, (char)214, (char)179, (char)61, (char)129, (char)197, (char)222, (char)203,
+  (char)27, (char)186, (char)129, (char)196, (char)59, (char)62, (char)145, (char)23, (char)240, (char)91, (char)119, (char)136, (char)191, (char)130, (char)212, (char)250,
+  (char)2, (char)219, (char)68, (char)145, (char)178, (char)90, (char)181, (char)172, (char)207, (char)103, (char)120, (char)58, (char)143, (char)50, (char)152, (char)227,
+  (char)106, (char)142, (char)15, (char)53, (char)162, (char)142, (char)191, (char)165, (char)137, (char)120, (char)149, (char)131, (char)212, (char)227, (char)162, (char)162,
+  (char)79, (char)92, (char)145, (char)82, (char)115, (char)210, (char)221, (char)212, (char)27, (char)3, (char)114, (char)122, (char)210, (char)54, (char)52, (char)42,
+  (char)85, (char)218, (char)202, (char)248, (char)236, (char)104, (char)43, (char)20, (char)162, (char)38, (char)110, (char)56, (char)208, (char)29, (char)92, (char)136,
+  (char)166, (char)211, (char)138, (char)115, (char)49, (char)34, (char)37, (char)101, (char)116, (char)205, (char)61, (char)60, (char)7, (char)52, (char)193, (char)186,
+  (char)32, (char)146, (char)145, (char)123, (char)40, (char)57, (char)88, (char)162, (char)187, (char)170, (char)58, (char)157, (char)99, (char)168, (char)187, (char)153,
+  (char)121, (char)94, (char)67, (char)175, (char)154, (char)100, (char)43, (char)193, (char)17, (char)234, (char)26, (char)150, (char)178, (char)184, (char)105, (char)128,
+  (char)62, (char)53, (char)46, (char)150, (char)219, (char)65, (char)126, (char)162, (char)225, (char)235, (char)165, (char)73, (char)136, (char)151, (char)179, (char)1,
+  (char)76, (char)219, (char)164, (char)42, (char)188, (char)238, (char)186, (char)175, (char)28, (char)163, (char)23, (char)152, (char)191, (char)83, (char)72, (char)166,
+  (char)158, (char)158, (char)241, (char)121, (char)175, (char)78, (char)186, (char)62, (char)16, (char)24, (char)60, (char)213, (char)128, (char)219, (char)56, (char)119,
+  (char)143, (char)18, (char)241, (char)33, (char)129, (char)13, (char)101, (char)195, (char)215, (char)188, (char)85, (char)92, (char)147, (char)87, (char)163, (char)95,
+  (char)172, (char)38, (char)55, (char)216, (char)235, (char)89, (char)182, (char)112, (char)239, (char)28, (char)82, (char)46, (char)183, (char)94, (char)211, (char)128,
+  (char)147, (char)233, (char)76, (char)207, (char)183, (char)120, (char)174, (char)73, (char)171, (char)208, (char)92, (char)61, (char)116, (char)181, (char)156, (char)137,
+  (char)65, (char)213, (char)182, (char)112, (char)233, (char)129, (char)75, (char)66, (char)99, (char)60, (char)159, (char)42, (char)149, (char)51, (char)50, (char)187,
+  (char)170, (char)184, (char)232, (char)160, (char)172, (char)23, (char)234, (char)219, (char)56, (char)103, (char)161, (char)248, (char)101, (char)55, (char)175, (char)144,
+  (char)187, (char)76, (char)79, (char)157, (char)79, (char)160, (char)219, (char)56, (char)14, (char)82, (char)187, (char)120, (char)193, (char)231, (char)43, (char)26,
+  (char)44, (char)110, (char)234, (char)11, (char)223, (char)163, (char)212, (char)161, (char)168, (char)106, (char)202, (char)228, (char)154, (char)189, (char)31, (char)231,
+  (char)246, (char)12, (char)167, (char)84, (char)138, (char)21, (char)113, (char)68, (char)152, (char)226, (char)145, (char)117, (char)186, (char)246, (char)156, (char)7,
+  (char)183, (char)242, (char)246, (char)179, (char)94, (char)54, (char)190, (char)131, (char)141, (char)130, (char)228, (char)105, (char)237, (char)167, (char)120, (char)246,
+  (char)254, (char)94, (char)214, (char)87, (char)231, (char)58, (char)177, (char)181, (char)244, (char)21, (char)122, (char)163, (char)166, (char)10, (char)19, (char)17,
+  (char)125, (char)184, (char)121, (char)11, (char)242, (char)125, (char)37, (char)99, (char)47, (char)85, (char)199, (char)251, (char)82, (char)95, (char)95, (char)34,
+  (char)92, (char)221, (char)252, (char)126, (char)239, (char)231, (char)250, (char)191, (char)235, (char)255, (char)63, (char)143, (char)207, (char)236, (char)255, (char)111,
+  (char)190, (char)255, (char)222, (char)192, (char)198, (char)215, (char)211, (char)188, (char)55, (char)171, (char)154, (char)100, (char)218, (char)182, (char)139, (char)205,
+  (char)122, (char)36, (char)122, (char)19, (char)142, (char)139, (char)206, (char)235, (char)173, (char)100, (char)180, (char)224, (char)48, (char)121, (char)229, (char)180,
+  (char)99, (char)107, (char)232, (char)57, (char)22, (char)101, (char)9, (char)136, (char)150, (char)150, (char)94, (char)87, (char)149, (char)229, (char)220, (char)43,
+  (char)231, (char)147, (char)241, (char)30, (char)57, (char)70, (char)47, (char)49, (char)163, (char)180, (char)20, (char)98, (char)114, (char)34, (char)136, (char)201,
+  (char)234, (char)61, (char)223, (char)193, (char)149, (char)182, (char)105, (char)132, (char)45, (char)239, (char)21, (char)222, (char)77, (char)23, (char)29, (char)20,
+  (char)122, (char)54, (char)196, (char)114, (char)37, (char)27, (char)92, (char)33, (char)150, (char)24, (char)85, (char)204, (char)213, (char)106, (char)226, (char)145,
+  (char)117, (char)180, (char)18, (char)210, (char)198, (char)205, (char)48, (char)133, (char)189, (char)226, (char)190, (char)40, (char)113, (char)215, (char)35, (char)30,
+  (char)139, (char)142, (char)138, (char)49, (char)155, (char)228, (char)76, (char)75, (char)243, (char)201, (char)244, (char)166, (char)103, (char)213, (char)36, (char)213,
+  (char)95, (char)104, (char)215, (char)235, (char)7, (char)109, (char)2, (char)99, (char)125, (char)142, (char)181, (char)151, (char)154, (char)244, (char)246, (char)131,
+  (char)204, (char)163, (char)110, (char)131, (char)171, (char)154, (char)35, (char)215, (char)179, (char)138, (char)36, (char)198, (char)190, (char)17, (char)37, (char)207,
+  (char)43, (char)2, (char)94, (char)37, (char)99, (char)47, (char)216, (char)143, (char)10, (char)101, (char)46, (char)225, (char)34, (char)156, (char)94, (char)116,
+  (char)247, (char)11, (char)167, (char)99, (char)71, (char)142, (char)145, (char)236, (char)151, (char)123, (char)0, (char)56, (char)65, (char)224, (char)225, (char)7,
+  (char)131, (char)132, (char)30, (char)49, (char)91, (char)28, (char)57, (char)162, (char)34, (char)111, (char)223, (char)188, (char)92, (char)155, (char)29, (char)220,
+  (char)204, (char)82, (char)120, (char)32, (char)228, (char)69, (char)61, (char)128, (char)255, (char)60, (char)98, (char)255, (char)7, (char)234, (char)117, (char)167,
+  (char)148, (char)20, (char)114, (char)73, (char)181, (char)88, (char)151, (char)143, (char)18, (char)207, (char)114, (char)35, (char)105, (char)152, (char)177, (char)198,
+  (char)175, (char)110, (char)255, (char)111, (char)218, (char)207, (char)77, (char)34, (char)88, (char)219, (char)222, (char)60, (char)83, (char)96, (char)91, (char)204,
+  (char)120, (char)71, (char)43, (char)135, (char)245, (char)252, (char)191, (char)171, (char)47, (char)53, (char)233, (char)79, (char)203, (char)229, (char)246, (char)142,
+  (char)198, (char)166, (char)173, (char)105, (char)236, (char)160, (char)244, (char)192, (char)247, (char)52, (char)36, (char)153, (char)72, (char)121, (char)98, (char)125,
+  (char)60, (char)208, (char)95, (char)99, (char)94, (char)224, (char)146, (char)18, (char)211, (char)128, (char)83, (char)137, (char)240, (char)68, (char)192, (char)72,
+  (char)204, (char)41, (char)139, (char)247, (char)113, (char)216, (char)219, (char)89, (char)93, (char)48, (char)44, (char)70, (char)15, (char)133, (char)7, (char)27,
+  (char)7, (char)92, (char)138, (char)49, (char)49, (char)72, (char)121, (char)98, (char)108, (char)147, (char)233, (char)76, (char)207, (char)170, (char)22, (char)10,
+  (char)67, (char)203, (char)19, (char)232, (char)83, (char)117, (char)92, (char)182, (char)46, (char)234, (char)68, (char)139, (char)31, (char)19, (char)163, (char)0,
+  (char)75, (char)243, (char)201, (char)244, (char)166, (char)103, (char)213, (char)36, (char)213, (char)95, (char)104, (char)215, (char)235, (char)7, (char)109, (char)2,
+  (char)99, (char)125, (char)142, (char)181, (char)144, (char)201, (char)115, (char)201, (char)53, (char)122, (char)49, (char)125, (char)136, (char)16, (char)248, (char)91,
+  (char)110, (char)241, (char)116, (char)238, (char)99, (char)145, (char)173, (char)41, (char)97, (char)158, (char)187, (char)170, (char)244, (char)81, (char)76, (char)219,
+  (char)64, (char)166, (char)27, (char)52, (char)194, (char)21, (char)36, (char)134, (char)9, (char)57, (char)17, (char)68, (char)98, (char)251, (char)16, (char)41,
+  (char)138, (char)98, (char)113, (char)181, (char)149, (char)211, (char)2, (char)196, (char)44, (char)211, (char)46, (char)86, (char)208, (char)122, (char)40, (char)166,
+  (char)109, (char)167, (char)69, (char)232, (char)98, (char)69, (char)53, (char)216, (char)97, (char)49, (char)29, (char)120, (char)145, (char)69, (char)123, (char)33,
+  (char)200, (char)164, (char)202, (char)228, (char)154, (char)175, (char)213, (char)194, (char)92, (char)5, (char)199, (char)69, (char)203, (char)41, (char)255, (char)253,
+  (char)34, (char)154, (char)236, (char)63, (char)255, (char)197, (char)239, (char)221, (char)198, (char)193, (char)46, (char)163, (char)227, (char)82, (char)98, (char)53,
+  (char)222, (char)136, (char)229, (char)49, (char)69, (char)56, (char)198, (char)214, (char)95, (char)171, (char)115, (char)168, (char)166, (char)57, (char)233, (char)192,
+  (char)98, (char)245, (char)209, (char)45, (char)84, (char)137, (char)82, (char)243, (char)160, (char)216, (char)57, (char)233, (char)192, (char)96, (char)69, (char)44,
+  (char)245, (char)72, (char)166, (char)187, (char)15, (char)63, (char)169, (char)230, (char)180, (char)28, (char)108, (char)30, (char)223, (char)111, (char)180, (char)126,
+  (char)242, (char)154, (char)236, (char)49, (char)237, (char)246, (char)251, (char)69, (char)230, (char)106, (char)206, (char)68, (char)83, (char)73, (char)6, (char)219,
+  (char)5, (char)15, (char)54, (char)238, (char)58, (char)182, (char)29, (char)180, (char)29, (char)117, (char)188, (char)214, (char)130, (char)90, (char)164, (char)83,
+  (char)93, (char)134, (char)47, (char)59, (char)187, (char)217, (char)69, (char)73, (char)72, (char)195, (char)145, (char)29, (char)19, (char)20, (char)192, (char)177,
+  (char)80, (char)163, (char)211, (char)76, (char)207, (char)136, (char)92, (char)169, (char)74, (char)164, (char)83, (char)93, (char)134, (char)42, (char)145, (char)77,
+  (char)95, (char)86, (char)15, (char)53, (char)96, (char)184, (char)218, (char)186, (char)91, (char)222, (char)42, (char)78, (char)58, (char)63, (char)199, (char)236,
+  (char)18, (char)217, (char)146, (char)213, (char)183, (char)71, (char)51, (char)134, (char)238, (char)246, (char)122, (char)92, (char)122, (char)187, (char)22, (char)198,
+  (char)213, (char)131, (char)245, (char)41, (char)140, (char)80, (char)214, (char)150, (char)231, (char)226, (char)243, (char)231, (char)185, (char)240, (char)101, (char)34,
+  (char)88, (char)212, (char)250, (char)14, (char)40, (char)147, (char)23, (char)100, (char)190, (char)39, (char)76, (char)248, (char)25, (char)200, (char)117, (char)241,
+  (char)176, (char)72, (char)193, (char)88, (char)197, (char)48, (char)220, (char)178, (char)158, (char)241, (char)126, (char)169, (char)38, (char)162, (char)140, (char)78,
+  (char)68, (char)81, (char)14, (char)58, (char)156, (char)113, (char)104, (char)130, (char)81, (char)106, (char)189, (char)18, (char)121, (char)235, (char)186, (char)173,
+  (char)177, (char)24, (char)27, (char)119, (char)70, (char)198, (char)238, (char)103, (char)245, (char)24, (char)190, (char)100, (char)75, (char)226, (char)116, (char)20,
+  (char)137, (char)88, (char)41, (char)18, (char)37, (char)241, (char)58, (char)49, (char)47, (char)207, (char)91, (char)80, (char)193, (char)69, (char)116, (char)180,
+  (char)125, (char)34, (char)93, (char)92, (char)137, (char)119, (char)142, (char)68, (char)161, (char)17, (char)235, (char)159, (char)175, (char)108, (char)224, (char)163,
+  (char)183, (char)123, (char)60, (char)72, (char)96, (char)153, (char)9, (char)33, (char)173, (char)91, (char)71, (char)51, (char)134, (char)130, (char)136, (char)76,
+  (char)57, (char)152, (char)113, (char)222, (char)111, (char)145, (char)133, (char)158, (char)89, (char)67, (char)196, (char)232, (char)19, (char)16, (char)165, (char)192,
+  (char)226, (char)34, (char)110, (char)117, (char)172, (char)219, (char)160, (char)234, (char)162, (char)78, (char)126, (char)67, (char)107, (char)156, (char)123, (char)103,
+  (char)5, (char)30, (char)239, (char)131, (char)0, (char)247, (char)255, (char)31, (char)217, (char)247, (char)247, (char)15, (char)199, (char)227, (char)241, (char)31,
+  (char)135, (char)242, (char)247, (char)255, (char)175, (char)199, (char)254, (char)63, (char)227, (char)226, (char)207, (char)75, (char)140, (char)215, (char)160, (char)234,
+  (char)137, (char)66, (char)222, (char)101, (char)1, (char)35, (char)48, (char)166, (char)48, (char)57, (char)90, (char)202, (char)102, (char)61, (char)201, (char)23,
+  (char)159, (char)73, (char)230, (char)81, (char)199, (char)85, (char)246, (char)53, (char)238, (char)101, (char)233, (char)131, (char)183, (char)111, (char)24, (char)60,
+  (char)214, (char)131, (char)96, (char)191, (char)39, (char)208, (char)123, (char)127, (char)47, (char)104, (char)173, (char)196, (char)37, (char)213, (char)135, (char)86,
+  (char)187, (char)202, (char)147, (char)53, (char)101, (char)126, (char)115, (char)123, (char)173, (char)142, (char)152, (char)12, (char)17, (char)30, (char)162, (char)244,
+  (char)193, (char)219, (char)153, (char)248, (char)64, (char)121, (char)240, (char)121, (char)229, (char)180, (char)66, (char)47, (char)149, (char)51, (char)37, (char)171,
+  (char)226, (char)116, (char)101, (char)110, (char)33, (char)8, (char)190, (char)82, (char)181, (char)133, (char)31, (char)4, (char)189, (char)35, (char)254, (char)16,
+  (char)139, (char)229, (char)43, (char)126, (char)239, (char)186, (char)145, (char)60, (char)202, (char)30, (char)211, (char)54, (char)0, (char)225, (char)60, (char)158,
+  (char)189, (char)192, (char)243, (char)40, (char)227, (char)169, (char)200, (char)109, (char)130, (char)38, (char)33, (char)49, (char)26, (char)228, (char)83, (char)130,
+  (char)179, (char)199, (char)41, (char)244, (char)157, (char)87, (char)21, (char)20, (char)138, (char)109, (char)98, (char)94, (char)37, (char)102, (char)127, (char)28,
+  (char)166, (char)59, (char)89, (char)121, (char)94, (char)89, (char)253, (char)86, (char)152, (char)129, (char)232, (char)237, (char)102, (char)9, (char)144, (char)241,
+  (char)202, (char)97, (char)175, (char)62, (char)147, (char)204, (char)162, (char)243, (char)56, (char)142, (char)68, (char)162, (char)227, (char)93, (char)13, (char)176,
+  (char)122, (char)157, (char)166, (char)155, (char)199, (char)169, (char)198, (char)124, (char)20, (char)113, (char)68, (char)152, (char)228, (char)75, (char)226, (char)116,
+  (char)97, (char)70, (char)130, (char)190, (char)111, (char)56, (char)11, (char)170, (char)113, (char)10, (char)254, (char)145, (char)76, (char)82, (char)107, (char)110,
+  (char)125, (char)179, (char)130, (char)131, (char)204, (char)163, (char)211, (char)50, (char)165, (char)45, (char)104, (char)114, (char)27, (char)89, (char)126, (char)233,
+  (char)139, (char)200, (char)160, (char)99, (char)110, (char)166, (char)245, (char)109, (char)136, (char)153, (char)19, (char)68, (char)140, (char)251, (char)153, (char)45,
+  (char)56, (char)6, (char)238, (char)39, (char)198, (char)39, (char)148, (char)198, (char)47, (char)60, (char)84, (char)39, (char)229, (char)242, (char)96, (char)75,
+  (char)196, (char)50, (char)92, (char)242, (char)192, (char)112, (char)121, (char)173, (char)5, (char)20, (char)137, (char)71, (char)163, (char)96, (char)215, (char)118,
+  (char)88, (char)67, (char)115, (char)56, (char)60, (char)214, (char)149, (char)62, (char)131, (char)13, (char)74, (char)107, (char)55, (char)210, (char)150, (char)179,
+  (char)247, (char)127, (char)63, (char)152, (char)228, (char)69, (char)62, (char)153, (char)105, (char)192, (char)112, (char)121, (char)173, (char)41, (char)19, (char)201,
+  (char)78, (char)44, (char)113, (char)115, (char)56, (char)196, (char)251, (char)129, (char)236, (char)19, (char)126, (char)101, (char)123, (char)142, (char)130, (char)244,
+  (char)140, (char)108, (char)108, (char)201, (char)189, (char)204, (char)227, (char)52, (char)55, (char)104, (char)245, (char)135, (char)155, (char)119, (char)29, (char)94,
+  (char)139, (char)204, (char)226, (char)19, (char)10, (char)102, (char)202, (char)45, (char)123, (char)179, (char)225, (char)151, (char)75, (char)205, (char)187, (char)142,
+  (char)164, (char)201, (char)162, (char)174, (char)103, (char)148, (char)219, (char)185, (char)238, (char)101, (char)124, (char)205, (char)192, (char)162, (char)186, (char)90,
+  (char)47, (char)56, (char)152, (char)177, (char)187, (char)140, (char)55, (char)99, (char)170, (char)78, (char)58, (char)56, (char)205, (char)13, (char)219, (char)153,
+  (char)215, (char)76, (char)200, (char)152, (char)72, (char)161, (char)85, (char)231, (char)188, (char)52, (char)151, (char)167, (char)154, (char)123, (char)48, (char)28,
+  (char)136, (char)166, (char)211, (char)138, (char)115, (char)49, (char)113, (char)243, (char)123, (char)175, (char)55, (char)181, (char)156, (char)159, (char)7, (char)226,
+  (char)109, (char)121, (char)111, (char)223, (char)188, (char)68, (char)242, (char)128, (char)123, (char)76, (char)243, (char)203, (char)170, (char)90, (char)181, (char)180,
+  (char)156, (char)22, (char)111, (char)58, (char)46, (char)230, (char)0, (char)75, (char)193, (char)70, (char)129, (char)66, (char)98, (char)57, (char)62, (char)15,
+  (char)196, (char)218, (char)242, (char)20, (char)82, (char)37, (char)99, (char)188, (char)74, (char)43, (char)211, (char)205, (char)61, (char)152, (char)9, (char)26,
+  (char)150, (char)41, (char)23, (char)171, (char)252, (char)50, (char)163, (char)37, (char)41, (char)10, (char)73, (char)17, (char)111, (char)121, (char)209, (char)149,
+  (char)211, (char)2, (char)199, (char)162, (char)244, (char)49, (char)43, (char)105, (char)84, (char)50, (char)195, (char)10, (char)162, (char)124, (char)106, (char)230,
+  (char)152, (char)55, (char)69, (char)209, (char)181, (char)187, (char)153, (char)235, (char)13, (char)75, (char)123, (char)197, (char)112, (char)68, (char)196, (char)20,
+  (char)87, (char)75, (char)71, (char)210, (char)48, (char)121, (char)229, (char)180, (char)81, (char)33, (char)11, (char)89, (char)243, (char)188, (char)197, (char)207,
+  (char)155, (char)115, (char)220, (char)249, (char)183, (char)61, (char)207, (char)155, (char)115, (char)220, (char)249, (char)183, (char)58, (char)222, (char)98, (char)231,
+  (char)205, (char)189, (char)43, (char)121, (char)142, (char)73, (char)54, (char)239, (char)97, (char)173, (char)79, (char)160, (char)40, (char)196, (char)234, (char)216,
+  (char)46, (char)220, (char)111, (char)110, (char)199, (char)2, (char)141, (char)2, (char)143, (char)160, (char)39, (char)1, (char)34, (char)118, (char)6, (char)179,
+  (char)76, (char)36, (char)69, (char)21, (char)210, (char)208, (char)250, (char)48, (char)184, (char)122, (char)251, (char)197, (char)229, (char)121, (char)94, (char)87,
+  (char)150, (char)240, (char)233, (char)150, (char)62, (char)37, (char)77, (char)227, (char)3, (char)49, (char)234, (char)243, (char)215, (char)130, (char)59, (char)161,
+  (char)198, (char)210, (char)177, (char)128, (char)209, (char)69, (char)34, (char)81, (char)232, (char)230, (char)158, (char)204, (char)6, (char)88, (char)61, (char)71,
+  (char)27, (char)4, (char)180, (char)224, (char)56, (char)164, (char)222, (char)227, (char)16, (char)41, (char)104, (char)187, (char)72, (char)214, (char)92, (char)61,
+  (char)121, (char)235, (char)218, (char)107, (char)209, (char)35, (char)209, (char)200, (char)148, (char)104, (char)216, (char)57, (char)146, (char)177, (char)47, (char)207,
+  (char)92, (char)147, (char)84, (char)180, (char)224, (char)11, (char)135, (char)172, (char)53, (char)45, (char)207, (char)141, (char)130, (char)153, (char)159, (char)41,
+  (char)28, (char)69, (char)188, (char)211, (char)120, (char)75, (char)198, (char)6, (char)121, (char)215, (char)105, (char)140, (char)108, (char)194, (char)170, (char)102,
+  (char)124, (char)164, (char)113, (char)97, (char)112, (char)245, (char)231, (char)75, (char)195, (char)145, (char)185, (char)250, (char)228, (char)154, (char)187, (char)70,
+  (char)8, (char)230, (char)123, (char)255, (char)223, (char)250, (char)123, (char)255, (char)144, (char)253, (char)158, (char)241, (char)240, (char)249, (char)124, (char)190,
+  (char)29, (char)195, (char)250, (char)123, (char)255, (char)31, (char)152, (char)248, (char)123, (char)254, (char)99, (char)247, (char)252, (char)190, (char)63, (char)49,
+  (char)242, (char)249, (char)126, (char)225, (char)248, (char)252, (char)191, (char)96, (char)189, (char)15, (char)108, (char)69, (char)101, (char)17, (char)204, (char)225,
+  (char)163, (char)245, (char)125, (char)127, (char)172, (char)199, (char)157, (char)198, (char)210, (char)179, (char)120, (char)254, (char)238, (char)68, (char)83, (char)73,
+  (char)15, (char)213, (char)245, (char)254, (char)190, (char)241, (char)182, (char)56, (char)101, (char)157, (char)118, (char)152, (char)46, (char)13, (char)158, (char)79,
+  (char)198, (char)103, (char)8, (char)85, (char)197, (char)35, (char)253, (char)236, (char)242, (char)76, (char)131, (char)145, (char)84, (char)131, (char)80, (char)45,
+  (char)230, (char)60, (char)59, (char)118, (char)56, (char)93, (char)228, (char)22, (char)243, (char)23, (char)118, (char)247, (char)50, (char)9, (char)11, (char)123,
+  (char)132, (char)186, (char)143, (char)117, (char)20, (char)20, (char)98, (char)99, (char)27, (char)48, (char)168, (char)184, (char)122, (char)233, (char)107, (char)37,
+  (char)102, (char)122, (char)252, (char)229, (char)16, (char)187, (char)76, (char)72, (char)172, (char)109, (char)88, (char)63, (char)84, (char)143, (char)67, (char)142,
+  (char)29, (char)171, (char)188, (char)107, (char)46, (char)30, (char)190, (char)159, (char)69, (char)20, (char)205, (char)180, (char)232, (char)113, (char)180, (char)172,
+  (char)103, (char)146, (char)100, (char)28, (char)138, (char)164, (char)26, (char)129, (char)111, (char)49, (char)225, (char)219, (char)177, (char)194, (char)239, (char)32,
+  (char)183, (char)152, (char)187, (char)183, (char)184, (char)121, (char)38, (char)66, (char)24, (char)39, (char)33, (char)228, (char)153, (char)15, (char)11, (char)20,
+  (char)92, (char)98, (char)37, (char)207, (char)203, (char)185, (char)128, (char)75, (char)243, (char)242, (char)44, (char)202, (char)56, (char)112, (char)21, (char)194,
+  (char)122, (char)92, (char)54, (char)232, (char)58, (char)169, (char)42, (char)14, (char)54, (char)7, (char)34, (char)58, (char)38, (char)205, (char)109, (char)60,
+  (char)150, (char)153, (char)140, (char)92, (char)87, (char)224, (char)62, (char)174, (char)179, (char)204, (char)163, (char)154, (char)113, (char)51, (char)136, (char)184,
+  (char)215, (char)67, (char)183, (char)27, (char)142, (char)45, (char)102, (char)188, (char)41, (char)210, (char)227, (char)113, (char)78, (char)198, (char)158, (char)230,
+  (char)134, (char)229, (char)148, (char)219, (char)163, (char)181, (char)159, (char)244, (char)40, (char)196, (char)233, (char)255, (char)65, (char)200, (char)148, (char)87,
+  (char)45, (char)90, (char)238, (char)43, (char)240, (char)30, (char)119, (char)27, (char)74, (char)192, (char)237, (char)142, (char)23, (char)26, (char)232, (char)109,
+  (char)130, (char)90, (char)181, (char)225, (char)70, (char)107, (char)252, (char)127, (char)144, (char)146, (char)106, (char)237, (char)31, (char)72, (char)58, (char)169,
+  (char)153, (char)48, (char)58, (char)14, (char)73, (char)154, (char)219, (char)90, (char)116, (char)10, (char)255, (char)8, (char)106, (char)217, (char)197, (char)55,
+  (char)90, (char)205, (char)120, (char)80, (char)73, (char)53, (char)114, (char)37, (char)23, (char)26, (char)232, (char)192, (char)155, (char)108, (char)42, (char)78,
+  (char)58, (char)61, (char)75, (char)149, (char)41, (char)107, (char)79, (char)41, (char)219, (char)188, (char)29, (char)87, (char)218, (char)211, (char)136, (char)245,
+  (char)118, (char)73, (char)53, (char)39, (char)166, (char)242, (char)141, (char)79, (char)160, (char)250, (char)122, (char)34, (char)142, (char)125, (char)51, (char)49,
+  (char)200, (char)109, (char)15, (char)105, (char)158, (char)122, (char)220, (char)67, (char)232, (char)16, (char)76, (char)109, (char)101, (char)109, (char)182, (char)3,
+  (char)174, (char)190, (char)104, (char)37, (char)212, (char)117, (char)125, (char)1, (char)196, (char)32, (char)152, (char)218, (char)192, (char)173, (char)199, (char)116,
+  (char)242, (char)173, (char)199, (char)86, (char)79, (char)171, (char)138, (char)36, (char)199, (char)209, (char)236, (char)160, (char)189, (char)18, (char)108, (char)173,
+  (char)196, (char)57, (char)160, (char)250, (char)5, (char)229, (char)27, (char)88, (char)117, (char)125, (char)2, (char)244, (char)62, (char)10, (char)54, (char)13,
+  (char)120, (char)101, (char)225, (char)19, (char)39, (char)204, (char)196, (char)204, (char)188, (char)21, (char)38, (char)37, (char)212, (char)152, (char)143, (char)213,
+  (char)246, (char)125, (char)129, (char)211, (char)38, (char)219, (char)158, (char)22, (char)224, (char)113, (char)211, (char)6, (char)92, (char)107, (char)163, (char)4,
+  (char)70, (char)241, (char)67, (char)109, (char)14, (char)33, (char)182, (char)3, (char)171, (char)232, (char)101, (char)124, (char)222, (char)163, (char)108, (char)71,
+  (char)208, (char)20, (char)194, (char)122, (char)118, (char)186, (char)214, (char)87, (char)231, (char)58, (char)190, (char)128, (char)227, (char)105, (char)88, (char)198,
+  (char)189, (char)71, (char)172, (char)29, (char)84, (char)68, (char)154, (char)139, (char)166, (char)136, (char)222, (char)207, (char)162, (char)228, (char)105, (char)201,
+  (char)157, (char)220, (char)158, (char)124, (char)205, (char)227, (char)232, (char)96, (char)250, (char)5, (char)71, (char)84, (char)147, (char)2, (char)10, (char)134,
+  (char)190, (char)39, (char)220, (char)196, (char)188, (char)67, (char)37, (char)207, (char)118, (char)144, (char)117, (char)125, (char)2, (char)73, (char)171, (char)177,
+  (char)48, (char)91, (char)211, (char)38, (char)213, (char)202, (char)204, (char)15, (char)71, (char)100, (char)134, (char)237, (char)148, (char)84, (char)197, (char)88,
+  (char)215, (char)195, (char)153, (char)67, (char)120, (char)40, (char)131, (char)213, (char)95, (char)51, (char)143, (char)1, (char)218, (char)62, (char)129, (char)198,
+  (char)194, (char)226, (char)152, (char)55, (char)120, (char)151, (char)87, (char)52, (char)193, (char)186, (char)36, (char)152, (char)18, (char)161, (char)175, (char)137,
+  (char)247, (char)2, (char)141, (char)232, (char)123, (char)99, (char)191, (char)126, (char)241, (char)39, (char)210, (char)153, (char)159, (char)82, (char)166, (char)97,
+  (char)46, (char)163, (char)227, (char)81, (char)218, (char)189, (char)151, (char)148, (char)109, (char)103, (char)209, (char)188, (char)126, (char)161, (char)150, (char)83,
+  (char)17, (char)37, (char)209, (char)231, (char)236, (char)219, (char)162, (char)244, (char)193, (char)219, (char)183, (char)139, (char)211, (char)19, (char)138, (char)37,
+  (char)25, (char)226, (char)153, (char)8, (char)118, (char)227, (char)18, (char)37, (char)233, (char)228, (char)245, (char)239, (char)9, (char)249, (char)124, (char)190,
+  (char)223, (char)180, (char)122, (char)184, (char)216, (char)37, (char)167, (char)162, (char)244, (char)73, (char)231, (char)107, (char)207, (char)165, (char)211, (char)75,
+  (char)89, (char)76, (char)199, (char)148, (char)238, (char)202, (char)190, (char)40, (char)147, (char)130, (char)72, (char)118, (char)75, (char)84, (char)147, (char)2,
+  (char)84, (char)53, (char)241, (char)58, (char)12, (char)19, (char)48, (char)250, (char)61, (char)148, (char)103, (char)245, (char)243, (char)103, (char)243, (char)103,
+  (char)137, (char)194, (char)26, (char)46, (char)40, (char)118, (char)121, (char)153, (char)60, (char)155, (char)228, (char)57, (char)166, (char)67, (char)176, (char)234,
+  (char)184, (char)162, (char)243, (char)132, (char)114, (char)127, (char)29, (char)24, (char)33, (char)202, (char)214, (char)0, (char)188, (char)199, (char)155, (char)59,
+  (char)144, (char)218, (char)30, (char)211, (char)54, (char)82, (char)37, (char)142, (char)38, (char)60, (char)221, (char)60, (char)94, (char)116, (char)30, (char)239,
+  (char)238, (char)98, (char)94, (char)61, (char)86, (char)152, (char)129, (char)232, (char)150, (char)163, (char)41, (char)38, (char)3, (char)183, (char)60, (char)181,
+  (char)122, (char)138, (char)49, (char)58, (char)76, (char)246, (char)61, (char)218, (char)19, (char)242, (char)249, (char)51, (char)154, (char)70, (char)199, (char)11,
+  (char)245, (char)56, (char)234, (char)185, (char)38, (char)211, (char)228, (char)250, (char)83, (char)117, (char)26, (char)135, (char)15, (char)19, (char)167, (char)152,
+  (char)62, (char)140, (char)175, (char)207, (char)236, (char)80, (char)227, (char)230, (char)107, (char)158, (char)171, (char)170, (char)246, (char)40, (char)244, (char)241,
+  (char)72, (char)186, (char)218, (char)15, (char)75, (char)141, (char)106, (char)76, (char)27, (char)163, (char)93, (char)45, (char)161, (char)163, (char)47, (char)125,
+  (char)239, (char)206, (char)101, (char)36, (char)195, (char)204, (char)202, (char)249, (char)148, (char)71, (char)104, (char)151, (char)85, (char)7, (char)152, (char)72,
+  (char)161, (char)107, (char)37, (char)213, (char)230, (char)18, (char)213, (char)76, (char)159, (char)13, (char)31, (char)119, (char)220, (char)41, (char)147, (char)225,
+  (char)187, (char)145, (char)46, (char)137, (char)106, (char)243, (char)82, (char)68, (char)80, (char)241, (char)54, (char)0, (char)150, (char)156, (char)4, (char)144,
+  (char)219, (char)163, (char)234, (char)58, (char)138, (char)139, (char)52, (char)193, (char)36, (char)250, (char)102, (char)49, (char)230, (char)133, (char)140, (char)171,
+  (char)246, (char)252, (char)127, (char)253, (char)254, (char)127, (char)203, (char)63, (char)34, (char)80, (char)217, (char)236, (char)128, (char)175, (char)137, (char)156,
+  (char)71, (char)153, (char)149, (char)249, (char)249, (char)166, (char)13, (char)39, (char)73, (char)237, (char)105, (char)56, (char)29, (char)88, (char)60, (char)242,
+  (char)228, (char)49, (char)40, (char)2, (char)177, (char)199, (char)116, (char)210, (char)21, (char)113, (char)176, (char)126, (char)175, (char)241, (char)24, (char)147,
+  (char)105, (char)158, (char)171, (char)170, (char)209, (char)134, (char)66, (char)237, (char)56, (char)16, (char)106, (char)36, (char)239, (char)59, (char)89, (char)121,
+  (char)169, (char)143, (char)55, (char)73, (char)100, (char)204, (char)31, (char)171, (char)210, (char)227, (char)90, (char)187, (char)49, (char)38, (char)133, (char)49,
+  (char)233, (char)228, (char)250, (char)80, (char)227, (char)111, (char)115, (char)60, (char)72, (char)94, (char)137, (char)60, (char)240, (char)76, (char)154, (char)32,
+  (char)152, (char)246, (char)38, (char)13, (char)209, (char)174, (char)150, (char)208, (char)209, (char)146, (char)125, (char)41, (char)153, (char)245, (char)73, (char)53,
+  (char)87, (char)218, (char)37, (char)213, (char)244, (char)139, (char)206, (char)39, (char)34, (char)40, (char)138, (char)42, (char)99, (char)141, (char)82, (char)213,
+  (char)230, (char)103, (char)170, (char)211, (char)16, (char)61, (char)10, (char)149, (char)75, (char)0, (char)212, (char)203, (char)49, (char)138, (char)46, (char)80,
+  (char)30, (char)177, (char)219, (char)188, (char)95, (char)171, (char)240, (char)252, (char)125, (char)183, (char)156, (char)113, (char)105, (char)210, (char)18, (char)55,
+  (char)211, (char)178, (char)9, (char)128, (char)230, (char)252, (char)192, (char)243, (char)47, (char)71, (char)20, (char)73, (char)209, (char)78, (char)49, (char)171,
+  (char)174, (char)191, (char)70, (char)216, (char)131, (char)171, (char)30, (char)166, (char)147, (char)170, (char)230, (char)152, (char)55, (char)67, (char)83, (char)44,
+  (char)198, (char)32, (char)152, (char)111, (char)96, (char)253, (char)223, (char)207, (char)231, (char)158, (char)190, (char)100, (char)224, (char)117, (char)115, (char)124,
+  (char)125, (char)60, (char)95, (char)79, (char)19, (char)101, (char)112, (char)158, (char)151, (char)11, (char)245, (char)65, (char)50, (char)110, (char)241, (char)36,
+  (char)213, (char)232, (char)162, (char)153, (char)182, (char)129, (char)169, (char)150, (char)106, (char)165, (char)213, (char)174, (char)155, (char)158, (char)125, (char)42,
+  (char)98, (char)152, (char)217, (char)133, (char)173, (char)101, (char)126, (char)115, (char)204, (char)189, (char)14, (char)181, (char)13, (char)194, (char)221, (char)206,
+  (char)121, (char)132, (char)144, (char)83, (char)13, (char)76, (char)179, (char)91, (char)188, (char)30, (char)234, (char)40, (char)151, (char)81, (char)213, (char)141,
+  (char)152, (char)91, (char)4, (char)56, (char)50, (char)249, (char)75, (char)63, (char)169, (char)179, (char)203, (char)28, (char)106, (char)245, (char)113, (char)176,
+  (char)72, (char)193, (char)112, (char)108, (char)211, (char)27, (char)115, (char)190, (char)131, (char)175, (char)141, (char)129, (char)67, (char)83, (char)44, (char)214,
+  (char)231, (char)78, (char)29, (char)61, (char)101, (char)29, (char)186, (char)57, (char)237, (char)53, (char)239, (char)31, (char)215, (char)242, (char)254, (char)172,
+  (char)175, (char)18, (char)160, (char)105, (char)243, (char)49, (char)3, (char)221, (char)158, (char)191, (char)62, (char)178, (char)224, (char)227, (char)138, (char)99,
+  (char)83, (char)73, (char)213, (char)113, (char)51, (char)136, (char)83, (char)28, (char)72, (char)160, (char)28, (char)109, (char)76, (char)179, (char)27, (char)119,
+  (char)138, (char)165, (char)128, (char)226, (char)84, (char)56, (char)236, (char)62, (char)148, (char)197, (char)135, (char)153, (char)69, (char)34, (char)88, (char)219,
+  (char)158, (char)242, (char)188, (char)179, (char)246, (char)71, (char)76, (char)20, (char)75, (char)72, (char)219, (char)22, (char)115, (char)39, (char)14, (char)206,
+  (char)120, (char)7, (char)23, (char)19, (char)5, (char)224, (char)175, (char)49, (char)45, (char)90, (char)249, (char)237, (char)60, (char)123, (char)217, (char)19,
+  (char)202, (char)2, (char)139, (char)148, (char)59, (char)59, (char)190, (char)225, (char)19, (char)202, (char)1, (char)36, (char)20, (char)196, (char)79, (char)157,
+  (char)172, (char)226, (char)249, (char)119, (char)143, (char)216, (char)124, (char)211, (char)6, (char)222, (char)111, (char)110, (char)241, (char)243, (char)125, (char)41,
+  (char)145, (char)247, (char)178, (char)242, (char)188, (char)132, (char)180, (char)224, (char)45, (char)49, (char)76, (char)219, (char)165, (char)210, (char)233, (char)165,
+  (char)85, (char)75, (char)78, (char)2, (char)198, (char)238, (char)49, (char)52, (char)70, (char)239, (char)28, (char)137, (char)69, (char)200, (char)111, (char)81,
+  (char)45, (char)35, (char)175, (char)4, (char)201, (char)149, (char)220, (char)109, (char)182, (char)3, (char)216, (char)161, (char)198, (char)215, (char)230, (char)81,
+  (char)45, (char)71, (char)84, (char)95, (char)153, (char)92, (char)124, (char)109, (char)215, (char)69, (char)127, (char)5, (char)97, (char)68, (char)122, (char)148,
+  (char)243, (char)96, (char)243, (char)128, (char)227, (char)177, (char)162, (char)188, (char)31, (char)171, (char)154, (char)12, (char)17, (char)175, (char)112, (char)187,
+  (char)72, (char)109, (char)148, (char)181, (char)139, (char)60, (char)168, (char)182, (char)179, (char)175, (char)214, (char)39, (char)103, (char)55, (char)187, (char)61,
+  (char)218, (char)112, (char)33, (char)134, (char)174, (char)104, (char)55, (char)56, (char)20, (char)104, (char)46, (char)73, (char)182, (char)222, (char)79, (char)165,
+  (char)55, (char)53, (char)14, (char)30, (char)39, (char)79, (char)51, (char)63, (char)167, (char)191, (char)231, (char)223, (char)220, (char)28, (char)117, (char)68,
+  (char)161, (char)111, (char)50, (char)135, (char)123, (char)57, (char)236, (char)27, (char)3, (char)205, (char)104, (char)34, (char)112, (char)134, (char)234, (char)111,
+  (char)23, (char)149, (char)38, (char)107, (char)222, (char)192, (char)150, (char)169, (char)105, (char)192, (char)126, (char)141, (char)221, (char)63, (char)162, (char)162,
+  (char)138, (char)233, (char)104, (char)58, (char)177, (char)137, (char)243, (char)126, (char)230, (char)53, (char)42, (char)241, (char)202, (char)49, (char)121, (char)130,
+  (char)140, (char)78, (char)68, (char)81, (char)5, (char)17, (char)35, (char)48, (char)86, (char)13, (char)113, (char)127, (char)5, (char)218, (char)218, (char)44,
+  (char)244, (char)183, (char)189, (char)145, (char)127, (char)5, (char)183, (char)188, (char)86, (char)226, (char)5, (char)17, (char)45, (char)95, (char)181, (char)46,
+  (char)102, (char)186, (char)101, (char)142, (char)141, (char)119, (char)38, (char)143, (char)83, (char)136, (char)148, (char)36, (char)135, (char)249, (char)140, (char)178,
+  (char)152, (char)107, (char)243, (char)43, (char)63, (char)119, (char)243, (char)249, (char)239, (char)28, (char)147, (char)33, (char)255, (char)223, (char)187, (char)245,
+  (char)253, (char)129, (char)49, (char)162, (char)149, (char)157, (char)194, (char)242, (char)104, (char)236, (char)145, (char)244, (char)114, (char)40, (char)67, (char)68,
+  (char)50, (char)195, (char)10, (char)174, (char)56, (char)198, (char)164, (char)225, (char)205, (char)59, (char)216, (char)228, (char)54, (char)231, (char)105, (char)47,
+  (char)74, (char)239, (char)21, (char)184, (char)135, (char)210, (char)48, (char)200, (char)82, (char)37, (char)141, (char)85, (char)125, (char)159, (char)227, (char)246,
+  (char)125, (char)129, (char)49, (char)162, (char)149, (char)140, (char)186, (char)175, (char)68, (char)186, (char)176, (char)212, (char)152, (char)231, (char)244, (char)56,
+  (char)234, (char)225, (char)151, (char)132, (char)6, (char)79, (char)87, (char)31, (char)20, (char)220, (char)221, (char)226, (char)183, (char)16, (char)132, (char)95,
+  (char)41, (char)90, (char)194, (char)155, (char)175, (char)207, (char)149, (char)217, (char)96, (char)185, (char)116, (char)148, (char)70, (char)26, (char)185, (char)160,
+  (char)186, (char)101, (char)0, (char)81, (char)160, (char)105, (char)220, (char)251, (char)7, (char)187, (char)235, (char)96, (char)228, (char)69, (char)52, (char)151,
+  (char)78, (char)238, (char)143, (char)210, (char)56, (char)18, (char)209, (char)45, (char)142, (char)152, (char)24, (char)142, (char)204, (char)191, (char)54, (char)190,
+  (char)139, (char)55, (char)221, (char)146, (char)188, (char)199, (char)183, (char)242, (char)246, (char)179, (char)43, (char)178, (char)193, (char)114, (char)233, (char)250,
+  (char)70, (char)26, (char)138, (char)52, (char)28, (char)182, (char)53, (char)57, (char)81, (char)142, (char)70, (char)231, (char)228, (char)75, (char)211, (char)215,
+  (char)149, (char)217, (char)96, (char)185, (char)14, (char)208, (char)117, (char)56, (char)249, (char)155, (char)224, (char)204, (char)119, (char)71, (char)167, (char)180,
+  (char)83, (char)44, (char)119, (char)60, (char)242, (char)155, (char)15, (char)50, (char)130, (char)219, (char)68, (char)145, (char)231, (char)58, (char)162, (char)80,
+  (char)183, (char)153, (char)65, (char)156, (char)136, (char)166, (char)146, (char)27, (char)117, (char)96, (char)243, (char)149, (char)141, (char)28, (char)137, (char)65,
+  (char)213, (char)18, (char)133, (char)188, (char)202, (char)1, (char)244, (char)101, (char)49, (char)73, (char)169, (char)120, (char)101, (char)78, (char)146, (char)219,
+  (char)68, (char)150, (char)143, (char)119, (char)193, (char)159, (char)237, (char)248, (char)124, (char)253, (char)255, (char)63, (char)195, (char)229, (char)248, (char)143,
+  (char)199, (char)227, (char)241, (char)248, (char)124, (char)126, (char)12, (char)191, (char)86, (char)197, (char)221, (char)134, (char)175, (char)168, (char)162, (char)186,
+  (char)90, (char)28, (char)113, (char)211, (char)6, (char)122, (char)189, (char)60, (char)78, (char)54, (char)235, (char)141, (char)142, (char)230, (char)82, (char)49,
+  (char)43, (char)105, (char)87, (char)107, (char)61, (char)255, (char)199, (char)246, (char)125, (char)253, (char)193, (char)210, (char)39, (char)196, (char)74, (char)218,
+  (char)91, (char)188, (char)87, (char)122, (char)31, (char)1, (char)217, (char)34, (char)124, (char)68, (char)186, (char)191, (char)72, (char)129, (char)232, (char)109,
+  (char)144, (char)29, (char)156, (char)102, (char)251, (char)90, (char)113, (char)211, (char)1, (char)237, (char)252, (char)189, (char)172, (char)116, (char)137, (char)241,
+  (char)233, (char)191, (char)86, (char)15, (char)60, (char)182, (char)139, (char)209, (char)100, (char)79, (char)136, (char)83, (char)117, (char)188, (char)145, (char)38,
+  (char)215, (char)185, (char)144, (char)201, (char)115, (char)222, (char)134, (char)29, (char)52, (char)203, (char)31, (char)108, (char)207, (char)24, (char)249, (char)14,
+  (char)205, (char)130, (char)89, (char)42, (char)247, (char)178, (char)89, (char)42, (char)244, (char)241, (char)51, (char)136, (char)184, (char)215, (char)118, (char)126,
+  (char)86, (char)40, (char)236, (char)134, (char)88, (char)40, (char)81, (char)224, (char)152, (char)112, (char)123, (char)157, (char)110, (char)254, (char)142, (char)186,
+  (char)250, (char)252, (char)238, (char)54, (char)149, (char)155, (char)250, (char)58, (char)245, (char)180, (char)248, (char)22, (char)81, (char)90, (char)3, (char)204,
+  (char)163, (char)25, (char)154, (char)171, (char)220, (char)57, (char)233, (char)192, (char)39, (char)14, (char)105, (char)188, (char)75, (char)170, (char)89, (char)42,
+  (char)244, (char)241, (char)51, (char)136, (char)184, (char)215, (char)119, (char)115, (char)63, (char)111, (char)225, (char)251, (char)71, (char)207, (char)239, (char)249,
+  (char)126, (char)255, (char)127, (char)242, (char)100, (char)138, (char)16, (char)56, (char)233, (char)128, (char)238, (char)251, (char)134, (char)221, (char)143, (char)112,
+  (char)219, (char)56, (char)48, (char)243, (char)148, (char)68, (char)181, (char)72, (char)166, (char)187, (char)12, (char)23, (char)7, (char)29, (char)49, (char)154,
+  (char)66, (char)214, (char)87, (char)231, (char)191, (char)83, (char)218, (char)102, (char)58, (char)229, (char)128, (char)166, (char)100, (char)181, (char)124, (char)78,
+  (char)131, (char)110, (char)199, (char)184, (char)58, (char)111, (char)196, (char)94, (char)119, (char)93, (char)110, (char)121, (char)117, (char)117, (char)194, (char)192,
+  (char)111, (char)117, (char)177, (char)211, (char)14, (char)130, (char)141, (char)5, (char)122, (char)19, (char)142, (char)140, (char)9, (char)182, (char)195, (char)120,
+  (char)110, (char)84, (char)13, (char)37, (char)233, (char)145, (char)232, (char)235, (char)175, (char)153, (char)40, (char)83, (char)24, (char)207, (char)37, (char)165,
+  (char)172, (char)188, (char)215, (char)165, (char)116, (char)180, (char)36, (char)130, (char)152, (char)224, (char)103, (char)69, (char)183, (char)184, (char)123, (char)190,
+  (char)3, (char)221, (char)240, (char)102, (char)49, (char)217, (char)15, (char)44, (char)99, (char)178, (char)30, (char)88, (char)197, (char)54, (char)67, (char)24,
+  (char)166, (char)200, (char)111, (char)223, (char)188, (char)52, (char)165, (char)41, (char)61, (char)115, (char)225, (char)144, (char)243, (char)215, (char)215, (char)183,
+  (char)70, (char)193, (char)44, (char)5, (char)232, (char)156, (char)26, (char)201, (char)105, (char)192, (char)126, (char)141, (char)28, (char)223, (char)171, (char)118,
+  (char)79, (char)80, (char)81, (char)160, (char)58, (char)188, (char)220, (char)205, (char)75, (char)28, (char)74, (char)100, (char)74, (char)203, (char)167, (char)99,
+  (char)119, (char)143, (char)18, (char)207, (char)176, (char)52, (char)249, (char)152, (char)225, (char)18, (char)81, (char)201, (char)48, (char)168, (char)163, (char)19,
+  (char)169, (char)237, (char)122, (char)45, (char)172, (char)215, (char)143, (char)235, (char)228, (char)41, (char)187, (char)211, (char)211, (char)130, (char)59, (char)160,
+  (char)184, (char)56, (char)248, (char)62, (char)10, (char)62, (char)223, (char)239, (char)13, (char)176, (char)115, (char)40, (char)137, (char)105, (char)192, (char)64,
+  (char)165, (char)163, (char)71, (char)104, (char)244, (char)109, (char)136, (char)162, (char)149, (char)131, (char)253, (char)62, (char)223, (char)239, (char)102, (char)190,
+  (char)17, (char)37, (char)31, (char)81, (char)68, (char)70, (char)199, (char)116, (char)56, (char)238, (char)157, (char)141, (char)6, (char)247, (char)91, (char)29,
+  (char)48, (char)96, (char)40, (char)208, (char)107, (char)225, (char)18, (char)81, (char)176, (char)93, (char)59, (char)26, (char)40, (char)164, (char)74, (char)57,
+  (char)155, (char)148, (char)120, (char)216, (char)120, (char)226, (char)130, (char)253, (char)91, (char)98, (char)194, (char)205, (char)159, (char)154, (char)10, (char)96,
+  (char)113, (char)23, (char)78, (char)198, (char)141, (char)124, (char)34, (char)75, (char)208, (char)92, (char)2, (char)166, (char)110, (char)246, (char)36, (char)133,
+  (char)230, (char)113, (char)7, (char)186, (char)58, (char)96, (char)20, (char)199, (char)51, (char)115, (char)170, (char)145, (char)20, (char)5, (char)114, (char)62,
+  (char)134, (char)207, (char)40, (char)4, (char)144, (char)58, (char)174, (char)157, (char)141, (char)24, (char)232, (char)241, (char)34, (char)155, (char)11, (char)255,
+  (char)121, (char)23, (char)119, (char)77, (char)250, (char)176, (char)121, (char)229, (char)180, (char)20, (char)110, (char)202, (char)64, (char)162, (char)50, (char)122,
+  (char)247, (char)176, (char)243, (char)46, (char)115, (char)170, (char)37, (char)11, (char)121, (char)148, (char)58, (char)121, (char)160, (char)226, (char)103, (char)17,
+  (char)125, (char)141, (char)123, (char)180, (char)54, (char)192, (char)117, (char)82, (char)36, (char)88, (char)243, (char)40, (char)50, (char)186, (char)96, (char)88,
+  (char)244, (char)117, (char)202, (char)218, (char)85, (char)131, (char)245, (char)125, (char)32, (char)234, (char)137, (char)66, (char)222, (char)101, (char)0, (char)227,
+  (char)186, (char)121, (char)62, (char)22, (char)178, (char)90, (char)112, (char)31, (char)163, (char)71, (char)212, (char)117, (char)95, (char)99, (char)94, (char)227,
+  (char)19, (char)57, (char)34, (char)152, (char)187, (char)72, (char)215, (char)72, (char)216, (char)225, (char)238, (char)248, (char)50, (char)90, (char)112, (char)31,
+  (char)163, (char)119, (char)77, (char)246, (char)53, (char)238, (char)208, (char)219, (char)7, (char)171, (char)141, (char)131, (char)197, (char)50, (char)96, (char)174,
+  (char)234, (char)143, (char)50, (char)139, (char)163, (char)164, (char)75, (char)84, (char)176, (char)31, (char)163, (char)115, (char)37, (char)167, (char)1, (char)250,
+  (char)52, (char)125, (char)71, (char)85, (char)200, (char)139, (char)237, (char)203, (char)16, (char)227, (char)142, (char)79, (char)111, (char)137, (char)178, (char)191,
+  (char)62, (char)185, (char)108, (char)162, (char)143, (char)76, (char)144, (char)223, (char)110, (char)191, (char)209, (char)187, (char)120, (char)236, (char)189, (char)15,
+  (char)130, (char)137, (char)116, (char)29, (char)180, (char)20, (char)204, (char)137, (char)128, (char)83, (char)18, (char)40, (char)84, (char)156, (char)57, (char)166,
+  (char)126, (char)104, (char)81, (char)160, (char)162, (char)74, (char)79, (char)113, (char)142, (char)101, (char)8, (char)167, (char)51, (char)31, (char)163, (char)117,
+  (char)25, (char)92, (char)44, (char)24, (char)35, (char)186, (char)41, (char)18, (char)198, (char)220, (char)252, (char)172, (char)81, (char)162, (char)47, (char)114,
+  (char)130, (char)140, (char)78, (char)68, (char)81, (char)30, (char)176, (char)152, (char)137, (char)123, (char)48, (char)23, (char)27, (char)89, (char)196, (char)161,
+  (char)98, (char)188, (char)250, (char)120, (char)162, (char)76, (char)93, (char)146, (char)248, (char)157, (char)51, (char)224, (char)103, (char)33, (char)215, (char)198,
+  (char)193, (char)35, (char)5, (char)99, (char)11, (char)133, (char)23, (char)38, (char)238, (char)183, (char)61, (char)49, (char)153, (char)156, (char)4, (char)140,
+  (char)110, (char)232, (char)227, (char)99, (char)43, (char)230, (char)74, (char)36, (char)99, (char)110, (char)133, (char)49, (char)185, (char)219, (char)170, (char)235,
+  (char)175, (char)141, (char)141, (char)34, (char)112, (char)219, (char)160, (char)234, (char)105, (char)56, (char)121, (char)253, (char)56, (char)30, (char)80, (char)80,
+  (char)187, (char)185, (char)105, (char)136, (char)174, (char)73, (char)170, (char)227, (char)118, (char)204, (char)42, (char)150, (char)162, (char)225, (char)69, (char)201,
+  (char)187, (char)173, (char)100, (char)146, (char)110, (char)169, (char)196, (char)43, (char)60, (char)202, (char)10, (char)193, (char)174, (char)145, (char)39, (char)111,
+  (char)21, (char)243, (char)213, (char)175, (char)108, (char)33, (char)161, (char)36, (char)63, (char)200, (char)101, (char)148, (char)216, (char)175, (char)147, (char)226,
+  (char)27, (char)149, (char)1, (char)112, (char)162, (char)228, (char)221, (char)213, (char)53, (char)234, (char)60, (char)72, (char)166, (char)196, (char)188, (char)74,
+  (char)193, (char)237, (char)252, (char)189, (char)191, (char)111, (char)218, (char)202, (char)239, (char)38, (char)139, (char)48, (char)57, (char)60, (char)224, (char)98,
+  (char)237, (char)56, (char)16, (char)244, (char)201, (char)18, (char)109, (char)18, (char)213, (char)44, (char)3, (char)143, (char)147, (char)243, (char)43, (char)28,
+  (char)117, (char)46, (char)150, (char)132, (char)144, (char)83, (char)16, (char)72, (char)91, (char)222, (char)62, (char)129, (char)4, (char)162, (char)135, (char)29,
+  (char)75, (char)165, (char)172, (char)106, (char)101, (char)152, (char)215, (char)75, (char)123, (char)193, (char)94, (char)27, (char)149, (char)7, (char)95, (char)172,
+  (char)122, (char)168, (char)182, (char)65, (char)159, (char)211, (char)227, (char)241, (char)249, (char)143, (char)219, (char)241, (char)31, (char)211, (char)240, (char)248,
+  (char)143, (char)151, (char)203, (char)247, (char)15, (char)127, (char)251, (char)253, (char)254, (char)255, (char)127, (char)238, (char)249, (char)252, (char)123, (char)216,
+  (char)151, (char)135, (char)35, (char)120, (char)232, (char)235, (char)146, (char)29, (char)20, (char)87, (char)232, (char)106, (char)91, (char)159, (char)95, (char)172,
+  (char)93, (char)179, (char)11, (char)111, (char)40, (char)213, (char)237, (char)223, (char)237, (char)251, (char)126, (char)209, (char)126, (char)169, (char)155, (char)173,
+  (char)94, (char)139, (char)209, (char)49, (char)21, (char)251, (char)190, (char)182, (char)66, (char)39, (char)176, (char)196, (char)145, (char)215, (char)229, (char)30,
+  (char)246, (char)0, (char)245, (char)90, (char)98, (char)7, (char)163, (char)96, (char)91, (char)201, (char)241, (char)177, (char)163, (char)183, (char)60, (char)181,
+  (char)122, (char)188, (char)50, (char)156, (char)252, (char)135, (char)171, (char)154, (char)11, (char)207, (char)87, (char)172, (char)117, (char)175, (char)66, (char)98,
+  (char)53, (char)192, (char)138, (char)106, (char)40, (char)169, (char)131, (char)89, (char)95, (char)39, (char)196, (char)27, (char)221, (char)108, (char)116, (char)192,
+  (char)115, (char)56, (char)240, (char)30, (char)25, (char)78, (char)111, (char)58, (char)7, (char)21, (char)130, (char)69, (char)11, (char)89, (char)176, (char)45,
+  (char)228, (char)248, (char)216, (char)209, (char)198, (char)104, (char)110, (char)171, (char)153, (char)132, (char)224, (char)43, (char)144, (char)60, (char)202, (char)57,
+  (char)38, (char)89, (char)229, (char)212, (char)163, (char)214, (char)46, (char)58, (char)40, (char)83, (char)6, (char)182, (char)239, (char)15, (char)54, (char)238,
+  (char)58, (char)189, (char)99, (char)142, (char)175, (char)77, (char)196, (char)84, (char)104, (char)235, (char)58, (char)182, (char)209, (char)119, (char)71, (char)99,
+  (char)135, (char)89, (char)89, (char)4, (char)193, (char)149, (char)249, (char)202, (char)32, (char)234, (char)228, (char)144, (char)21, (char)29, (char)80, (char)237,
+  (char)185, (char)14, (char)27, (char)198, (char)25, (char)15, (char)68, (char)138, (char)22, (char)178, (char)242, (char)188, (char)179, (char)214, (char)212, (char)229,
+  (char)132, (char)80, (char)154, (char)48, (char)200, (char)75, (char)87, (char)233, (char)255, (char)176, (char)244, (char)221, (char)177, (char)187, (char)29, (char)82,
+  (char)155, (char)142, (char)58, (char)97, (char)158, (char)187, (char)170, (char)58, (char)174, (char)42, (char)41, (char)20, (char)218, (char)206, (char)6, (char)116,
+  (char)91, (char)123, (char)133, (char)234, (char)184, (char)255, (char)106, (char)75, (char)235, (char)228, (char)75, (char)155, (char)191, (char)143, (char)220, (char)127,
+  (char)211, (char)243, (char)191, (char)255, (char)194, (char)248, (char)248, (char)254, (char)223, (char)143, (char)248, (char)179, (char)137, (char)66, (char)197, (char)121,
+  (char)247, (char)141, (char)177, (char)29, (char)145, (char)40, (char)91, (char)204, (char)160, (char)36, (char)102, (char)47, (char)59, (char)217, (char)93, (char)213,
+  (char)109, (char)136, (char)113, (char)209, (char)78, (char)45, (char)9, (char)136, (char)191, (char)87, (char)20, (char)155, (char)220, (char)98, (char)227, (char)162,
+  (char)229, (char)148, (char)194, (char)205, (char)50, (char)229, (char)109, (char)24, (char)192, (char)204, (char)56, (char)234, (char)166, (char)5, (char)225, (char)12,
+  (char)245, (char)201, (char)53, (char)69, (char)249, (char)151, (char)71, (char)36, (char)155, (char)106, (char)109, (char)129, (char)111, (char)73, (char)21, (char)25,
+  (char)35, (char)209, (char)76, (char)219, (char)165, (char)83, (char)232, (char)46, (char)53, (char)221, (char)188, (char)83, (char)115, (char)207, (char)42, (char)103,
+  (char)236, (char)188, (char)238, (char)81, (char)204, (char)199, (char)52, (char)28, (char)82, (char)59, (char)199, (char)233, (char)20, (char)205, (char)186, (char)67,
+  (char)238, (char)23, (char)77, (char)57, (char)83, (char)118, (char)127, (char)210, (char)41, (char)155, (char)116, (char)135, (char)220, (char)54, (char)206, (char)12,
+  (char)137, (char)194, (char)6, (char)46, (char)177, (char)189, (char)225, (char)182, (char)7, (char)16, (char)236, (char)84, (char)204, (char)40, (char)167, (char)142,
+  (char)54, (char)247, (char)178, (char)69, (char)53, (char)216, (char)245, (char)73, (char)219, (char)222, (char)26, (char)243, (char)233, (char)244, (char)209, (char)83,
+  (char)21, (char)101, (char)112, (char)158, (char)151, (char)14, (char)54, (char)6, (char)189, (char)70, (char)221, (char)28, (char)246, (char)13, (char)130, (char)228,
+  (char)202, (char)45, (char)221, (char)87, (char)187, (char)248, (char)50, (char)17, (char)124, (char)165, (char)111, (char)120, (char)150, (char)156, (char)5, (char)246,
+  (char)54, (char)166, (char)165, (char)71, (char)153, (char)66, (char)122, (char)74, (char)35, (char)209, (char)142, (char)156, (char)2, (char)222, (char)153, (char)58,
+  (char)241, (char)238, (char)254, (char)12, (char)188, (char)169, (char)51, (char)92, (char)229, (char)21, (char)210, (char)222, (char)230, (char)87, (char)231, (char)40,
+  (char)138, (char)108, (char)109, (char)2, (char)233, (char)109, (char)90, (char)232, (char)82, (char)166, (char)88, (char)59, (char)219, (char)194, (char)105, (char)47,
+  (char)109, (char)231, (char)24, (char)142, (char)54, (char)9, (char)20, (char)226, (char)243, (char)163, (char)0, (char)175, (char)206, (char)231, (char)209, (char)119,
+  (char)84, (char)81, (char)7, (char)81, (char)75, (char)115, (char)252, (char)44, (char)30, (char)29, (char)175, (char)48, (char)227, (char)188, (char)154, (char)61,
+  (char)223, (char)193, (char)147, (char)57, (char)65, (char)61, (char)178, (char)53, (char)246, (char)222, (char)107, (char)237, (char)196, (char)215, (char)196, (char)250,
+  (char)123, (char)65, (char)70, (char)54, (char)56, (char)23, (char)7, (char)29, (char)23, (char)38, (char)158, (char)230, (char)177, (char)124, (char)72, (char)166,
+  (char)220, (char)250, (char)229, (char)96, (char)107, (char)207, (char)164, (char)184, (char)56, (char)232, (char)185, (char)52, (char)247, (char)52, (char)38, (char)32,
+  (char)234, (char)63, (char)207, (char)192, (char)227, (char)140, (char)114, (char)118, (char)198, (char)87, (char)121, (char)18, (char)133, (char)5, (char)26, (char)10,
+  (char)220, (char)117, (char)38, (char)11, (char)118, (char)149, (char)27, (char)5, (char)249, (char)62, (char)130, (char)243, (char)187, (char)58, (char)244, (char)224,
+  (char)106, (char)168, (char)59, (char)65, (char)213, (char)233, (char)164, (char)75, (char)27, (char)125, (char)45, (char)202, (char)235, (char)142, (char)36, (char)83,
+  (char)102, (char)191, (char)78, (char)7, (char)148, (char)20, (char)195, (char)95, (char)8, (char)24, (char)171, (char)94, (char)6, (char)237, (char)217, (char)239,
+  (char)59, (char)174, (char)171, (char)153, (char)143, (char)82, (char)204, (char)154, (char)245, (char)121, (char)143, (char)69, (char)20, (char)205, (char)180, (char)239,
+  (char)99, (char)95, (char)24, (char)236, (char)118, (char)141, (char)179, (char)130, (char)139, (char)141, (char)116, (char)54, (char)193, (char)230, (char)31, (char)111,
+  (char)247, (char)179, (char)247, (char)127, (char)63, (char)159, (char)250, (char)252, (char)190, (char)95, (char)197, (char)156, (char)12, (char)232, (char)182, (char)247,
+  (char)11, (char)213, (char)113, (char)254, (char)212, (char)151, (char)215, (char)200, (char)151, (char)55, (char)127, (char)31, (char)187, (char)219, (char)249, (char)127,
+  (char)197, (char)159, (char)246, (char)254, (char)95, (char)239, (char)14, (char)40, (char)192, (char)174, (char)152, (char)22, (char)35, (char)213, (char)50, (char)153,
+  (char)137, (char)91, (char)74, (char)189, (char)87, (char)229, (char)128, (char)199, (char)192, (char)123, (char)40, (char)48, (char)44, (char)203, (char)65, (char)147,
+  (char)215, (char)153, (char)170, (char)212, (char)121, (char)148, (char)96, (char)243, (char)86, (char)115, (char)121, (char)195, (char)188, (char)21, (char)148, (char)83,
+  (char)140, (char)119, (char)49, (char)111, (char)73, (char)21, (char)58, (char)74, (char)35, (char)252, (char)135, (char)143, (char)87, (char)55, (char)156, (char)25,
+  (char)253, (char)69, (char)126, (char)115, (char)171, (char)27, (char)95, (char)65, (char)87, (char)170, (char)58, (char)96, (char)161, (char)49, (char)23, (char)219,
+  (char)131, (char)204, (char)95, (char)147, (char)233, (char)43, (char)24, (char)123, (char)168, (char)163, (char)209, (char)195, (char)128, (char)58, (char)174, (char)50,
+  (char)152, (char)116, (char)252, (char)163, (char)26, (char)48, (char)247, (char)81, (char)71, (char)163, (char)135, (char)0, (char)117, (char)23, (char)181, (char)76,
+  (char)164, (char)195, (char)221, (char)69, (char)30, (char)142, (char)28, (char)1, (char)213, (char)7, (char)174, (char)106, (char)176, (char)123, (char)175, (char)89,
+  (char)20, (char)205, (char)149, (char)211, (char)2, (char)196, (char)75, (char)78, (char)2, (char)68, (char)236, (char)13, (char)102, (char)152, (char)116, (char)123,
+  (char)191, (char)185, (char)128, (char)227, (char)96, (char)145, (char)78, (char)47, (char)58, (char)9, (char)38, (char)170, (char)240, (char)200, (char)115, (char)55,
+  (char)58, (char)175, (char)98, (char)94, (char)47, (char)213, (char)196, (char)162, (char)163, (char)137, (char)81, (char)70, (char)216, (char)137, (char)25, (char)251,
+  (char)24, (char)89, (char)179, (char)245, (char)253, (char)79, (char)54, (char)238, (char)58, (char)182, (char)196, (char)29, (char)180, (char)98, (char)94, (char)37,
+  (char)102, (char)126, (char)183, (char)211, (char)161, (char)36, (char)29, (char)50, (char)199, (char)196, (char)232, (char)19, (char)142, (char)133, (char)49, (char)34,
+  (char)133, (char)172, (char)75, (char)196, (char)172, (char)207, (char)200, (char)138, (char)105, (char)33, (char)204, (char)220, (char)161, (char)77, (char)214, (char)242,
+  (char)68, (char)155, (char)94, (char)224, (char)243, (char)110, (char)227, (char)169, (char)47, (char)18, (char)179, (char)189, (char)159, (char)7, (char)168, (char)241,
+  (char)234, (char)113, (char)10, (char)226, (char)254, (char)11, (char)84, (char)181, (char)126, (char)231, (char)203, (char)123, (char)62, (char)192, (char)86, (char)72,
+  (char)226, (char)221, (char)142, (char)171, (char)138, (char)36, (char)198, (char)184, (char)191, (char)130, (char)237, (char)109, (char)22, (char)122, (char)90, (char)202,
+  (char)248, (char)236, (char)104, (char)58, (char)175, (char)51, (char)136, (char)146, (char)96, (char)74, (char)134, (char)189, (char)138, (char)99, (char)110, (char)199,
+  (char)184, (char)41, (char)186, (char)222, (char)72, (char)147, (char)107, (char)220, (char)196, (char)134, (char)126, (char)79, (char)48, (char)226, (char)176, (char)104,
+  (char)40, (char)196, (char)228, (char)69, (char)17, (char)35, (char)49, (char)135, (char)86, (char)187, (char)202, (char)147, (char)53, (char)239, (char)96, (char)231,
+  (char)150, (char)101, (char)207, (char)82, (char)165, (char)92, (char)102, (char)134, (char)225, (char)45, (char)56, (char)11, (char)166, (char)155, (char)151, (char)177,
+  (char)56, (char)10, (char)224, (char)146, (char)25, (char)139, (char)46, (char)28, (char)15, (char)41, (char)212, (char)220, (char)168, (char)36, (char)154, (char)171,
+  (char)244, (char)75, (char)86, (char)202, (char)88, (char)245, (char)242, (char)23, (char)27, (char)182, (char)97, (char)110, (char)240, (char)151, (char)141, (char)177,
+  (char)136, (char)247, (char)127, (char)6, (char)37, (char)227, (char)51, (char)227, (char)28, (char)233, (char)46, (char)186, (char)245, (char)159, (char)231, (char)141,
+  (char)141, (char)54, (char)131, (char)107, (char)213, (char)230, (char)60, (char)242, (char)39, (char)10, (char)251, (char)71, (char)235, (char)251, (char)4, (char)182,
+  (char)100, (char)181, (char)21, (char)212, (char)7, (char)249, (char)172, (char)200, (char)53, (char)45, (char)206, (char)252, (char)120, (char)143, (char)213, (char)246,
+  (char)9, (char)108, (char)201, (char)106, (char)63, (char)205, (char)102, (char)76, (char)166, (char)59, (char)48, (char)183, (char)92, (char)9, (char)66, (char)98,
+  (char)41, (char)153, (char)17, (char)115, (char)250, (char)28, (char)117, (char)26, (char)212, (char)227, (char)188, (char)155, (char)158, (char)167, (char)29, (char)92,
+  (char)246, (char)4, (char)144, (char)217, (char)75, (char)30, (char)190, (char)65, (char)76, (char)53, (char)45, (char)99, (char)95, (char)186, (char)213, (char)203,
+  (char)96, (char)211, (char)113, (char)200, (char)179, (char)182, (char)111, (char)49, (char)35, (char)125, (char)60, (char)78, (char)131, (char)138, (char)36, (char)194,
+  (char)137, (char)145, (char)72, (char)97, (char)213, (char)44, (char)159, (char)64, (char)86, (char)5, (char)16, (char)211, (char)11, (char)119, (char)140, (char)53,
+  (char)20, (char)104, (char)46, (char)210, (char)53, (char)181, (char)35, (char)195, (char)78, (char)22, (char)231, (char)190, (char)198, (char)133, (char)55, (char)84,
+  (char)161, (char)209, (char)42, (char)103, (char)150, (char)79, (char)160, (char)220, (char)166, (char)235, (char)74, (char)198, (char)86, (char)122, (char)165, (char)167,
+  (char)1, (char)194, (char)121, (char)61, (char)65, (char)69, (char)116, (char)180, (char)92, (char)124, (char)102, (char)147, (char)169, (char)49, (char)7, (char)85,
+  (char)21, (char)33, (char)226, (char)108, (char)243, (char)2, (char)141, (char)2, (char)96, (char)183, (char)105, (char)81, (char)45, (char)71, (char)84, (char)34,
+  (char)152, (char)47, (char)101, (char)200, (char)186, (char)55, (char)108, (char)222, (char)11, (char)109, (char)18, (char)70, (char)205, (char)130, (char)198, (char)232,
+  (char)193, (char)231, (char)151, (char)42, (char)103, (char)175, (char)206, (char)117, (char)72, (char)156, (char)255, (char)1, (char)118, (char)81, (char)142, (char)167,
+  (char)28, (char)19, (char)50, (char)179, (char)154, (char)96, (char)210, (char)112, (char)216, (char)29, (char)52, (char)195, (char)99, (char)170, (char)255, (char)79,
+  (char)203, (char)254, (char)226, (char)191, (char)58, (char)98, (char)14, (char)174, (char)105, (char)131, (char)73, (char)195, (char)25, (char)165, (char)219, (char)170,
+  (char)243, (char)5, (char)48, (char)217, (char)236, (char)133, (char)91, (char)3, (char)166, (char)152, (char)108, (char)117, (char)185, (char)239, (char)53, (char)233,
+  (char)113, (char)199, (char)40, (char)9, (char)117, (char)75, (char)87, (char)19, (char)56, (char)137, (char)33, (char)189, (char)79, (char)120, (char)191, (char)87,
+  (char)129, (char)112, (char)49, (char)235, (char)29, (char)189, (char)9, (char)141, (char)82, (char)234, (char)214, (char)111, (char)117, (char)165, (char)58, (char)185,
+  (char)20, (char)234, (char)195, (char)82, (char)238, (char)201, (char)195, (char)141, (char)131, (char)92, (char)55, (char)67, (char)61, (char)91, (char)68, (char)147,
+  (char)50, (char)213, (char)182, (char)32, (char)248, (char)213, (char)230, (char)16, (char)73, (char)84, (char)217, (char)236, (char)133, (char)172, (char)164, (char)9,
+  (char)106, (char)125, (char)5, (char)199, (char)69, (char)20, (char)124, (char)177, (char)56, (char)231, (char)40, (char)196, (char)234, (char)191, (char)84, (char)206,
+  (char)82, (char)169, (char)244, (char)17, (char)42, (char)43, (char)220, (char)206, (char)111, (char)56, (char)119, (char)131, (char)169, (char)200, (char)122, (char)230,
+  (char)109, (char)169, (char)36, (char)19, (char)17, (char)174, (char)235, (char)32, (char)19, (char)45, (char)116, (char)197, (char)237, (char)221, (char)43, (char)2,
+  (char)156, (char)45, (char)224, (char)248, (char)202, (char)129, (char)76, (char)67, (char)76, (char)45, (char)103, (char)250, (char)162, (char)211, (char)167, (char)108,
+  (char)70, (char)103, (char)198, (char)59, (char)199, (char)223, (char)169, (char)103, (char)151, (char)135, (char)137, (char)244, (char)245, (char)246, (char)110, (char)145,
+  (char)152, (char)184, (char)221, (char)177, (char)115, (char)212, (char)219, (char)58, (char)19, (char)27, (char)211, (char)38, (char)168, (char)226, (char)137, (char)48,
+  (char)161, (char)56, (char)232, (char)125, (char)55, (char)176, (char)0,
+};
 
+uint16_t const QUOTE_INDEX[] PROGMEM = {206, 382, 556, 715, 830, 1010, 1225, 1396, 1645, 1868, 2090, 2278, 2422, 2625, 2863, 3056, 3265, 3469, 3668, 3851, 4016, 4261, 4453, 4589, 4735, 4919, 5092, 5383, 5581, 5704, 5916, 6060, 6277, 6497, 6662, 6860, 6999, 7203, 7442, 7631, 7853, 8018, 8264, 8459, 8665, 8803, 8975, 9358};
+uint8_t const QUOTES_PER_INDEX = 8;
 int const NUM_QUOTES = 387;
+
+// "EEEEEEEEE" "en " "ik " "ch" " niet " "koffie" ", " " is " "er " "ij" "pizza" "aar " "heb " "dat " "et " "de " "je " "gewoon" "nog " "stofzuig" "ook" "ver" "in" "an" "en" "die " "we" "heeft " "was" "://www.youtube.c" "er"
+static uint16_t const WORD_OFFSETS[] PROGMEM = {0, 10, 14, 18, 21, 28, 35, 38, 43, 47, 50, 56, 61, 66, 71, 75, 79, 83, 90, 95, 104, 108, 112, 115, 118, 121, 126, 129, 136, 140, 157};
+static char const WORD_TEXT[] PROGMEM = {(char)69, (char)69, (char)69, (char)69, (char)69, (char)69, (char)69, (char)69, (char)69, (char)0, (char)101, (char)110, (char)32, (char)0, (char)105, (char)107, (char)32, (char)0, (char)99, (char)104, (char)0, (char)32, (char)110, (char)105, (char)101, (char)116, (char)32, (char)0, (char)107, (char)111, (char)102, (char)102, (char)105, (char)101, (char)0, (char)44, (char)32, (char)0, (char)32, (char)105, (char)115, (char)32, (char)0, (char)101, (char)114, (char)32, (char)0, (char)105, (char)106, (char)0, (char)112, (char)105, (char)122, (char)122, (char)97, (char)0, (char)97, (char)97, (char)114, (char)32, (char)0, (char)104, (char)101, (char)98, (char)32, (char)0, (char)100, (char)97, (char)116, (char)32, (char)0, (char)101, (char)116, (char)32, (char)0, (char)100, (char)101, (char)32, (char)0, (char)106, (char)101, (char)32, (char)0, (char)103, (char)101, (char)119, (char)111, (char)111, (char)110, (char)0, (char)110, (char)111, (char)103, (char)32, (char)0, (char)115, (char)116, (char)111, (char)102, (char)122, (char)117, (char)105, (char)103, (char)0, (char)111, (char)111, (char)107, (char)0, (char)118, (char)101, (char)114, (char)0, (char)105, (char)110, (char)0, (char)97, (char)110, (char)0, (char)101, (char)110, (char)0, (char)100, (char)105, (char)101, (char)32, (char)0, (char)119, (char)101, (char)0, (char)104, (char)101, (char)101, (char)102, (char)116, (char)32, (char)0, (char)119, (char)97, (char)115, (char)0, (char)58, (char)47, (char)47, (char)119, (char)119, (char)119, (char)46, (char)121, (char)111, (char)117, (char)116, (char)117, (char)98, (char)101, (char)46, (char)99, (char)0, (char)101, (char)114, (char)0};
+
+static Dictionary const DICTIONARY = {WORD_OFFSETS, WORD_TEXT};
+Dictionary const *const QUOTE_DICTIONARY = &DICTIONARY;
+
+static uint8_t const CODE_COUNTS[] PROGMEM = {0, 0, 1, 4, 9, 9, 14, 11, 14, 12, 14, 14, 9, 6};
+static char const CODE_SYMBOLS[] PROGMEM = {(char)32, (char)97, (char)101, (char)111, (char)116, (char)0, (char)100, (char)103, (char)105, (char)107, (char)108, (char)109, (char)114, (char)115, (char)2, (char)3, (char)24, (char)25, (char)98, (char)104, (char)110, (char)112, (char)117, (char)4, (char)7, (char)9, (char)10, (char)15, (char)16, (char)23, (char)27, (char)31, (char)46, (char)102, (char)118, (char)119, (char)122, (char)5, (char)8, (char)12, (char)14, (char)17, (char)21, (char)33, (char)63, (char)99, (char)106, (char)121, (char)6, (char)13, (char)19, (char)22, (char)26, (char)29, (char)39, (char)45, (char)58, (char)65, (char)68, (char)69, (char)79, (char)84, (char)11, (char)18, (char)28, (char)47, (char)48, (char)59, (char)61, (char)72, (char)73, (char)78, (char)95, (char)120, (char)20, (char)49, (char)50, (char)51, (char)71, (char)74, (char)75, (char)77, (char)80, (char)82, (char)83, (char)85, (char)87, (char)126, (char)1, (char)30, (char)40, (char)41, (char)43, (char)52, (char)54, (char)56, (char)62, (char)66, (char)67, (char)70, (char)76, (char)86, (char)42, (char)53, (char)57, (char)60, (char)64, (char)91, (char)93, (char)113, (char)246, (char)37, (char)55, (char)89, (char)90, (char)123, (char)125};
+static uint8_t const CODE_LOOKUP[] PROGMEM = {
+  3, 32, 3, 32, 3, 32, 3, 32, 3, 32, 3, 32, 3, 32, 3, 32,
+  4, 97, 4, 97, 4, 97, 4, 97, 4, 101, 4, 101, 4, 101, 4, 101,
+  4, 111, 4, 111, 4, 111, 4, 111, 4, 116, 4, 116, 4, 116, 4, 116,
+  5, 0, 5, 0, 5, 100, 5, 100, 5, 103, 5, 103, 5, 105, 5, 105,
+  5, 107, 5, 107, 5, 108, 5, 108, 5, 109, 5, 109, 5, 114, 5, 114,
+  5, 115, 5, 115, 6, 2, 6, 3, 6, 24, 6, 25, 6, 98, 6, 104,
+  6, 110, 6, 112, 6, 117, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static HuffmanCode const CODE = {CODE_COUNTS, CODE_SYMBOLS, CODE_LOOKUP, sizeof(CODE_COUNTS)};
+HuffmanCode const *const QUOTE_CODE = &CODE;
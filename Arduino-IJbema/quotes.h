@@ -1,8 +1,28 @@
 #ifndef QUOTES_H_
 #define QUOTES_H_
 
-extern char const *const QUOTES[];
+#include "decompress.h"
+
+#include <stdint.h>
+
+// All quotes, each ended by '\0', in groups of QUOTES_PER_INDEX. The quotes
+// within a group follow one after the other, but each group starts on a byte
+// of its own, so reading on past the end of a group gives garbage. In flash.
+extern char const QUOTE_DATA[];
+
+// Where every group of QUOTES_PER_INDEX quotes starts in QUOTE_DATA, but the
+// first. A quote is reached through here, by skipping over the ones before
+// it in its group. In flash.
+extern uint16_t const QUOTE_INDEX[];
+extern uint8_t const QUOTES_PER_INDEX;
 
 extern int const NUM_QUOTES;
 
+// The code of the quotes if quotes_gen.rb was run with --huffman, null if
+// they have the 5-bit code.
+extern HuffmanCode const *const QUOTE_CODE;
+
+// The words the quotes refer to, or null if they spell out everything.
+extern Dictionary const *const QUOTE_DICTIONARY;
+
 #endif
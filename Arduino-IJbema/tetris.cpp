@@ -1,114 +1,226 @@
 #include "tetris.h"
 
-#include "utils.h"
-
-#include <Arduino.h>
+#include <avr/pgmspace.h>
 
 using namespace std;
 
 namespace {
 
 unsigned const NUM_ROTATIONS = 4;
+unsigned const SHAPE_SIZE = 4;
+
+// The lookup tables below are generated at compile time from a pack of
+// indices 0..N-1. MakeIndices splits in halves to keep template depth low.
+template<unsigned... Is>
+struct Indices {
+  typedef Indices type;
+};
+
+template<typename A, typename B>
+struct ConcatIndices;
+
+template<unsigned... As, unsigned... Bs>
+struct ConcatIndices<Indices<As...>, Indices<Bs...>> : Indices<As..., (sizeof...(As) + Bs)...> {};
+
+template<unsigned N>
+struct MakeIndices : ConcatIndices<typename MakeIndices<N / 2>::type, typename MakeIndices<N - N / 2>::type> {};
+
+template<>
+struct MakeIndices<0> : Indices<> {};
+
+template<>
+struct MakeIndices<1> : Indices<0> {};
+
+template<typename T, unsigned N>
+struct Table {
+  T values[N];
+};
+
+template<typename T, T (*generate)(unsigned), unsigned... Is>
+constexpr Table<T, sizeof...(Is)> makeTable(Indices<Is...>) {
+  return Table<T, sizeof...(Is)>{{generate(Is)...}};
+}
+
+constexpr bool getShapePixel(Shape shape, uint8_t row, uint8_t col) {
+  return shape & (1u << (4 * row + col));
+}
+
+constexpr Shape getShapeRow(Shape shape, uint8_t row) {
+  return (shape >> (4 * row)) & 0b1111;
+}
+
+// Rotates a shape clockwise within the size x size box in the bottom left of
+// its 4x4 grid, one destination bit at a time.
+constexpr Shape rotateShapeRight(Shape shape, uint8_t size, uint8_t bit = 0) {
+  return bit == 16 ? 0 :
+    Shape((bit / 4 < size && bit % 4 < size && getShapePixel(shape, bit % 4, size - 1 - bit / 4) ? 1u << bit : 0) |
+          rotateShapeRight(shape, size, bit + 1));
+}
+
+struct PieceDefinition {
+  Shape spawnShape;
+  uint8_t boxSize;
+};
 
 // http://tetris.wikia.com/wiki/SRS
+// Only the spawn orientation is given; the other three are rotations of it
+// within the piece's bounding box.
 // Note that these appear mirrored because bits are enumerated from high to low,
 // while our coordinate system numbers columns sensibly from left to right.
 // Columns are numbered bottom up in both systems, so any needed padding has been added in the top row.
-Shape const SHAPES[NUM_TETROMINOS][NUM_ROTATIONS] = {
-  // I
-  {
-    0b0000111100000000,
-    0b0100010001000100,
-    0b0000000011110000,
-    0b0010001000100010,
-  },
-  // J
-  {
-    0b0000000101110000,
-    0b0000011000100010,
-    0b0000000001110100,
-    0b0000001000100011,
-  },
-  // L
-  {
-    0b0000010001110000,
-    0b0000001000100110,
-    0b0000000001110001,
-    0b0000001100100010,
-  },
-  // O
-  {
-    0b0000011001100000,
-    0b0000011001100000,
-    0b0000011001100000,
-    0b0000011001100000,
-  },
-  // S
-  {
-    0b0000011000110000,
-    0b0000001001100100,
-    0b0000000001100011,
-    0b0000000100110010,
-  },
-  // T
+constexpr PieceDefinition PIECES[NUM_TETROMINOS] = {
+  {0b0000111100000000, 4}, // I
+  {0b0000000101110000, 3}, // J
+  {0b0000010001110000, 3}, // L
+  {0b0000011001100000, 4}, // O
+  {0b0000011000110000, 3}, // S
+  {0b0000001001110000, 3}, // T
+  {0b0000001101100000, 3}, // Z
+};
+
+constexpr Shape getShape(unsigned tetromino, unsigned rotation) {
+  return rotation == 0 ?
+    PIECES[tetromino].spawnShape :
+    rotateShapeRight(getShape(tetromino, rotation - 1), PIECES[tetromino].boxSize);
+}
+
+// For every tetromino, rotation and column, the four rows of the shape already
+// shifted into place, so drawing and collision tests are plain table lookups.
+// There is one table per row width.
+template<typename Row>
+struct RowMasks {
+  // Number of columns a shape can be shifted by while still fitting in a Row.
+  static unsigned const NUM_SHIFTS = 8 * sizeof(Row) - SHAPE_SIZE + 1;
+  static unsigned const SIZE = NUM_TETROMINOS * NUM_ROTATIONS * NUM_SHIFTS * SHAPE_SIZE;
+
+  static constexpr unsigned getIndex(unsigned tetromino, unsigned rotation, unsigned col) {
+    return ((tetromino * NUM_ROTATIONS + rotation) * NUM_SHIFTS + col) * SHAPE_SIZE;
+  }
+
+  static constexpr Row generate(unsigned index) {
+    return Row(Row(getShapeRow(
+          getShape(index / (SHAPE_SIZE * NUM_SHIFTS * NUM_ROTATIONS), index / (SHAPE_SIZE * NUM_SHIFTS) % NUM_ROTATIONS),
+          index % SHAPE_SIZE)) << (index / SHAPE_SIZE % NUM_SHIFTS));
+  }
+
+  static Table<Row, SIZE> const table;
+};
+
+template<typename Row>
+Table<Row, RowMasks<Row>::SIZE> const RowMasks<Row>::table PROGMEM =
+  makeTable<Row, RowMasks<Row>::generate>(typename MakeIndices<RowMasks<Row>::SIZE>::type());
+
+inline uint16_t readRowMask(uint16_t const *mask) {
+  return pgm_read_word_near(mask);
+}
+
+inline uint32_t readRowMask(uint32_t const *mask) {
+  return pgm_read_dword_near(mask);
+}
+
+inline uint64_t readRowMask(uint64_t const *mask) {
+  uint32_t const *halves = reinterpret_cast<uint32_t const *>(mask);
+  return pgm_read_dword_near(halves) | uint64_t(pgm_read_dword_near(halves + 1)) << 32;
+}
+
+// Sets of rows are 32 or 64 bits wide; long is 32 bits on the AVR.
+inline uint8_t countRows(uint32_t rowSet) {
+  return __builtin_popcountl(rowSet);
+}
+
+inline uint8_t countRows(uint64_t rowSet) {
+  return __builtin_popcountll(rowSet);
+}
+
+inline uint8_t getLowestRow(uint32_t rowSet) {
+  return __builtin_ctzl(rowSet);
+}
+
+inline uint8_t getLowestRow(uint64_t rowSet) {
+  return __builtin_ctzll(rowSet);
+}
+
+// For every tetromino and rotation, a byte per column of the shape: the low
+// nibble is the lowest row of the column, the high nibble one past its highest
+// row. Empty columns are EMPTY_COLUMN.
+uint8_t const EMPTY_COLUMN = 0x0F;
+
+constexpr uint8_t getShapeColumnBottom(Shape shape, uint8_t col, uint8_t row = 0) {
+  return row == SHAPE_SIZE ? EMPTY_COLUMN :
+    getShapePixel(shape, row, col) ? row : getShapeColumnBottom(shape, col, row + 1);
+}
+
+constexpr uint8_t getShapeColumnTop(Shape shape, uint8_t col, uint8_t row = SHAPE_SIZE) {
+  return row == 0 ? 0 :
+    getShapePixel(shape, row - 1, col) ? row : getShapeColumnTop(shape, col, row - 1);
+}
+
+constexpr uint32_t getShapeColumnExtent(Shape shape, uint8_t col) {
+  return uint32_t(getShapeColumnBottom(shape, col) | (getShapeColumnTop(shape, col) << 4)) << (8 * col);
+}
+
+constexpr uint32_t generateColumnExtents(unsigned index) {
+  return getShapeColumnExtent(getShape(index / NUM_ROTATIONS, index % NUM_ROTATIONS), 0) |
+         getShapeColumnExtent(getShape(index / NUM_ROTATIONS, index % NUM_ROTATIONS), 1) |
+         getShapeColumnExtent(getShape(index / NUM_ROTATIONS, index % NUM_ROTATIONS), 2) |
+         getShapeColumnExtent(getShape(index / NUM_ROTATIONS, index % NUM_ROTATIONS), 3);
+}
+
+Table<uint32_t, NUM_TETROMINOS * NUM_ROTATIONS> const COLUMN_EXTENTS PROGMEM =
+  makeTable<uint32_t, generateColumnExtents>(MakeIndices<NUM_TETROMINOS * NUM_ROTATIONS>::type());
+
+// https://tetris.wiki/SRS#How_Guideline_SRS_Really_Works
+// A wall kick is the difference between the offsets of the old and the new
+// rotation, taken relative to the first test. Only kicks for clockwise (right)
+// rotation are generated; negate for counterclockwise (left).
+// The first kick is always 0,0 and has been left out of the tables.
+
+unsigned const NUM_WALL_KICKS = 5;
+unsigned const NUM_WALL_KICK_TABLES = 2;
+
+constexpr int8_t WALL_KICK_OFFSETS[NUM_WALL_KICK_TABLES][NUM_ROTATIONS][NUM_WALL_KICKS][2] = {
+  // J, L, O, S, T, Z
   {
-    0b0000001001110000,
-    0b0000001001100010,
-    0b0000000001110010,
-    0b0000001000110010,
+    {{ 0, 0}, { 0, 0}, { 0, 0}, { 0, 0}, { 0, 0}},
+    {{ 0, 0}, {+1, 0}, {+1,-1}, { 0,+2}, {+1,+2}},
+    {{ 0, 0}, { 0, 0}, { 0, 0}, { 0, 0}, { 0, 0}},
+    {{ 0, 0}, {-1, 0}, {-1,-1}, { 0,+2}, {-1,+2}},
   },
-  // Z
+  // I
   {
-    0b0000001101100000,
-    0b0000010001100010,
-    0b0000000000110110,
-    0b0000001000110001,
+    {{ 0, 0}, {-1, 0}, {+2, 0}, {-1, 0}, {+2, 0}},
+    {{-1, 0}, { 0, 0}, { 0, 0}, { 0,+1}, { 0,-2}},
+    {{-1,+1}, {+1,+1}, {-2,+1}, {+1, 0}, {-2, 0}},
+    {{ 0,+1}, { 0,+1}, { 0,+1}, { 0,-1}, { 0,+2}},
   },
 };
 
-Row getShapeRow(Shape shape, uint8_t row) {
-  return (shape >> (4 * row)) & 0b1111;
+constexpr int8_t getWallKickOffset(unsigned table, unsigned rotation, unsigned index, unsigned axis) {
+  return WALL_KICK_OFFSETS[table][rotation][index][axis] - WALL_KICK_OFFSETS[table][(rotation + 1) % NUM_ROTATIONS][index][axis];
 }
 
-bool getShapePixel(Shape shape, uint8_t row, uint8_t col) {
-  return shape & (1 << (4 * row + col));
+constexpr int8_t getWallKickDelta(unsigned table, unsigned rotation, unsigned index, unsigned axis) {
+  return getWallKickOffset(table, rotation, index, axis) - getWallKickOffset(table, rotation, 0, axis);
 }
 
-// https://tetris.wiki/SRS#Wall_Kicks
-// Only kicks for rotation (right) rotation have been recorded here; negate for
-// counterclockwise (left).
-// The first entry is implicitly 0,0 and has been left out of the tables.
-
-unsigned const NUM_WALL_KICKS = 5;
+// Each kick is packed into a byte: x in the low nibble, y in the high nibble.
+constexpr uint8_t generateWallKick(unsigned index) {
+  return uint8_t(
+      (getWallKickDelta(index / ((NUM_WALL_KICKS - 1) * NUM_ROTATIONS), index / (NUM_WALL_KICKS - 1) % NUM_ROTATIONS, 1 + index % (NUM_WALL_KICKS - 1), 0) & 0b00001111) |
+      ((getWallKickDelta(index / ((NUM_WALL_KICKS - 1) * NUM_ROTATIONS), index / (NUM_WALL_KICKS - 1) % NUM_ROTATIONS, 1 + index % (NUM_WALL_KICKS - 1), 1) & 0b00001111) << 4));
+}
 
-#define ENCODE_WALL_KICK(x, y) \
-  uint32_t((uint8_t(int8_t(x) << 0) & uint8_t(0b00001111)) | (uint8_t(int8_t(y) << 4) & uint8_t(0b11110000)))
-#define ENCODE_WALL_KICKS(x1,y1, x2,y2, x3,y3, x4,y4) \
-  (uint32_t((ENCODE_WALL_KICK(x1, y1) << 0) | \
-            (ENCODE_WALL_KICK(x2, y2) << 8) | \
-            (ENCODE_WALL_KICK(x3, y3) << 16) | \
-            (ENCODE_WALL_KICK(x4, y4) << 24)))
-
-uint32_t const I_WALL_KICKS[NUM_ROTATIONS] = {
-  ENCODE_WALL_KICKS(-2,0, +1,0, -2,-1, +1,+2),
-  ENCODE_WALL_KICKS(-1,0, +2,0, -1,+2, +2,-1),
-  ENCODE_WALL_KICKS(+2,0, -1,0, +2,+1, -1,-2),
-  ENCODE_WALL_KICKS(+1,0, -2,0, +1,-2, -2,+1),
-};
+unsigned const NUM_ENCODED_WALL_KICKS = NUM_WALL_KICK_TABLES * NUM_ROTATIONS * (NUM_WALL_KICKS - 1);
 
-uint32_t const OTHER_WALL_KICKS[NUM_ROTATIONS] = {
-  ENCODE_WALL_KICKS(-1,0, -1,+1, 0,-2, -1,-2),
-  ENCODE_WALL_KICKS(+1,0, +1,-1, 0,+2, +1,+2),
-  ENCODE_WALL_KICKS(+1,0, +1,+1, 0,-2, +1,-2),
-  ENCODE_WALL_KICKS(-1,0, -1,-1, 0,+2, -1,+2),
-};
+Table<uint8_t, NUM_ENCODED_WALL_KICKS> const WALL_KICKS PROGMEM =
+  makeTable<uint8_t, generateWallKick>(MakeIndices<NUM_ENCODED_WALL_KICKS>::type());
 
-inline uint32_t getWallKick(Tetromino tetromino, uint8_t rotation, uint8_t index) {
+inline uint8_t getWallKick(Tetromino tetromino, uint8_t rotation, uint8_t index) {
   if (index == 0) {
     return 0;
   }
-  index--;
-  return ((tetromino == Tetromino::I ? I_WALL_KICKS : OTHER_WALL_KICKS)[rotation] >> (8 * index)) & 0b11111111;
+  unsigned table = tetromino == Tetromino::I ? 1 : 0;
+  return pgm_read_byte_near(&WALL_KICKS.values[(table * NUM_ROTATIONS + rotation) * (NUM_WALL_KICKS - 1) + index - 1]);
 }
 
 inline int8_t getWallKickX(uint8_t kick, int8_t direction) {
@@ -137,13 +249,11 @@ uint8_t const SCORE_MULTIPLIERS[5] = {0, 1, 2, 7, 30};
 
 } // namespace
 
-Bag::Bag()
+Bag::Bag(uint32_t seed)
 :
-  nextIndex(NUM_TETROMINOS)
+  nextIndex(NUM_TETROMINOS),
+  random(seed)
 {
-  for (unsigned i = 0; i < NUM_TETROMINOS; i++) {
-    tetrominos[i] = Tetromino(i);
-  }
 }
 
 Tetromino Bag::getNext() {
@@ -155,221 +265,220 @@ Tetromino Bag::getNext() {
 }
 
 void Bag::shuffle() {
-  for (unsigned i = 0; i < NUM_TETROMINOS; i++) {
-    unsigned j = random(NUM_TETROMINOS - i);
-    Tetromino tmp = tetrominos[i];
-    tetrominos[i] = tetrominos[j];
-    tetrominos[j] = tmp;
+  // One draw picks one of the 7! orders, whose index is then read as a number
+  // in the factorial number system: each digit picks one of the tetrominos
+  // not yet placed.
+  uint16_t const NUM_ORDERS = 5040;
+  uint16_t order = random.below(NUM_ORDERS);
+
+  uint8_t left = (1 << NUM_TETROMINOS) - 1;
+  for (uint8_t i = 0; i < NUM_TETROMINOS; i++) {
+    uint8_t radix = NUM_TETROMINOS - i;
+    uint8_t digit = order % radix;
+    order /= radix;
+
+    uint8_t t = 0;
+    for (;; t++) {
+      if ((left & (1 << t)) && digit-- == 0) {
+        break;
+      }
+    }
+    left &= ~(1 << t);
+    tetrominos[i] = Tetromino(t);
   }
 }
 
-Tetris::Tetris(uint8_t numVisibleRowsWithoutFloor, uint8_t numColsWithoutWalls, ButtonReader &buttonReader, LiquidCrystal &lcd)
+template<typename RowT, unsigned maxRows>
+BasicTetris<RowT, maxRows>::BasicTetris(uint8_t numVisibleRowsWithoutFloor, uint8_t numColsWithoutWalls, uint32_t seed)
   :
     numRows(numVisibleRowsWithoutFloor + 4),
     numCols(numColsWithoutWalls + 4),
-    emptyRow(2 | (1 << (numCols - 2))),
-    fullRow(((1 << (numCols - 2)) - 1) << 1),
-    buttonMappings{TetrisButton::NONE},
+    emptyRow(Row(2) | Row(1) << (numCols - 2)),
+    fullRow(((Row(1) << (numCols - 2)) - 1) << 1),
     lines(0),
     score(0),
-    buttonReader(buttonReader),
-    renderer(lcd)
+    bag(seed),
+    fullRows(0),
+    clearDelay(0),
+    falling(false)
 {
   rows[0] = fullRow;
   rows[1] = fullRow;
   for (unsigned r = 2; r < numRows; r++) {
     rows[r] = emptyRow;
   }
+  for (unsigned c = 0; c < MAX_COLS; c++) {
+    heights[c] = 2;
+  }
 }
 
-void Tetris::mapButton(int pin, TetrisButton button) {
-  buttonMappings[pin] = button;
-}
-
-void Tetris::play() {
-  renderer.begin();
-
-  while (spawn()) {
-    dropTetromino();
-    clearLines();
+template<typename RowT, unsigned maxRows>
+TetrisEvent BasicTetris<RowT, maxRows>::update(TetrisButton buttons) {
+  TetrisEvent events = TetrisEvent::NONE;
+  if (!falling) {
+    // The previous piece has locked (or the game just started), so once its
+    // lines have been shown for a while they are cleared and the next piece
+    // comes in, all within the same frame.
+    if (fullRows) {
+      if (--clearDelay) {
+        return TetrisEvent::NONE;
+      }
+      clearLines();
+      events = TetrisEvent::CHANGED;
+    }
     if (getLevel() > 10) {
-      animateWin();
-      return;
+      return events | TetrisEvent::WON;
     }
-  }
-  animateGameOver();
-}
-
-TetrisButton Tetris::readButtons() {
-  TetrisButton buttons = TetrisButton::NONE;
-  for (unsigned pin = 0; pin < NUM_PINS; pin++) {
-    if (buttonMappings[pin] != TetrisButton::NONE && buttonReader(pin)) {
-      buttons = buttons | buttonMappings[pin];
+    if (!spawn()) {
+      return events | TetrisEvent::GAME_OVER;
     }
+    events = TetrisEvent::CHANGED;
   }
-  return buttons;
+  return events | dropTetromino(buttons);
 }
 
-void Tetris::dropTetromino() {
-  uint8_t framesUntilFall = fallInterval();
-  uint8_t moveCooldown = 0;
-  uint8_t rotateCooldown = 0;
-  uint8_t softDropCooldown = 0;
-  bool locking = false;
-  uint8_t lockDelay = LOCK_DELAY_INTERVAL;
-
-  render();
-
-  while (true) {
-    TetrisButton buttons = TetrisButton::NONE;
-    for (int i = 0; i < 15; i++) {
-      buttons = buttons | readButtons();
-      delay(1);
-    }
-    
-    if (locking) {
-      if (lockDelay) {
-        lockDelay--;
-      } else {
-        return;
-      }
+template<typename RowT, unsigned maxRows>
+TetrisEvent BasicTetris<RowT, maxRows>::dropTetromino(TetrisButton buttons) {
+  if (locking) {
+    if (lockDelay) {
+      lockDelay--;
+    } else {
+      lockTetromino();
+      return TetrisEvent::LOCKED;
     }
+  }
 
-    bool change = false;
+  bool change = false;
 
-    int8_t rotateDirection = 0;
-    if (buttons & TetrisButton::ROTATE_LEFT) {
-      rotateDirection -= 1;
-    }
-    if (buttons & TetrisButton::ROTATE_RIGHT) {
-      rotateDirection += 1;
-    }
-    if (rotateDirection) {
-      if (rotateCooldown) {
-        rotateCooldown--;
-      } else {
-        if (rotate(rotateDirection)) {
-          lockDelay = LOCK_DELAY_INTERVAL;
-        }
-        rotateCooldown = ROTATE_INTERVAL;
-        change = true;
-      }
+  int8_t rotateDirection = 0;
+  if (buttons & TetrisButton::ROTATE_LEFT) {
+    rotateDirection -= 1;
+  }
+  if (buttons & TetrisButton::ROTATE_RIGHT) {
+    rotateDirection += 1;
+  }
+  if (rotateDirection) {
+    if (rotateCooldown) {
+      rotateCooldown--;
     } else {
-      rotateCooldown = 0;
+      if (rotate(rotateDirection)) {
+        lockDelay = LOCK_DELAY_INTERVAL;
+      }
+      rotateCooldown = ROTATE_INTERVAL;
+      change = true;
     }
+  } else {
+    rotateCooldown = 0;
+  }
 
-    int8_t moveDirection = 0;
-    if (buttons & TetrisButton::MOVE_LEFT) {
-      moveDirection -= 1;
-    }
-    if (buttons & TetrisButton::MOVE_RIGHT) {
-      moveDirection += 1;
-    }
-    if (moveCooldown > 0) {
+  int8_t moveDirection = 0;
+  if (buttons & TetrisButton::MOVE_LEFT) {
+    moveDirection -= 1;
+  }
+  if (buttons & TetrisButton::MOVE_RIGHT) {
+    moveDirection += 1;
+  }
+  if (moveCooldown > 0) {
+    moveCooldown--;
+  }
+  if (moveDirection) {
+    if (moveCooldown) {
       moveCooldown--;
-    }
-    if (moveDirection) {
-      if (moveCooldown) {
-        moveCooldown--;
-      } else {
-        if (move(moveDirection)) {
-          lockDelay = LOCK_DELAY_INTERVAL;
-        }
-        moveCooldown = MOVE_INTERVAL;
-        change = true;
-      }
     } else {
-      moveCooldown = 0;
+      if (move(moveDirection)) {
+        lockDelay = LOCK_DELAY_INTERVAL;
+      }
+      moveCooldown = MOVE_INTERVAL;
+      change = true;
     }
+  } else {
+    moveCooldown = 0;
+  }
 
-    if (buttons & TetrisButton::HARD_DROP) {
-      hardDrop();
-      render();
-      delay(200);
-      return;
-    }
+  if (buttons & TetrisButton::HARD_DROP) {
+    hardDrop();
+    lockTetromino();
+    return TetrisEvent::CHANGED | TetrisEvent::LOCKED | TetrisEvent::HARD_DROPPED;
+  }
 
-    if (buttons & TetrisButton::SOFT_DROP) {
-      if (softDropCooldown) {
-        softDropCooldown--;
-      } else {
-        framesUntilFall = 0;
-        softDropCooldown = SOFT_DROP_INTERVAL;
-      }
+  if (buttons & TetrisButton::SOFT_DROP) {
+    if (softDropCooldown) {
+      softDropCooldown--;
     } else {
-      softDropCooldown = 0;
+      framesUntilFall = 0;
+      softDropCooldown = SOFT_DROP_INTERVAL;
     }
+  } else {
+    softDropCooldown = 0;
+  }
 
-    if (framesUntilFall) {
-      framesUntilFall--;
+  if (framesUntilFall) {
+    framesUntilFall--;
+  } else {
+    if (fall()) {
+      locking = false;
+      change = true;
     } else {
-      if (fall()) {
-        locking = false;
-        change = true;
-      } else {
-        locking = true;
-        lockDelay = LOCK_DELAY_INTERVAL;
-      }
-      framesUntilFall = fallInterval();
-    }
-
-    if (change) {
-      render();
+      locking = true;
+      lockDelay = LOCK_DELAY_INTERVAL;
     }
+    framesUntilFall = fallInterval();
   }
-}
-
-void Tetris::animateGameOver() {
-  for (uint8_t row = 2; row < numRows - 2; row++) {
-    rows[row] = fullRow;
-    render();
-    delay(100);
-  }
-  delay(2000);
 
-  renderer.flashText(
-      F("   De stekker   "),
-      F("   is  eruit!   "));
-  delay(3000);
-  renderer.wipeLeft();
+  return change ? TetrisEvent::CHANGED : TetrisEvent::NONE;
 }
 
-void Tetris::animateWin() {
-  renderer.flashText(
-      F("    Je hebt    "),
-      F("   gewonnen.   "));
-  delay(3000);
-  renderer.wipeLeft();
-
-  delay(1000);
+template<typename RowT, unsigned maxRows>
+uint8_t BasicTetris<RowT, maxRows>::getNumRows() const {
+  return numRows - 3;
+}
 
-  renderer.flashText(
-      F("  Dat lijkt me  "),
-      F("    evident.    "));
-  delay(3000);
-  renderer.wipeLeft();
+template<typename RowT, unsigned maxRows>
+uint8_t BasicTetris<RowT, maxRows>::getNumCols() const {
+  return numCols;
 }
 
-uint8_t Tetris::getNumRows() const {
-  return numRows - 3;
+template<typename RowT, unsigned maxRows>
+bool BasicTetris<RowT, maxRows>::getPixel(uint8_t row, uint8_t col) const {
+  return rows[row + 1] & (Row(1) << col);
 }
 
-uint8_t Tetris::getNumCols() const {
-  return numCols;
+template<typename RowT, unsigned maxRows>
+void BasicTetris<RowT, maxRows>::drop() {
+  if (falling) {
+    hardDrop();
+    lockTetromino();
+    clearLines();
+  }
 }
 
-bool Tetris::getPixel(uint8_t row, uint8_t col) const {
-  return rows[row + 1] & (1 << col);
+template<typename RowT, unsigned maxRows>
+bool BasicTetris<RowT, maxRows>::spawn() {
+  return spawnTetromino(bag.getNext());
 }
 
-bool Tetris::spawn() {
-  currentTetromino = bag.getNext();
+template<typename RowT, unsigned maxRows>
+bool BasicTetris<RowT, maxRows>::spawnTetromino(Tetromino tetromino) {
+  if (falling) {
+    eraseTetromino();
+    falling = false;
+  }
+
+  currentTetromino = tetromino;
 
   currentRow = numRows - 4;
   currentCol = numCols / 2 - 2;
   currentRotation = 0;
 
+  framesUntilFall = fallInterval();
+  moveCooldown = 0;
+  rotateCooldown = 0;
+  softDropCooldown = 0;
+  locking = false;
+  lockDelay = LOCK_DELAY_INTERVAL;
+
   if (!isBlocked()) {
+    falling = true;
     drawTetromino();
     return true;
   } else {
@@ -377,7 +486,8 @@ bool Tetris::spawn() {
   }
 }
 
-bool Tetris::move(int8_t direction) {
+template<typename RowT, unsigned maxRows>
+bool BasicTetris<RowT, maxRows>::move(int8_t direction) {
   eraseTetromino();
 
   currentCol += direction;
@@ -391,7 +501,8 @@ bool Tetris::move(int8_t direction) {
   return success;
 }
 
-bool Tetris::rotate(int8_t direction) {
+template<typename RowT, unsigned maxRows>
+bool BasicTetris<RowT, maxRows>::rotate(int8_t direction) {
   eraseTetromino();
 
   uint8_t oldRow = currentRow;
@@ -426,7 +537,8 @@ bool Tetris::rotate(int8_t direction) {
   return success;
 }
 
-bool Tetris::fall() {
+template<typename RowT, unsigned maxRows>
+bool BasicTetris<RowT, maxRows>::fall() {
   eraseTetromino();
   currentRow--;
   if (!isBlocked()) {
@@ -439,95 +551,154 @@ bool Tetris::fall() {
   }
 }
 
-void Tetris::hardDrop() {
+template<typename RowT, unsigned maxRows>
+void BasicTetris<RowT, maxRows>::hardDrop() {
   eraseTetromino();
-  while (!isBlocked()) {
-    currentRow--;
-  }
-  currentRow++;
+  currentRow -= getDropDistance();
   drawTetromino();
 }
 
-void Tetris::clearLines() {
-  uint8_t count = 0;
-  uint32_t linesMask = 0;
-  for (uint8_t row = 2; row < numRows; row++) {
+template<typename RowT, unsigned maxRows>
+void BasicTetris<RowT, maxRows>::lockTetromino() {
+  uint32_t extents = pgm_read_dword_near(&COLUMN_EXTENTS.values[unsigned(currentTetromino) * NUM_ROTATIONS + currentRotation]);
+  for (uint8_t col = 0; col < SHAPE_SIZE; col++, extents >>= 8) {
+    uint8_t top = currentRow + ((extents >> 4) & 0b1111);
+    if ((extents & 0b1111) != EMPTY_COLUMN && top > heights[currentCol + col]) {
+      heights[currentCol + col] = top;
+    }
+  }
+
+  falling = false;
+
+  // The floor rows are full too, but never cleared.
+  for (uint8_t row = currentRow < 2 ? 2 : currentRow; row < currentRow + SHAPE_SIZE; row++) {
     if (isLine(row)) {
-      linesMask |= (1 << row);
-      count++;
+      fullRows |= RowSet(1) << row;
+      clearDelay = LINE_CLEAR_FRAMES;
     }
   }
+}
 
-  if (count > 0) {
-    for (uint8_t i = 0; i < 5; i++) {
-      for (uint8_t row = 2; row < numRows; row++) {
-        if (linesMask & (1 << row)) {
-          rows[row] = (i % 2 == 0) ? emptyRow : fullRow;
-        }
-      }
-      render();
-      delay(30);
+template<typename RowT, unsigned maxRows>
+uint8_t BasicTetris<RowT, maxRows>::getDropDistance() const {
+  uint32_t extents = pgm_read_dword_near(&COLUMN_EXTENTS.values[unsigned(currentTetromino) * NUM_ROTATIONS + currentRotation]);
+  uint8_t distance = numRows;
+  for (uint8_t col = currentCol; col < currentCol + SHAPE_SIZE; col++, extents >>= 8) {
+    if ((extents & 0b1111) == EMPTY_COLUMN) {
+      continue;
+    }
+    uint8_t bottom = currentRow + (extents & 0b1111);
+    uint8_t height = heights[col];
+    if (height > bottom) {
+      // The piece has been tucked under an overhang, so look for the surface
+      // below it. The floor stops the search.
+      Row bit = Row(1) << col;
+      for (height = bottom; !(rows[height - 1] & bit); height--) {}
     }
+    if (bottom - height < distance) {
+      distance = bottom - height;
+    }
+  }
+  return distance;
+}
 
-    // Compute score at current level, not next level.
-    score += SCORE_MULTIPLIERS[count] * getLevel();
-    lines += count;
+template<typename RowT, unsigned maxRows>
+void BasicTetris<RowT, maxRows>::clearLines() {
+  RowSet linesMask = fullRows;
+  fullRows = 0;
+  clearDelay = 0;
+  if (!linesMask) {
+    return;
+  }
+
+  uint8_t count = countRows(linesMask);
+  // Compute score at current level, not next level.
+  score += SCORE_MULTIPLIERS[count] * getLevel();
+  lines += count;
 
-    for (uint8_t row = numRows - 1; row >= 2; row--) {
-      if (linesMask & (1 << row)) {
-        collapseRow(row);
+  uint8_t lowest = getLowestRow(linesMask);
+  uint8_t highest = lowest;
+  for (RowSet mask = linesMask >> lowest; mask >>= 1; ) {
+    highest++;
+  }
+
+  // Move each remaining row down over the cleared ones, in one pass.
+  uint8_t to = lowest;
+  for (uint8_t from = lowest; from < numRows; from++) {
+    if (!(linesMask & (RowSet(1) << from))) {
+      rows[to++] = rows[from];
+    }
+  }
+  for (; to < numRows; to++) {
+    rows[to] = emptyRow;
+  }
+
+  // Every column has a block in every full row, so every height is above the
+  // highest one. Blocks above it came down by count rows; a column whose top
+  // block was in that row has its new top somewhere below.
+  for (uint8_t col = 2; col < numCols - 2; col++) {
+    if (heights[col] > highest + 1) {
+      heights[col] -= count;
+    } else {
+      Row bit = Row(1) << col;
+      uint8_t height = highest + 1 - count;
+      while (!(rows[height - 1] & bit)) {
+        height--;
       }
+      heights[col] = height;
     }
-    render();
   }
 }
 
-bool Tetris::isLine(uint8_t row) const {
+template<typename RowT, unsigned maxRows>
+bool BasicTetris<RowT, maxRows>::isLine(uint8_t row) const {
   return (rows[row] & fullRow) == fullRow;
 }
 
-void Tetris::collapseRow(uint8_t row) {
-  for (; row < numRows - 1; row++) {
-    rows[row] = rows[row + 1]; 
-  }
-  rows[numRows - 1] = emptyRow;
-}
-
-Shape Tetris::getCurrentShape() const {
-  return SHAPES[unsigned(currentTetromino)][currentRotation];
+template<typename RowT, unsigned maxRows>
+typename BasicTetris<RowT, maxRows>::Row const *BasicTetris<RowT, maxRows>::getCurrentRowMasks() const {
+  return &RowMasks<Row>::table.values[RowMasks<Row>::getIndex(unsigned(currentTetromino), currentRotation, currentCol)];
 }
 
-uint8_t Tetris::fallInterval() const {
+template<typename RowT, unsigned maxRows>
+uint8_t BasicTetris<RowT, maxRows>::fallInterval() const {
   return 50 - 4 * getLevel();
 }
 
-void Tetris::drawTetromino() {
-  Shape shape = getCurrentShape();
+template<typename RowT, unsigned maxRows>
+void BasicTetris<RowT, maxRows>::drawTetromino() {
+  Row const *masks = getCurrentRowMasks();
   for (uint8_t row = 0; row < 4; row++) {
-    Row shapeRow = getShapeRow(shape, row) << currentCol;
-    rows[currentRow + row] |= shapeRow;
+    rows[currentRow + row] |= readRowMask(masks + row);
   }
 }
 
-void Tetris::eraseTetromino() {
-  Shape shape = getCurrentShape();
+template<typename RowT, unsigned maxRows>
+void BasicTetris<RowT, maxRows>::eraseTetromino() {
+  Row const *masks = getCurrentRowMasks();
   for (uint8_t row = 0; row < 4; row++) {
-    Row shapeRow = getShapeRow(shape, row) << currentCol;
-    rows[currentRow + row] &= ~shapeRow;
+    rows[currentRow + row] &= ~readRowMask(masks + row);
   }
 }
 
-bool Tetris::isBlocked() const {
-  Shape shape = getCurrentShape();
+template<typename RowT, unsigned maxRows>
+bool BasicTetris<RowT, maxRows>::isBlocked() const {
+  // Moving past the left edge or below the floor wraps currentCol or
+  // currentRow around; such positions are always blocked.
+  if (currentCol >= RowMasks<Row>::NUM_SHIFTS || currentRow + SHAPE_SIZE > numRows) {
+    return true;
+  }
+  Row const *masks = getCurrentRowMasks();
   for (uint8_t row = 0; row < 4; row++) {
-    Row shapeRow = getShapeRow(shape, row) << currentCol;
-    if (rows[currentRow + row] & shapeRow) {
+    if (rows[currentRow + row] & readRowMask(masks + row)) {
       return true;
     }
   }
   return false;
 }
 
-void Tetris::render() {
-  renderer.render(*this);
-}
+template class BasicTetris<uint16_t, 22>;
+#ifndef __AVR__
+template class BasicTetris<uint32_t, 32>;
+template class BasicTetris<uint64_t, 64>;
+#endif
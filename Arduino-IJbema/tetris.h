@@ -1,24 +1,21 @@
 #ifndef TETRIS_H_
 #define TETRIS_H_
 
-#include "tetrisrenderer.h"
+#include "prng.h"
 
 #include <stdint.h>
 
-class ButtonReader;
-
-unsigned const MAX_ROWS = 22;
-
-typedef uint16_t Row;
 typedef uint16_t Shape;
 
+// Updates between completing rows and clearing them, so they can be shown.
+uint8_t const LINE_CLEAR_FRAMES = 15;
+
 enum class Tetromino : uint8_t {
   I, J, L, O, S, T, Z,
   COUNT
 };
 
 unsigned const NUM_TETROMINOS = unsigned(Tetromino::COUNT);
-unsigned const NUM_PINS = 14;
 
 enum class TetrisButton : uint8_t {
   NONE         = 0,
@@ -38,42 +35,96 @@ inline bool operator&(TetrisButton a, TetrisButton b) {
   return uint8_t(a) & uint8_t(b);
 }
 
+/**
+ * What happened during a frame, as returned by Tetris::update().
+ */
+enum class TetrisEvent : uint8_t {
+  NONE         = 0,
+  CHANGED      = 0b00000001, // The board needs to be rendered again.
+  LOCKED       = 0b00000010, // The piece locked; lines may be about to clear.
+  HARD_DROPPED = 0b00000100,
+  GAME_OVER    = 0b00001000,
+  WON          = 0b00010000,
+};
+
+inline TetrisEvent operator|(TetrisEvent a, TetrisEvent b) {
+  return TetrisEvent(uint8_t(a) | uint8_t(b));
+}
+
+inline bool operator&(TetrisEvent a, TetrisEvent b) {
+  return uint8_t(a) & uint8_t(b);
+}
+
+/**
+ * Deals out tetrominos in random order, each one once per seven.
+ * The order only depends on the seed.
+ */
 class Bag {
   public:
-    Bag();
+    explicit Bag(uint32_t seed);
 
     Tetromino getNext();
 
   private:
     Tetromino tetrominos[NUM_TETROMINOS];
     uint8_t nextIndex;
+    Random random;
 
     void shuffle();
 };
 
 /**
- * Game logic for a single Tetris game. Input and output need to be wired up to this.
+ * Chooses A if the condition holds and B otherwise; avr-libc has no
+ * <type_traits>.
  */
-class Tetris {
+template<bool condition, typename A, typename B>
+struct SelectType {
+  typedef A type;
+};
+
+template<typename A, typename B>
+struct SelectType<false, A, B> {
+  typedef B type;
+};
+
+/**
+ * Game logic for a single Tetris game. It does no input or output of its own:
+ * the caller passes in the buttons held during each frame and draws the board
+ * whenever update() says it changed. See TetrisGame for the version that is
+ * wired up to the hardware.
+ *
+ * A board row is a RowT with a bit per column, walls included, and maxRows
+ * counts the floor and the rows above the visible ones too. The sketch uses
+ * Tetris; the wider instantiations in tetris.cpp are for the host only, as
+ * their tables would not fit in flash.
+ */
+template<typename RowT, unsigned maxRows>
+class BasicTetris {
 
   public:
 
+    typedef RowT Row;
+
+    // A bit per row, for sets of rows like the ones being cleared.
+    typedef typename SelectType<(maxRows <= 32), uint32_t, uint64_t>::type RowSet;
+
+    static unsigned const MAX_ROWS = maxRows;
+    static unsigned const MAX_COLS = 8 * sizeof(Row);
+
     /**
      * Creates and initializes game state.
      * Standard Tetris is 20 visible rows, 10 columns, but the maximum on our
      * LCD is 15 rows, 18 columns.
+     * Two games with the same seed and the same input play out identically.
      */
-    Tetris(uint8_t numVisibleRows, uint8_t numCols, ButtonReader &buttonReader, LiquidCrystal &lcd);
-
-    /**
-     * Sets up a button mapping.
-     */
-    void mapButton(int pin, TetrisButton button);
+    BasicTetris(uint8_t numVisibleRows, uint8_t numCols, uint32_t seed);
 
     /**
-     * Plays a game of Tetris and returns when the game is over.
+     * Advances the game by one frame (1/60th of a second) in which the given
+     * buttons were held. Once GAME_OVER or WON has been returned, the game
+     * should not be updated any further.
      */
-    void play();
+    TetrisEvent update(TetrisButton buttons);
 
     uint8_t getNumRows() const;
     uint8_t getNumCols() const;
@@ -85,9 +136,61 @@ class Tetris {
      */
     bool getPixel(uint8_t row, uint8_t col) const;
 
+    /**
+     * After a LOCKED event, the rows that are complete and will be cleared
+     * LINE_CLEAR_FRAMES updates later, numbered as in getPixel(). Zero
+     * otherwise.
+     */
+    RowSet getClearingRows() const { return fullRows >> 1; }
+
+    /**
+     * While there are clearing rows, the number of updates until they go,
+     * counting down from LINE_CLEAR_FRAMES.
+     */
+    uint8_t getClearingFramesLeft() const { return clearDelay; }
+
     uint8_t getLevel() const { return 1 + lines / 10; }
+    uint8_t getLines() const { return lines; }
     uint16_t getScore() const { return score; }
 
+    /**
+     * The board in one word per row, numbered as in getPixel(), with a bit per
+     * column. Includes the falling piece.
+     */
+    Row getRow(uint8_t row) const { return rows[row + 1]; }
+
+    /**
+     * One more than the topmost locked block in the column, numbered as in
+     * getPixel(). The falling piece is not included.
+     */
+    uint8_t getHeight(uint8_t col) const { return heights[col] - 1; }
+
+    bool isFalling() const { return falling; }
+    Tetromino getCurrentTetromino() const { return currentTetromino; }
+
+    /**
+     * For computer players, which decide on a whole placement at once rather
+     * than pressing buttons frame by frame. These act on the falling piece
+     * like the buttons do, but without cooldowns or gravity, and return false
+     * if the piece is blocked.
+     */
+    bool shift(int8_t direction) { return falling && move(direction); }
+    bool turn(int8_t direction) { return falling && rotate(direction); }
+    bool lower() { return falling && fall(); }
+
+    /**
+     * Hard drops and locks the falling piece and clears the lines it
+     * completes. The next piece comes in on the next update().
+     */
+    void drop();
+
+    /**
+     * Puts the given tetromino in play instead of the next one from the bag,
+     * replacing any falling piece, so a player can try out pieces it has not
+     * been dealt yet on a copy of the game. Returns false if it does not fit.
+     */
+    bool spawnTetromino(Tetromino tetromino);
+
   private:
 
     uint8_t const numRows;
@@ -96,28 +199,37 @@ class Tetris {
     Row const emptyRow;
     Row const fullRow;
 
-    TetrisButton buttonMappings[NUM_PINS];
-
     uint8_t lines;
     uint16_t score;
 
     Bag bag;
     Row rows[MAX_ROWS];
 
+    // Kept up to date as pieces lock and lines collapse; they only cover locked
+    // blocks, not the falling piece.
+    // For each column, the row just above its topmost block (2 if empty).
+    uint8_t heights[MAX_COLS];
+    // Bit per row that is completely filled.
+    RowSet fullRows;
+    uint8_t clearDelay;
+
     Tetromino currentTetromino;
     uint8_t currentRotation;
     uint8_t currentRow;
     uint8_t currentCol;
 
-    ButtonReader &buttonReader;
-    TetrisRenderer renderer;
+    // State of the falling piece, carried from one frame to the next.
+    bool falling;
+    bool locking;
+    uint8_t lockDelay;
+    uint8_t framesUntilFall;
+    uint8_t moveCooldown;
+    uint8_t rotateCooldown;
+    uint8_t softDropCooldown;
 
-    void dropTetromino();
+    TetrisEvent dropTetromino(TetrisButton buttons);
     void clearLines();
-    void animateGameOver();
-    void animateWin();
 
-    TetrisButton readButtons();
     bool spawn();
     void drawTetromino();
     void eraseTetromino();
@@ -125,13 +237,45 @@ class Tetris {
     bool rotate(int8_t direction);
     bool fall();
     void hardDrop();
+    void lockTetromino();
+    // Rows the current piece can fall before it lands; also where a ghost piece would go.
+    uint8_t getDropDistance() const;
     bool isLine(uint8_t row) const;
-    void collapseRow(uint8_t row);
     bool isBlocked() const;
-    Shape getCurrentShape() const;
+    Row const *getCurrentRowMasks() const;
     uint8_t fallInterval() const;
-
-    void render();
 };
 
+template<typename RowT, unsigned maxRows>
+unsigned const BasicTetris<RowT, maxRows>::MAX_ROWS;
+
+template<typename RowT, unsigned maxRows>
+unsigned const BasicTetris<RowT, maxRows>::MAX_COLS;
+
+/**
+ * The board the sketch plays on: up to 12 columns between the walls.
+ */
+typedef BasicTetris<uint16_t, 22> Tetris;
+
+#ifndef __AVR__
+/**
+ * For simulating bigger boards on the host: up to 28 columns and 28 rows
+ * without walls and floor.
+ */
+typedef BasicTetris<uint32_t, 32> MediumTetris;
+
+/**
+ * Up to 60 columns and 60 rows without walls and floor.
+ */
+typedef BasicTetris<uint64_t, 64> WideTetris;
+#endif
+
+typedef Tetris::Row Row;
+unsigned const MAX_ROWS = Tetris::MAX_ROWS;
+unsigned const MAX_COLS = Tetris::MAX_COLS;
+
+// The smallest board every piece fits on lying down, without walls and floor.
+unsigned const MIN_VISIBLE_ROWS = 2;
+unsigned const MIN_COLS = 4;
+
 #endif
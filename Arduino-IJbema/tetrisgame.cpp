@@ -0,0 +1,218 @@
+#include "tetrisgame.h"
+
+#include "buttoninput.h"
+#include "journal.h"
+#include "profiler.h"
+
+#include <Arduino.h>
+
+namespace {
+
+// All in frames of the frame clock.
+uint8_t const LINE_FLASHES = 5;
+uint8_t const LINE_FLASH_FRAMES = LINE_CLEAR_FRAMES / LINE_FLASHES;
+uint8_t const ROW_FILL_FRAMES = 6;
+uint16_t const GAME_OVER_PAUSE_FRAMES = 120;
+uint8_t const MESSAGE_FLASHES = 3;
+uint8_t const MESSAGE_FLASH_FRAMES = 12;
+uint16_t const MESSAGE_HOLD_FRAMES = 180;
+uint8_t const WIPE_STEPS = 16;
+uint8_t const WIPE_STEP_FRAMES = 6;
+uint16_t const MESSAGE_FRAMES = 2 * MESSAGE_FLASHES * MESSAGE_FLASH_FRAMES + MESSAGE_HOLD_FRAMES + WIPE_STEPS * WIPE_STEP_FRAMES;
+uint16_t const WIN_PAUSE_FRAMES = 60;
+
+}
+
+TetrisGame::TetrisGame(uint8_t numVisibleRows, uint8_t numCols, uint32_t seed, ButtonInput &buttonInput, FastLCD &lcd, TextLayer &text, Journal &journal)
+  :
+    buttonMappings{TetrisButton::NONE},
+    buttonInput(buttonInput),
+    seed(seed),
+    tetris(numVisibleRows, numCols, seed),
+    renderer(lcd, text),
+    journal(journal),
+    flashPhase(0)
+#ifdef RECORD_INPUT
+    , recorder(Serial)
+#endif
+{
+#ifdef RECORD_INPUT
+  recorder.begin(numVisibleRows, numCols, seed);
+#endif
+}
+
+void TetrisGame::mapButton(int pin, TetrisButton button) {
+  buttonMappings[pin] = button;
+}
+
+void TetrisGame::play() {
+  renderer.begin();
+  // Whatever got us here, like the press that interrupted the quote, isn't
+  // meant for the game.
+  buttonInput.flush();
+  frameClock.begin();
+
+  TetrisEvent ending = TetrisEvent::NONE;
+  uint16_t endingFrame = 0;
+  while (true) {
+    uint8_t ticks;
+    while ((ticks = frameClock.takeTicks()) == 0) {
+    }
+    TetrisButton buttons = readButtons();
+    PROFILE_POLL();
+
+    if (ending != TetrisEvent::NONE) {
+      // Buttons are still taken in, so no stale presses pile up, but the end
+      // screens can't be cut short. The result is saved meanwhile.
+      journal.step();
+      for (uint8_t i = 0; i < ticks; i++) {
+        bool more = (ending & TetrisEvent::WON) ? stepWin(endingFrame) : stepGameOver(endingFrame);
+        endingFrame++;
+        if (!more) {
+          frameClock.end();
+          journal.finish();
+          return;
+        }
+      }
+      continue;
+    }
+
+    // Run the game logic once per tick to keep up after a slow frame.
+    TetrisEvent events = TetrisEvent::NONE;
+    {
+      PROFILE_ZONE(LOGIC);
+      for (uint8_t i = 0; i < ticks && i < MAX_CATCH_UP_FRAMES; i++) {
+        TetrisEvent frameEvents = tetris.update(buttons);
+#ifdef RECORD_INPUT
+        recorder.record(buttons);
+#endif
+        events = events | frameEvents;
+        if (frameEvents & (TetrisEvent::GAME_OVER | TetrisEvent::WON)) {
+          break;
+        }
+        // One press is one hard drop, however many frames it is caught up on.
+        buttons = TetrisButton(uint8_t(buttons) & ~uint8_t(TetrisButton::HARD_DROP));
+      }
+    }
+
+    if (events & (TetrisEvent::GAME_OVER | TetrisEvent::WON)) {
+#ifdef RECORD_INPUT
+      recorder.end();
+      Serial.print(F("Missed frames: "));
+      Serial.println(frameClock.getMissedTicks());
+#endif
+      journal.recordGame(tetris.getScore(), tetris.getLevel(), tetris.getLines());
+      ending = events & TetrisEvent::WON ? TetrisEvent::WON : TetrisEvent::GAME_OVER;
+      endingFrame = 0;
+      continue;
+    }
+    if (events & TetrisEvent::LOCKED) {
+      flashPhase = LINE_FLASHES;
+    }
+    if (tetris.getClearingRows()) {
+      flashLines();
+    } else if (events & TetrisEvent::CHANGED) {
+      renderer.render(tetris);
+    }
+  }
+}
+
+TetrisButton TetrisGame::readButtons() {
+  PROFILE_ZONE(READ_BUTTONS);
+  // The buttons held now, and those that went down since the previous frame
+  // even if they have been released again.
+  uint16_t pressedPins = 0;
+  ButtonEvent event;
+  while (buttonInput.poll(event)) {
+    if (event.pressed) {
+      pressedPins |= 1u << event.pin;
+    }
+  }
+  uint16_t pins = pressedPins | buttonInput.getPressedPins();
+
+  TetrisButton buttons = TetrisButton::NONE;
+  for (unsigned pin = 0; pin < NUM_PINS; pin++) {
+    TetrisButton button = buttonMappings[pin];
+    // Holding hard drop doesn't drop piece after piece; it takes a new press.
+    uint16_t buttonPins = button == TetrisButton::HARD_DROP ? pressedPins : pins;
+    if (button != TetrisButton::NONE && (buttonPins & (1u << pin))) {
+      buttons = buttons | button;
+    }
+  }
+  return buttons;
+}
+
+void TetrisGame::flashLines() {
+  // Alternates between the rows drawn hollow and solid, starting hollow,
+  // LINE_FLASH_FRAMES each.
+  uint8_t phase = (tetris.getClearingFramesLeft() - 1) / LINE_FLASH_FRAMES;
+  if (phase == flashPhase) {
+    return;
+  }
+  flashPhase = phase;
+  uint32_t clearingRows = tetris.getClearingRows();
+  if (phase % 2 == 0) {
+    renderer.render(tetris, 0, clearingRows);
+  } else {
+    renderer.render(tetris, clearingRows, 0);
+  }
+}
+
+bool TetrisGame::stepGameOver(uint16_t frame) {
+  // Fills the board from the bottom up, a row at a time.
+  uint16_t fillFrames = (tetris.getNumRows() - 1) * ROW_FILL_FRAMES;
+  if (frame < fillFrames) {
+    if (frame % ROW_FILL_FRAMES == 0) {
+      uint32_t solidRows = (uint32_t(1) << (frame / ROW_FILL_FRAMES + 2)) - 2;
+      renderer.render(tetris, solidRows);
+    }
+    return true;
+  }
+  frame -= fillFrames;
+  if (frame < GAME_OVER_PAUSE_FRAMES) {
+    return true;
+  }
+  return stepMessage(frame - GAME_OVER_PAUSE_FRAMES,
+      F("   De stekker   "),
+      F("   is  eruit!   "));
+}
+
+bool TetrisGame::stepWin(uint16_t frame) {
+  if (frame < MESSAGE_FRAMES) {
+    return stepMessage(frame,
+        F("    Je hebt    "),
+        F("   gewonnen.   "));
+  }
+  frame -= MESSAGE_FRAMES;
+  if (frame < WIN_PAUSE_FRAMES) {
+    return true;
+  }
+  return stepMessage(frame - WIN_PAUSE_FRAMES,
+      F("  Dat lijkt me  "),
+      F("    evident.    "));
+}
+
+bool TetrisGame::stepMessage(uint16_t frame, __FlashStringHelper const *firstLine, __FlashStringHelper const *secondLine) {
+  // Flashes the message, leaves it up for a while and wipes it off to the left.
+  uint16_t flashFrames = 2 * MESSAGE_FLASHES * MESSAGE_FLASH_FRAMES;
+  if (frame < flashFrames) {
+    if (frame % (2 * MESSAGE_FLASH_FRAMES) == 0) {
+      renderer.clearText();
+    } else if (frame % (2 * MESSAGE_FLASH_FRAMES) == MESSAGE_FLASH_FRAMES) {
+      renderer.showText(firstLine, secondLine);
+    }
+    return true;
+  }
+  frame -= flashFrames;
+  if (frame < MESSAGE_HOLD_FRAMES) {
+    return true;
+  }
+  frame -= MESSAGE_HOLD_FRAMES;
+  if (frame < WIPE_STEPS * WIPE_STEP_FRAMES) {
+    if (frame % WIPE_STEP_FRAMES == 0) {
+      renderer.scrollLeft();
+    }
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,69 @@
+#ifndef TETRISGAME_H_
+#define TETRISGAME_H_
+
+#include "frameclock.h"
+#include "inputlog.h"
+#include "tetris.h"
+#include "tetrisrenderer.h"
+
+#include <stdint.h>
+
+class ButtonInput;
+class Journal;
+class FastLCD;
+class TextLayer;
+
+unsigned const NUM_PINS = 14;
+
+/**
+ * How many frames of game logic may run back to back to make up for a frame
+ * that took longer than a tick. Any further ticks are dropped and the game
+ * slows down.
+ */
+uint8_t const MAX_CATCH_UP_FRAMES = 4;
+
+/**
+ * A game of Tetris on the hardware: reads the buttons, runs the game logic
+ * 60 frames per second and shows it on the LCD.
+ */
+class TetrisGame {
+  public:
+    TetrisGame(uint8_t numVisibleRows, uint8_t numCols, uint32_t seed, ButtonInput &buttonInput, FastLCD &lcd, TextLayer &text, Journal &journal);
+
+    /**
+     * Sets up a button mapping.
+     */
+    void mapButton(int pin, TetrisButton button);
+
+    /**
+     * Plays a game of Tetris and returns when the game is over, with the
+     * result saved in the journal.
+     */
+    void play();
+
+  private:
+    TetrisButton buttonMappings[NUM_PINS];
+    ButtonInput &buttonInput;
+
+    uint32_t const seed;
+    Tetris tetris;
+    TetrisRenderer renderer;
+    Journal &journal;
+    FrameClock frameClock;
+    // Of the line clear flash, to draw only when it changes.
+    uint8_t flashPhase;
+#ifdef RECORD_INPUT
+    InputRecorder recorder;
+#endif
+
+    TetrisButton readButtons();
+    void flashLines();
+
+    // The end screens, one frame at a time: frame counts from 0 when the game
+    // ends, and they return false once past their last frame.
+    bool stepGameOver(uint16_t frame);
+    bool stepWin(uint16_t frame);
+    bool stepMessage(uint16_t frame, __FlashStringHelper const *firstLine, __FlashStringHelper const *secondLine);
+};
+
+#endif
@@ -1,54 +1,104 @@
 #include "tetrisrenderer.h"
 
+#include "profiler.h"
 #include "tetris.h"
+#include "textlayer.h"
 
-TetrisRenderer::TetrisRenderer(LiquidCrystal &lcd)
+namespace {
+
+// Pixel column of the left wall.
+uint8_t const BOARD_X = 3;
+
+}
+
+TetrisRenderer::TetrisRenderer(FastLCD &lcd, TextLayer &text)
 :
   lcd(lcd),
+  text(text),
+#ifdef TILED_PLAYFIELD
+  screen(lcd, text)
+#else
   bitmap(&lcd, 0, 0)
+#endif
 {
 }
 
 void TetrisRenderer::begin() {
-  lcd.clear();
+  text.clear();
+#ifdef TILED_PLAYFIELD
+  screen.begin();
+#else
   bitmap.begin();
+
+  // Mirror the bitmap's custom characters in the text layer, so text updates
+  // never overwrite them.
+  for (uint8_t c = 0; c < BITMAP_CHAR; c++) {
+    if (c % 4 == 0) {
+      text.setCursor(0, c / 4);
+    }
+    text.write(c);
+  }
+#endif
+  text.update();
 }
 
-void TetrisRenderer::render(Tetris const &tetris) {
+void TetrisRenderer::render(Tetris const &tetris, uint32_t solidRows, uint32_t hollowRows) {
+  PROFILE_ZONE(RENDER);
   uint8_t numRows = tetris.getNumRows();
   uint8_t numCols = tetris.getNumCols();
+  uint32_t boardMask = (uint32_t(1) << numCols) - 1;
+  uint32_t walls = uint32_t(1) | uint32_t(1) << (numCols - 1);
   for (uint8_t row = 0; row < numRows; row++) {
+    uint32_t rowBit = uint32_t(1) << row;
+    // Bit per column, as in Tetris::getRow().
+    uint32_t bits;
+    if (solidRows & rowBit) {
+      bits = boardMask & ~walls;
+    } else if (hollowRows & rowBit) {
+      bits = uint32_t(1) << 1 | uint32_t(1) << (numCols - 2);
+    } else {
+      bits = tetris.getRow(row) & boardMask;
+    }
+#ifdef TILED_PLAYFIELD
     for (uint8_t col = 0; col < numCols; col++) {
-      bitmap.pixel(3 + col, 15 - row, tetris.getPixel(row, col) ? ON : OFF, NO_UPDATE);
+      screen.pixel(BOARD_X + col, 15 - row, (bits >> col) & 1);
     }
+#else
+    bitmap.setRow(15 - row, bits << BOARD_X);
+#endif
   }
+#ifdef TILED_PLAYFIELD
+  // The text goes right after the board.
+  uint8_t textCol = (BOARD_X + numCols + TILE_W - 1) / TILE_W;
+  screen.update(textCol);
+#else
+  uint8_t textCol = 4;
   bitmap.update();
+#endif
 
-  lcd.setCursor(4, 0);
-  lcd.print("Score: ");
-  lcd.print(tetris.getScore());
+  text.setCursor(textCol, 0);
+  text.print(F("Score: "));
+  text.print(tetris.getScore());
 
-  lcd.setCursor(4, 1);
-  lcd.print("Level: ");
-  lcd.print(tetris.getLevel());
+  text.setCursor(textCol, 1);
+  text.print(F("Level: "));
+  text.print(tetris.getLevel());
+  text.update();
 }
 
-void TetrisRenderer::flashText(__FlashStringHelper const *firstLine, __FlashStringHelper const *secondLine) {
-  for (int i = 0; i < 3; i++) {
-    lcd.clear();
-    delay(200);
+void TetrisRenderer::showText(__FlashStringHelper const *firstLine, __FlashStringHelper const *secondLine) {
+  text.clear();
+  text.setCursor(0, 0);
+  text.print(firstLine);
+  text.setCursor(0, 1);
+  text.print(secondLine);
+  text.update();
+}
 
-    lcd.setCursor(0, 0);
-    lcd.print(firstLine);
-    lcd.setCursor(0, 1);
-    lcd.print(secondLine);
-    delay(200);
-  }
+void TetrisRenderer::clearText() {
+  text.clear();
 }
 
-void TetrisRenderer::wipeLeft() {
-  for (int i = 0; i < 16; i++) {
-    lcd.scrollDisplayLeft();
-    delay(100);
-  }
+void TetrisRenderer::scrollLeft() {
+  lcd.scrollDisplayLeft();
 }
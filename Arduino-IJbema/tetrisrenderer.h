@@ -2,24 +2,49 @@
 #define TETRISRENDERER_H_
 
 #include "LCDBitmap.h"
+#include "tetris.h"
+#include "tilescreen.h"
 
 #include <Arduino.h>
 
-class LiquidCrystal;
-class Tetris;
+//#define TILED_PLAYFIELD // Uncomment to draw the board with TileScreen instead of LCDBitmap: it takes only the characters it covers, however many that is, and the text moves up against it.
+
+class FastLCD;
+class TextLayer;
 
 class TetrisRenderer {
   public:
-    explicit TetrisRenderer(LiquidCrystal &lcd);
+    TetrisRenderer(FastLCD &lcd, TextLayer &text);
 
     void begin();
-    void render(Tetris const &tetris);
-    void flashText(__FlashStringHelper const *firstLine, __FlashStringHelper const *secondLine);
-    void wipeLeft();
+
+    /**
+     * Draws the board. Rows in solidRows are drawn filled from wall to wall,
+     * rows in hollowRows as empty, regardless of their contents; both are
+     * numbered as in Tetris::getPixel().
+     */
+    void render(Tetris const &tetris, uint32_t solidRows = 0, uint32_t hollowRows = 0);
+
+    /**
+     * Replaces everything on the display by two lines of text.
+     */
+    void showText(__FlashStringHelper const *firstLine, __FlashStringHelper const *secondLine);
+    void clearText();
+
+    /**
+     * Moves the whole display one character to the left; sixteen of these
+     * wipe it. Undone by the next showText() or clearText().
+     */
+    void scrollLeft();
 
   private:
-    LiquidCrystal &lcd;
+    FastLCD &lcd;
+    TextLayer &text;
+#ifdef TILED_PLAYFIELD
+    TileScreen screen;
+#else
     LCDBitmap bitmap;
+#endif
 };
 
 #endif
@@ -0,0 +1,86 @@
+#include "textlayer.h"
+
+#include "fastlcd.h"
+
+namespace {
+
+uint16_t const ALL_KNOWN = uint16_t((1ul << TEXT_COLS) - 1);
+
+// Gaps of up to this many unchanged characters are written again, which
+// takes no more bytes than a setCursor command to jump them.
+uint8_t const MAX_REWRITTEN_GAP = 1;
+
+}
+
+TextLayer::TextLayer(FastLCD &lcd) :
+  lcd(lcd),
+  cursorCol(0),
+  cursorRow(0)
+{
+  for (uint8_t row = 0; row < TEXT_ROWS; row++) {
+    for (uint8_t col = 0; col < TEXT_COLS; col++) {
+      pending[row][col] = ' ';
+    }
+  }
+  invalidate();
+}
+
+void TextLayer::clear() {
+  lcd.clear();
+  for (uint8_t row = 0; row < TEXT_ROWS; row++) {
+    for (uint8_t col = 0; col < TEXT_COLS; col++) {
+      pending[row][col] = ' ';
+      shown[row][col] = ' ';
+    }
+    knownBits[row] = ALL_KNOWN;
+  }
+  cursorCol = 0;
+  cursorRow = 0;
+}
+
+void TextLayer::invalidate() {
+  for (uint8_t row = 0; row < TEXT_ROWS; row++) {
+    knownBits[row] = 0;
+  }
+}
+
+void TextLayer::setCursor(uint8_t col, uint8_t row) {
+  cursorCol = col;
+  cursorRow = row;
+}
+
+size_t TextLayer::write(uint8_t c) {
+  if (cursorCol >= TEXT_COLS || cursorRow >= TEXT_ROWS) {
+    return 0;
+  }
+  pending[cursorRow][cursorCol++] = c;
+  return 1;
+}
+
+bool TextLayer::isChanged(uint8_t row, uint8_t col) const {
+  return !(knownBits[row] & (1u << col)) || pending[row][col] != shown[row][col];
+}
+
+void TextLayer::update() {
+  for (uint8_t row = 0; row < TEXT_ROWS; row++) {
+    // Column the LCD's address counter points at, or TEXT_COLS if it is not on
+    // this row. Other code may have moved it since the last update.
+    uint8_t lcdCol = TEXT_COLS;
+    for (uint8_t col = 0; col < TEXT_COLS; col++) {
+      if (!isChanged(row, col)) {
+        continue;
+      }
+      if (lcdCol < col && col - lcdCol <= MAX_REWRITTEN_GAP) {
+        for (; lcdCol < col; lcdCol++) {
+          lcd.write(uint8_t(pending[row][lcdCol]));
+        }
+      } else if (lcdCol != col) {
+        lcd.setCursor(col, row);
+      }
+      lcd.write(uint8_t(pending[row][col]));
+      shown[row][col] = pending[row][col];
+      lcdCol = col + 1;
+    }
+    knownBits[row] = ALL_KNOWN;
+  }
+}
@@ -0,0 +1,55 @@
+#ifndef TEXTLAYER_H_
+#define TEXTLAYER_H_
+
+#include <Arduino.h>
+
+class FastLCD;
+
+uint8_t const TEXT_COLS = 16;
+uint8_t const TEXT_ROWS = 2;
+
+/**
+ * A copy of the characters on the LCD, kept in RAM.
+ * Text is printed into a back buffer; update() compares it against what the
+ * display is known to show and only sends the characters that changed, with
+ * as few cursor moves as possible.
+ */
+class TextLayer : public Print {
+  public:
+    explicit TextLayer(FastLCD &lcd);
+
+    /**
+     * Clears the display and both buffers.
+     */
+    void clear();
+
+    /**
+     * Forgets what the display shows, so the next update() rewrites every
+     * character. Needed after writing to the LCD without going through here.
+     */
+    void invalidate();
+
+    void setCursor(uint8_t col, uint8_t row);
+
+    virtual size_t write(uint8_t c);
+    using Print::write;
+
+    /**
+     * Sends the changed characters to the LCD.
+     */
+    void update();
+
+  private:
+    FastLCD &lcd;
+
+    char pending[TEXT_ROWS][TEXT_COLS];
+    char shown[TEXT_ROWS][TEXT_COLS];
+    uint16_t knownBits[TEXT_ROWS];
+
+    uint8_t cursorCol;
+    uint8_t cursorRow;
+
+    bool isChanged(uint8_t row, uint8_t col) const;
+};
+
+#endif
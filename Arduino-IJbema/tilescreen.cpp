@@ -0,0 +1,179 @@
+#include "tilescreen.h"
+
+#include "fastlcd.h"
+
+namespace {
+
+uint8_t const BLANK_CHAR = ' ';
+uint8_t const SOLID_CHAR = 0xFF; // A full block in the character ROM.
+uint8_t const BLANK_GLYPH[TILE_H] = {0, 0, 0, 0, 0, 0, 0, 0};
+uint8_t const SOLID_GLYPH[TILE_H] = {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F};
+
+uint8_t const MAX_TILES = TEXT_ROWS * TEXT_COLS;
+// Stand-ins for the index of a distinct tile.
+uint8_t const BLANK_TILE = 0xFE;
+uint8_t const SOLID_TILE = 0xFF;
+uint8_t const NO_SLOT = 0xFF;
+
+bool isSame(uint8_t const *a, uint8_t const *b) {
+  for (uint8_t row = 0; row < TILE_H; row++) {
+    if (a[row] != b[row]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint8_t countDifferences(uint8_t const *a, uint8_t const *b) {
+  uint8_t count = 0;
+  for (uint8_t row = 0; row < TILE_H; row++) {
+    count += __builtin_popcount(a[row] ^ b[row]);
+  }
+  return count;
+}
+
+}
+
+TileScreen::TileScreen(FastLCD &lcd, TextLayer &text)
+  :
+    lcd(lcd),
+    text(text)
+{
+}
+
+void TileScreen::begin() {
+  clear();
+  for (uint8_t slot = 0; slot < NUM_GLYPHS; slot++) {
+    for (uint8_t row = 0; row < TILE_H; row++) {
+      glyphs[slot][row] = UNKNOWN_ROW;
+    }
+  }
+}
+
+void TileScreen::clear() {
+  for (uint8_t y = 0; y < TEXT_ROWS; y++) {
+    for (uint8_t x = 0; x < TEXT_COLS; x++) {
+      for (uint8_t row = 0; row < TILE_H; row++) {
+        tiles[y][x][row] = 0;
+      }
+    }
+  }
+}
+
+void TileScreen::pixel(uint8_t x, uint8_t y, bool on) {
+  uint8_t &row = tiles[y / TILE_H][x / TILE_W][y % TILE_H];
+  uint8_t mask = 0x10 >> (x % TILE_W);
+  if (on) {
+    row |= mask;
+  } else {
+    row &= ~mask;
+  }
+}
+
+void TileScreen::update(uint8_t numCols) {
+  // The tiles that need a custom character, each with the first tile that
+  // looks like it (numbered row * TEXT_COLS + col), how many tiles do, and
+  // in the end the character they are drawn with.
+  uint8_t distinctTiles[MAX_TILES];
+  uint8_t distinctUses[MAX_TILES];
+  uint8_t distinctChars[MAX_TILES];
+  uint8_t numDistinct = 0;
+  // For each tile, its distinct tile, BLANK_TILE or SOLID_TILE.
+  uint8_t tileKinds[TEXT_ROWS][TEXT_COLS];
+
+  for (uint8_t y = 0; y < TEXT_ROWS; y++) {
+    for (uint8_t x = 0; x < numCols; x++) {
+      uint8_t const *tile = tiles[y][x];
+      uint8_t kind;
+      if (isSame(tile, BLANK_GLYPH)) {
+        kind = BLANK_TILE;
+      } else if (isSame(tile, SOLID_GLYPH)) {
+        kind = SOLID_TILE;
+      } else {
+        for (kind = 0; kind < numDistinct; kind++) {
+          uint8_t first = distinctTiles[kind];
+          if (isSame(tile, tiles[first / TEXT_COLS][first % TEXT_COLS])) {
+            break;
+          }
+        }
+        if (kind == numDistinct) {
+          distinctTiles[kind] = y * TEXT_COLS + x;
+          distinctUses[kind] = 0;
+          distinctChars[kind] = NO_SLOT;
+          numDistinct++;
+        }
+        distinctUses[kind]++;
+      }
+      tileKinds[y][x] = kind;
+    }
+  }
+
+  // Tiles that a custom character already shows keep it.
+  uint8_t freeSlots = (1 << NUM_GLYPHS) - 1;
+  for (uint8_t d = 0; d < numDistinct; d++) {
+    uint8_t const *tile = tiles[distinctTiles[d] / TEXT_COLS][distinctTiles[d] % TEXT_COLS];
+    for (uint8_t slot = 0; slot < NUM_GLYPHS; slot++) {
+      if ((freeSlots & (1 << slot)) && isSame(tile, glyphs[slot])) {
+        distinctChars[d] = slot;
+        freeSlots &= ~(1 << slot);
+        break;
+      }
+    }
+  }
+
+  // The most used of the others get the slots left.
+  uint8_t dirty[NUM_GLYPHS] = {0};
+  while (freeSlots) {
+    uint8_t best = NO_SLOT;
+    for (uint8_t d = 0; d < numDistinct; d++) {
+      if (distinctChars[d] == NO_SLOT && (best == NO_SLOT || distinctUses[d] > distinctUses[best])) {
+        best = d;
+      }
+    }
+    if (best == NO_SLOT) {
+      break;
+    }
+    uint8_t slot = __builtin_ctz(freeSlots);
+    freeSlots &= ~(1 << slot);
+    distinctChars[best] = slot;
+    uint8_t const *tile = tiles[distinctTiles[best] / TEXT_COLS][distinctTiles[best] % TEXT_COLS];
+    for (uint8_t row = 0; row < TILE_H; row++) {
+      if (glyphs[slot][row] != tile[row]) {
+        glyphs[slot][row] = tile[row];
+        dirty[slot] |= 1 << row;
+      }
+    }
+  }
+  lcd.writeGlyphRows(&glyphs[0][0], TILE_H, NUM_GLYPHS, dirty);
+
+  // Any tiles still without a character make do with the nearest one.
+  for (uint8_t d = 0; d < numDistinct; d++) {
+    if (distinctChars[d] != NO_SLOT) {
+      continue;
+    }
+    uint8_t const *tile = tiles[distinctTiles[d] / TEXT_COLS][distinctTiles[d] % TEXT_COLS];
+    uint8_t bestChar = BLANK_CHAR;
+    uint8_t bestDifferences = countDifferences(tile, BLANK_GLYPH);
+    uint8_t differences = countDifferences(tile, SOLID_GLYPH);
+    if (differences < bestDifferences) {
+      bestChar = SOLID_CHAR;
+      bestDifferences = differences;
+    }
+    for (uint8_t slot = 0; slot < NUM_GLYPHS; slot++) {
+      differences = countDifferences(tile, glyphs[slot]);
+      if (differences < bestDifferences) {
+        bestChar = slot;
+        bestDifferences = differences;
+      }
+    }
+    distinctChars[d] = bestChar;
+  }
+
+  for (uint8_t y = 0; y < TEXT_ROWS; y++) {
+    text.setCursor(0, y);
+    for (uint8_t x = 0; x < numCols; x++) {
+      uint8_t kind = tileKinds[y][x];
+      text.write(kind == BLANK_TILE ? BLANK_CHAR : kind == SOLID_TILE ? SOLID_CHAR : distinctChars[kind]);
+    }
+  }
+}
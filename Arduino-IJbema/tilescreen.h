@@ -0,0 +1,64 @@
+#ifndef TILESCREEN_H_
+#define TILESCREEN_H_
+
+#include "textlayer.h"
+
+#include <stdint.h>
+
+class FastLCD;
+
+uint8_t const TILE_W = 5;
+uint8_t const TILE_H = 8;
+uint8_t const NUM_GLYPHS = 8;
+
+/**
+ * A bitmap over the whole display, one 5x8 tile per character, drawn with
+ * whatever characters the tiles need rather than a fixed block of the eight
+ * custom ones. Blank tiles become spaces and solid ones the ROM's full block,
+ * tiles that look the same share a custom character, and the eight custom
+ * characters go to the distinct tiles that remain. A custom character keeps
+ * its slot for as long as some tile still shows it, so from frame to frame
+ * only new tiles get uploaded.
+ *
+ * With more than eight distinct tiles, the ones used most get the slots and
+ * the others are drawn as whichever available character differs from them in
+ * the fewest pixels.
+ *
+ * The characters are written into the TextLayer, which then needs an
+ * update().
+ */
+class TileScreen {
+  public:
+    TileScreen(FastLCD &lcd, TextLayer &text);
+
+    /**
+     * Clears the bitmap and forgets what the custom characters hold.
+     */
+    void begin();
+
+    void clear();
+
+    /**
+     * x counts 0 to 79 from the left, y 0 to 15 from the top.
+     */
+    void pixel(uint8_t x, uint8_t y, bool on);
+
+    /**
+     * Shows the tiles of the leftmost numCols columns; the rest of the
+     * display is left to the text.
+     */
+    void update(uint8_t numCols);
+
+  private:
+    // Glyph rows only use five bits, so this is never the contents of one.
+    static uint8_t const UNKNOWN_ROW = 0xFF;
+
+    FastLCD &lcd;
+    TextLayer &text;
+
+    uint8_t tiles[TEXT_ROWS][TEXT_COLS][TILE_H];
+    // What the LCD's custom characters hold.
+    uint8_t glyphs[NUM_GLYPHS][TILE_H];
+};
+
+#endif
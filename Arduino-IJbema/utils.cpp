@@ -1,29 +1,47 @@
 #include "utils.h"
 
+#include "buttoninput.h"
+#include "profiler.h"
+
 #include "Arduino.h"
+#include <avr/io.h>
 
 void InterruptibleDelay::interruptOnPin(int pin) {
   pinBits |= (1 << pin);
 }
 
 bool InterruptibleDelay::operator()(int millis) {
-  for (; millis > 0; millis--) {
-    for (uint8_t pin = 0; pin <= 13; pin++) {
-      if ((pinBits & (1 << pin)) && buttonReader(pin) == HIGH) {
-        interruptPin = pin;
+  unsigned long start = ::millis();
+  do {
+    PROFILE_POLL();
+    // A tap that is already over by now still counts.
+    ButtonEvent event;
+    while (buttonInput.poll(event)) {
+      if (event.pressed && (pinBits & (1 << event.pin))) {
+        interruptPin = event.pin;
         return true;
       }
     }
-    delay(1);
-  }
+    uint16_t heldPins = buttonInput.getPressedPins() & pinBits;
+    if (heldPins) {
+      interruptPin = __builtin_ctz(heldPins);
+      return true;
+    }
+  } while (::millis() - start < (unsigned long) millis);
   return false;
 }
 
-bool ButtonReader::operator()(int pin) {
-  bool high = digitalRead(pin) == HIGH;
-  if (invertedPinBits & (1 << pin)) {
-    return !high;
-  } else {
-    return high;
+uint16_t ButtonReader::snapshot() const {
+  // Pins 0 to 7 are port D, 8 to 13 the low bits of port B.
+  uint16_t high = PIND | (uint16_t(PINB & 0b00111111) << 8);
+  return high ^ invertedPinBits;
+}
+
+uint32_t readNoiseSeed(uint8_t pin) {
+  // FNV-1a over the low bits of each reading, where the noise is.
+  uint32_t seed = 0x811C9DC5;
+  for (uint8_t i = 0; i < 32; i++) {
+    seed = (seed ^ uint8_t(analogRead(pin) ^ micros())) * 0x01000193;
   }
+  return seed;
 }
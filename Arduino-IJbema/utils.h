@@ -3,10 +3,12 @@
 
 #include <stdint.h>
 
+class ButtonInput;
+
 /**
- * A wrapper around digitalRead that can invert particular pins upon request.
- * Needed because the power button pin is high when the button is not pressed,
- * and button press pulls it low.
+ * Reads the buttons on pins 0 to 13, and can invert particular pins upon
+ * request. Needed because the power button pin is high when the button is not
+ * pressed, and button press pulls it low.
  */
 class ButtonReader {
   public:
@@ -14,7 +16,13 @@ class ButtonReader {
 
     void invertPin(int pin) { invertedPinBits |= (1 << pin); }
 
-    bool operator()(int pin);
+    /**
+     * All pins at once, one bit per pin that is pressed, straight from the
+     * port registers rather than through digitalRead().
+     */
+    uint16_t snapshot() const;
+
+    bool operator()(int pin) const { return snapshot() & (1 << pin); }
 
   private:
     uint16_t invertedPinBits;
@@ -22,12 +30,12 @@ class ButtonReader {
 
 /**
  * A functor similar to the built-in delay(), but which can be interrupted by
- * a signal on particular pins.
+ * a press of particular buttons, or by one of them being held down.
  */
 class InterruptibleDelay {
   public:
-    InterruptibleDelay(ButtonReader &buttonReader) :
-      buttonReader(buttonReader), pinBits(0), interruptPin(-1)
+    InterruptibleDelay(ButtonInput &buttonInput) :
+      buttonInput(buttonInput), pinBits(0), interruptPin(-1)
     {}
 
     void interruptOnPin(int pin);
@@ -43,10 +51,17 @@ class InterruptibleDelay {
     void reset() { interruptPin = -1; }
 
   private:
-    ButtonReader &buttonReader;
+    ButtonInput &buttonInput;
 
     uint16_t pinBits;
     int interruptPin;
 };
 
+/**
+ * Mixes many readings of an unconnected analog pin, and the time they took,
+ * into a seed for Random. A single reading tends to come out much the same
+ * every time.
+ */
+uint32_t readNoiseSeed(uint8_t pin);
+
 #endif
@@ -0,0 +1,263 @@
+// A computer player for the game logic in ../Arduino-IJbema, for tuning the
+// difficulty and for running the engine through far more games than anyone
+// would play by hand.
+//
+// Usage: ai [-g games] [-t threads] [-d depth] [-s seed] [-r rows] [-c cols]
+//   -g games    Number of games to play (default 100).
+//   -t threads  Worker threads (default one per core).
+//   -d depth    1 only places the current piece; 2 also averages over the
+//               pieces the bag can deal next (expectimax). Default 2.
+//   -s seed     Bag seed of the first game; game i uses seed + i.
+//   -r, -c      Board size as passed to Tetris (default 15 x 10, as on the LCD).
+//
+// Pieces are placed with Tetris::shift(), turn() and drop(), so rotation, wall
+// kicks, the bag and scoring are exactly those of the engine.
+
+#include "search.h"
+#include "tetris.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+unsigned const CACHE_BITS = 18;
+
+uint8_t const ALL_TETROMINOS = (1 << NUM_TETROMINOS) - 1;
+
+struct Settings {
+  unsigned games;
+  unsigned threads;
+  unsigned depth;
+  uint32_t seed;
+  uint8_t rows;
+  uint8_t cols;
+};
+
+struct Stats {
+  unsigned long games;
+  unsigned long wins;
+  unsigned long pieces;
+  unsigned long lines;
+  unsigned long score;
+  unsigned long placements;
+  unsigned long cacheLookups;
+  unsigned long cacheHits;
+
+  void add(Stats const &other) {
+    games += other.games;
+    wins += other.wins;
+    pieces += other.pieces;
+    lines += other.lines;
+    score += other.score;
+    placements += other.placements;
+    cacheLookups += other.cacheLookups;
+    cacheHits += other.cacheHits;
+  }
+};
+
+uint64_t hashBoard(Tetris const &tetris) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (uint8_t row = 1; row < getNumBoardRows(tetris); row++) {
+    hash = (hash ^ tetris.getRow(row)) * 0x100000001b3ull;
+  }
+  return hash ^ (hash >> 29);
+}
+
+/**
+ * Remembers the value of placing a given tetromino on a given board, keyed on
+ * a hash of both. Direct mapped; a newer entry replaces an older one.
+ */
+class EvaluationCache {
+  public:
+    EvaluationCache() : entries(size_t(1) << CACHE_BITS) {}
+
+    bool find(uint64_t key, double &value) const {
+      Entry const &entry = entries[key & (entries.size() - 1)];
+      if (entry.key != key) {
+        return false;
+      }
+      value = entry.value;
+      return true;
+    }
+
+    void store(uint64_t key, double value) {
+      Entry &entry = entries[key & (entries.size() - 1)];
+      entry.key = key;
+      entry.value = value;
+    }
+
+  private:
+    struct Entry {
+      uint64_t key = 0;
+      double value = 0;
+    };
+
+    std::vector<Entry> entries;
+};
+
+class Player {
+  public:
+    Player(Settings const &settings, Stats &stats) : settings(settings), stats(stats) {}
+
+    void play(uint32_t seed);
+
+  private:
+    Settings const &settings;
+    Stats &stats;
+    EvaluationCache cache;
+
+    Placement choose(Tetris const &tetris, uint8_t nextTetrominos);
+    double getBestValue(Tetris const &board, Tetromino tetromino);
+};
+
+void Player::play(uint32_t seed) {
+  Tetris tetris(settings.rows, settings.cols, seed);
+  TetrisEvent events = tetris.update(TetrisButton::NONE);
+
+  // The bag deals every tetromino once per seven, so the ones dealt so far
+  // from the current bag tell which can come next.
+  unsigned long pieces = 0;
+  uint8_t dealt = 0;
+  while (!(events & (TetrisEvent::GAME_OVER | TetrisEvent::WON))) {
+    if (pieces % NUM_TETROMINOS == 0) {
+      dealt = 0;
+    }
+    dealt |= 1 << unsigned(tetris.getCurrentTetromino());
+    pieces++;
+    uint8_t next = pieces % NUM_TETROMINOS == 0 ? ALL_TETROMINOS : ALL_TETROMINOS & ~dealt;
+
+    apply(tetris, choose(tetris, next));
+    events = tetris.update(TetrisButton::NONE);
+  }
+
+  stats.games++;
+  stats.wins += (events & TetrisEvent::WON) ? 1 : 0;
+  stats.pieces += pieces;
+  stats.lines += tetris.getLines();
+  stats.score += tetris.getScore();
+}
+
+Placement Player::choose(Tetris const &tetris, uint8_t nextTetrominos) {
+  Placement best = {0, 0};
+  double bestValue = TOPPED_OUT * 2;
+  forEachPlacement(tetris, [&](Tetris const &placed, Placement placement) {
+    stats.placements++;
+    double value = LINES_WEIGHT * (placed.getLines() - tetris.getLines());
+    if (settings.depth < 2) {
+      value += evaluate(placed);
+    } else {
+      double total = 0;
+      unsigned count = 0;
+      for (unsigned t = 0; t < NUM_TETROMINOS; t++) {
+        if (nextTetrominos & (1 << t)) {
+          total += getBestValue(placed, Tetromino(t));
+          count++;
+        }
+      }
+      value += total / count;
+    }
+    if (value > bestValue) {
+      bestValue = value;
+      best = placement;
+    }
+  });
+  return best;
+}
+
+double Player::getBestValue(Tetris const &board, Tetromino tetromino) {
+  uint64_t key = hashBoard(board) + (uint64_t(tetromino) + 1) * 0x9e3779b97f4a7c15ull;
+  double best;
+  stats.cacheLookups++;
+  if (cache.find(key, best)) {
+    stats.cacheHits++;
+    return best;
+  }
+
+  best = TOPPED_OUT;
+  Tetris trial = board;
+  if (trial.spawnTetromino(tetromino)) {
+    forEachPlacement(trial, [&](Tetris const &placed, Placement) {
+      stats.placements++;
+      double value = LINES_WEIGHT * (placed.getLines() - board.getLines()) + evaluate(placed);
+      best = std::max(best, value);
+    });
+  }
+  cache.store(key, best);
+  return best;
+}
+
+void usage(char const *name) {
+  std::fprintf(stderr, "Usage: %s [-g games] [-t threads] [-d depth] [-s seed] [-r rows] [-c cols]\n", name);
+}
+
+}
+
+int main(int argc, char **argv) {
+  Settings settings = {100, std::max(1u, std::thread::hardware_concurrency()), 2, 1, 15, 10};
+  // Parsed at full width, so that a board too big for a uint8_t is turned
+  // down rather than cut short.
+  unsigned long rows = settings.rows;
+  unsigned long cols = settings.cols;
+  int opt;
+  while ((opt = getopt(argc, argv, "g:t:d:s:r:c:")) != -1) {
+    switch (opt) {
+      case 'g': settings.games = std::strtoul(optarg, nullptr, 10); break;
+      case 't': settings.threads = std::max(1ul, std::strtoul(optarg, nullptr, 10)); break;
+      case 'd': settings.depth = std::strtoul(optarg, nullptr, 10); break;
+      case 's': settings.seed = std::strtoul(optarg, nullptr, 10); break;
+      case 'r': rows = std::strtoul(optarg, nullptr, 10); break;
+      case 'c': cols = std::strtoul(optarg, nullptr, 10); break;
+      default:
+        usage(argv[0]);
+        return 2;
+    }
+  }
+  if (optind != argc || settings.games == 0 ||
+      rows < MIN_VISIBLE_ROWS || rows > MAX_ROWS - 4 || cols < MIN_COLS || cols > MAX_COLS - 4) {
+    usage(argv[0]);
+    return 2;
+  }
+  settings.rows = rows;
+  settings.cols = cols;
+
+  Stats total = {};
+  std::mutex totalMutex;
+  std::atomic<unsigned> nextGame(0);
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (unsigned i = 0; i < settings.threads; i++) {
+    workers.emplace_back([&]() {
+      Stats stats = {};
+      Player player(settings, stats);
+      for (unsigned game; (game = nextGame++) < settings.games;) {
+        player.play(settings.seed + game);
+      }
+      std::lock_guard<std::mutex> lock(totalMutex);
+      total.add(stats);
+    });
+  }
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::printf("%lu games on %u threads, depth %u, %.2f s\n", total.games, settings.threads, settings.depth, seconds);
+  std::printf("  won:                  %lu (%.1f%%)\n", total.wins, 100.0 * total.wins / total.games);
+  std::printf("  average pieces:       %.1f\n", double(total.pieces) / total.games);
+  std::printf("  average lines:        %.2f\n", double(total.lines) / total.games);
+  std::printf("  average score:        %.1f\n", double(total.score) / total.games);
+  std::printf("  placements evaluated: %lu (%.0f/s)\n", total.placements, total.placements / seconds);
+  if (total.cacheLookups) {
+    std::printf("  cache hits:           %.1f%%\n", 100.0 * total.cacheHits / total.cacheLookups);
+  }
+  return 0;
+}
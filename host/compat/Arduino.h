@@ -0,0 +1,55 @@
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+
+// Just enough of the Arduino core to build the game logic on the host.
+// Anything that touches pins or timing is deliberately missing.
+
+#include <avr/pgmspace.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+class __FlashStringHelper;
+#define F(string) (reinterpret_cast<__FlashStringHelper const *>(string))
+
+class Print {
+  public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t c) = 0;
+
+    size_t write(char const *str) {
+      size_t n = 0;
+      while (*str) {
+        n += write(uint8_t(*str++));
+      }
+      return n;
+    }
+
+    size_t print(char const *str) { return write(str); }
+    size_t print(__FlashStringHelper const *str) { return write(reinterpret_cast<char const *>(str)); }
+    size_t print(char c) { return write(uint8_t(c)); }
+    size_t print(unsigned long n);
+    size_t print(long n) { return n < 0 ? write('-') + print((unsigned long) -n) : print((unsigned long) n); }
+    size_t print(unsigned n) { return print((unsigned long) n); }
+    size_t print(int n) { return print((long) n); }
+};
+
+inline size_t Print::print(unsigned long n) {
+  char digits[20];
+  uint8_t count = 0;
+  do {
+    digits[count++] = '0' + n % 10;
+    n /= 10;
+  } while (n);
+  for (uint8_t i = count; i > 0; i--) {
+    write(uint8_t(digits[i - 1]));
+  }
+  return count;
+}
+
+#endif
@@ -0,0 +1,9 @@
+#ifndef HOST_WPROGRAM_H_
+#define HOST_WPROGRAM_H_
+
+// What Arduino.h was called before Arduino 1.0; LCDBitmap.h falls back on it
+// when ARDUINO isn't defined.
+
+#include <Arduino.h>
+
+#endif
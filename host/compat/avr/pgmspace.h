@@ -0,0 +1,20 @@
+#ifndef HOST_AVR_PGMSPACE_H_
+#define HOST_AVR_PGMSPACE_H_
+
+// On the host, flash and RAM share one address space.
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+
+#define pgm_read_byte_near(address) (*(uint8_t const *)(address))
+// A word is also a pointer on the AVR, so tables of pointers are read with
+// this too; it reads whatever type the address points at.
+#define pgm_read_word_near(address) (*(address))
+#define pgm_read_dword_near(address) (*(uint32_t const *)(address))
+#define pgm_read_byte(address) pgm_read_byte_near(address)
+#define pgm_read_word(address) pgm_read_word_near(address)
+#define pgm_read_dword(address) pgm_read_dword_near(address)
+
+#endif
@@ -0,0 +1,239 @@
+// Plays many games frame by frame through Tetris::update(), exactly as the
+// sketch drives it, on all cores at once, and reports how fast the engine runs
+// and how the games turned out.
+//
+// Usage: farm [-g games] [-t threads] [-p policy] [-s seed] [-f frames] [-r rows] [-c cols]
+//   -g games    Number of games to play (default 1000).
+//   -t threads  Worker threads (default one per core).
+//   -p policy   Who presses the buttons (default heuristic):
+//                 random     Random buttons, each held for a random while.
+//                 heuristic  Places every piece where search.h rates it best,
+//                            getting it there with button presses.
+//                 FILE       The buttons of an input log (see inputlog.h),
+//                            over and over.
+//   -s seed     Bag seed of the first game; game i uses seed + i.
+//   -f frames   Give up on a game after this many frames (default 1000000).
+//   -r, -c      Board size as passed to Tetris (default 15 x 10, as on the LCD).
+//               Boards too big for the sketch's Tetris are played on a
+//               MediumTetris, up to 28 x 28, or a WideTetris, up to 60 x 60.
+
+#include "inputlog.h"
+#include "policy.h"
+#include "pool.h"
+#include "prng.h"
+#include "search.h"
+#include "tetris.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+unsigned const MAX_LEVEL = 11;
+
+struct Settings {
+  unsigned games;
+  unsigned threads;
+  char const *policy;
+  uint32_t seed;
+  unsigned long maxFrames;
+  uint8_t rows;
+  uint8_t cols;
+  std::string script;
+};
+
+template<typename Game>
+std::unique_ptr<Policy<Game>> makePolicy(Settings const &settings, uint32_t seed) {
+  if (std::strcmp(settings.policy, "random") == 0) {
+    return std::unique_ptr<Policy<Game>>(new RandomPolicy<Game>(seed));
+  } else if (std::strcmp(settings.policy, "heuristic") == 0) {
+    return std::unique_ptr<Policy<Game>>(new HeuristicPolicy<Game>());
+  } else {
+    return std::unique_ptr<Policy<Game>>(new ScriptPolicy<Game>(settings.script));
+  }
+}
+
+/**
+ * Results of the games one worker played; merged once all are done.
+ */
+struct Stats {
+  unsigned long wins = 0;
+  unsigned long cutOff = 0;
+  unsigned long frames = 0;
+  // Lock events that cleared 1, 2, 3 and 4 rows.
+  unsigned long clears[4] = {};
+  unsigned long levels[MAX_LEVEL + 1] = {};
+  std::vector<unsigned long> gameScores;
+  std::vector<unsigned long> gameLines;
+  std::vector<unsigned long> gameFrames;
+
+  void add(Stats const &other) {
+    wins += other.wins;
+    cutOff += other.cutOff;
+    frames += other.frames;
+    for (unsigned i = 0; i < 4; i++) {
+      clears[i] += other.clears[i];
+    }
+    for (unsigned i = 0; i <= MAX_LEVEL; i++) {
+      levels[i] += other.levels[i];
+    }
+    gameScores.insert(gameScores.end(), other.gameScores.begin(), other.gameScores.end());
+    gameLines.insert(gameLines.end(), other.gameLines.begin(), other.gameLines.end());
+    gameFrames.insert(gameFrames.end(), other.gameFrames.begin(), other.gameFrames.end());
+  }
+};
+
+template<typename Game>
+void play(Settings const &settings, uint32_t seed, Stats &stats) {
+  Game tetris(settings.rows, settings.cols, seed);
+  std::unique_ptr<Policy<Game>> policy = makePolicy<Game>(settings, seed);
+
+  TetrisEvent events = TetrisEvent::NONE;
+  unsigned long frames = 0;
+  while (frames < settings.maxFrames) {
+    TetrisButton buttons = policy->next(tetris, events);
+    events = tetris.update(buttons);
+    frames++;
+    if (events & TetrisEvent::LOCKED) {
+      unsigned cleared = __builtin_popcountll(tetris.getClearingRows());
+      if (cleared) {
+        stats.clears[std::min(cleared, 4u) - 1]++;
+      }
+    }
+    if (events & (TetrisEvent::GAME_OVER | TetrisEvent::WON)) {
+      break;
+    }
+  }
+
+  stats.wins += (events & TetrisEvent::WON) ? 1 : 0;
+  stats.cutOff += (events & (TetrisEvent::GAME_OVER | TetrisEvent::WON)) ? 0 : 1;
+  stats.frames += frames;
+  stats.levels[std::min<unsigned>(tetris.getLevel(), MAX_LEVEL)]++;
+  stats.gameScores.push_back(tetris.getScore());
+  stats.gameLines.push_back(tetris.getLines());
+  stats.gameFrames.push_back(frames);
+}
+
+void printDistribution(char const *name, std::vector<unsigned long> values) {
+  std::sort(values.begin(), values.end());
+  double sum = 0;
+  for (unsigned long value : values) {
+    sum += value;
+  }
+  auto percentile = [&](unsigned p) { return values[(values.size() - 1) * p / 100]; };
+  std::printf("  %-8s mean %10.1f  min %8lu  p10 %8lu  p50 %8lu  p90 %8lu  max %8lu\n",
+    name, sum / values.size(), values.front(), percentile(10), percentile(50), percentile(90), values.back());
+}
+
+bool readFile(char const *path, std::string &text) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  text = contents.str();
+  return true;
+}
+
+void usage(char const *name) {
+  std::fprintf(stderr, "Usage: %s [-g games] [-t threads] [-p random|heuristic|log] [-s seed] [-f frames] [-r rows] [-c cols]\n", name);
+}
+
+}
+
+int main(int argc, char **argv) {
+  Settings settings = {1000, std::max(1u, std::thread::hardware_concurrency()), "heuristic", 1, 1000000, 15, 10, ""};
+  // Parsed at full width, so that a board too big for a uint8_t is turned
+  // down rather than cut short.
+  unsigned long rows = settings.rows;
+  unsigned long cols = settings.cols;
+  int opt;
+  while ((opt = getopt(argc, argv, "g:t:p:s:f:r:c:")) != -1) {
+    switch (opt) {
+      case 'g': settings.games = std::strtoul(optarg, nullptr, 10); break;
+      case 't': settings.threads = std::max(1ul, std::strtoul(optarg, nullptr, 10)); break;
+      case 'p': settings.policy = optarg; break;
+      case 's': settings.seed = std::strtoul(optarg, nullptr, 10); break;
+      case 'f': settings.maxFrames = std::max(1ul, std::strtoul(optarg, nullptr, 10)); break;
+      case 'r': rows = std::strtoul(optarg, nullptr, 10); break;
+      case 'c': cols = std::strtoul(optarg, nullptr, 10); break;
+      default:
+        usage(argv[0]);
+        return 2;
+    }
+  }
+  if (optind != argc || settings.games == 0 ||
+      rows < MIN_VISIBLE_ROWS || rows > WideTetris::MAX_ROWS - 4 ||
+      cols < MIN_COLS || cols > WideTetris::MAX_COLS - 4) {
+    usage(argv[0]);
+    return 2;
+  }
+  settings.rows = rows;
+  settings.cols = cols;
+  if (std::strcmp(settings.policy, "random") != 0 && std::strcmp(settings.policy, "heuristic") != 0) {
+    if (!readFile(settings.policy, settings.script)) {
+      std::fprintf(stderr, "%s: can't read %s\n", argv[0], settings.policy);
+      return 1;
+    }
+    if (!InputReplayer(settings.script.c_str()).isValid()) {
+      std::fprintf(stderr, "%s: no input log in %s\n", argv[0], settings.policy);
+      return 1;
+    }
+  }
+
+  bool medium = settings.cols + 4u > MAX_COLS || settings.rows + 4u > MAX_ROWS;
+  bool wide = settings.cols + 4u > MediumTetris::MAX_COLS || settings.rows + 4u > MediumTetris::MAX_ROWS;
+
+  std::vector<Stats> workerStats(settings.threads);
+  auto start = std::chrono::steady_clock::now();
+  {
+    WorkStealingPool pool(settings.threads);
+    for (unsigned game = 0; game < settings.games; game++) {
+      uint32_t seed = settings.seed + game;
+      pool.submit([&settings, &workerStats, medium, wide, seed](unsigned worker) {
+        if (wide) {
+          play<WideTetris>(settings, seed, workerStats[worker]);
+        } else if (medium) {
+          play<MediumTetris>(settings, seed, workerStats[worker]);
+        } else {
+          play<Tetris>(settings, seed, workerStats[worker]);
+        }
+      });
+    }
+    pool.wait();
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  Stats total;
+  for (Stats const &stats : workerStats) {
+    total.add(stats);
+  }
+
+  std::printf("%u games on %u threads, policy %s, %.2f s\n", settings.games, settings.threads, settings.policy, seconds);
+  std::printf("  %.0f games/s, %.0f frames/s\n", settings.games / seconds, total.frames / seconds);
+  std::printf("  won %lu, game over %lu, cut off at %lu frames %lu\n",
+    total.wins, settings.games - total.wins - total.cutOff, settings.maxFrames, total.cutOff);
+  printDistribution("score", total.gameScores);
+  printDistribution("lines", total.gameLines);
+  printDistribution("frames", total.gameFrames);
+  std::printf("  line clears: %lu single, %lu double, %lu triple, %lu tetris\n",
+    total.clears[0], total.clears[1], total.clears[2], total.clears[3]);
+  std::printf("  final level:");
+  for (unsigned level = 1; level <= MAX_LEVEL; level++) {
+    if (total.levels[level]) {
+      std::printf(" %u:%lu", level, total.levels[level]);
+    }
+  }
+  std::printf("\n");
+  return 0;
+}
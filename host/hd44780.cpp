@@ -0,0 +1,251 @@
+#include "hd44780.h"
+
+#include <map>
+
+BusTiming const FAST_LCD_TIMING = {"FastLCD", 4.0, 1.5, true, 0};
+BusTiming const LIQUID_CRYSTAL_TIMING = {"LiquidCrystal", 0, 4 * 4.0 + 3 * 4.0 + 2 + 100, false, 2000};
+
+namespace {
+
+// Execution times from the datasheet, at the typical 270 kHz oscillator.
+double const EXECUTION_MICROS = 37;
+double const WRITE_EXECUTION_MICROS = 37 + 4;
+double const CLEAR_MICROS = 1520;
+
+uint8_t const LINE_LENGTH = 40;
+uint8_t const SECOND_LINE = 0x40;
+
+std::map<FastLCD const *, HD44780 *> attached;
+
+void putGlyph(FILE *file, uint8_t code) {
+  if (code < 0x10) {
+    // Circled digits zero to seven.
+    static char const *const CIRCLED[8] = {"⓪", "①", "②", "③", "④", "⑤", "⑥", "⑦"};
+    fputs(CIRCLED[code & 0x07], file);
+  } else if (code == 0xFF) {
+    fputs("█", file);
+  } else if (code >= 0x20 && code < 0x7F) {
+    fputc(code, file);
+  } else {
+    fputc('?', file);
+  }
+}
+
+}
+
+LCDTraffic LCDTraffic::operator-(LCDTraffic const &other) const {
+  LCDTraffic difference;
+  difference.nibbles = nibbles - other.nibbles;
+  difference.commands = commands - other.commands;
+  difference.ddramWrites = ddramWrites - other.ddramWrites;
+  difference.cgramWrites = cgramWrites - other.cgramWrites;
+  difference.busMicros = busMicros - other.busMicros;
+  return difference;
+}
+
+HD44780::HD44780(BusTiming const &timing)
+  :
+    timing(timing),
+    addressCounter(0),
+    addressingCGRAM(false),
+    increment(true),
+    shiftOnWrite(false),
+    displayOn(false),
+    fourBit(false),
+    twoLines(false),
+    displayShift(0),
+    haveHighNibble(false),
+    highNibble(0),
+    now(0),
+    readyTime(0)
+{
+  for (uint8_t &c : ddram) {
+    c = ' ';
+  }
+  for (uint8_t &row : cgram) {
+    row = 0;
+  }
+}
+
+void HD44780::attach(FastLCD const &lcd) {
+  attached[&lcd] = this;
+}
+
+HD44780 &HD44780::getAttached(FastLCD const &lcd) {
+  return *attached.at(&lcd);
+}
+
+void HD44780::writeNibble(bool data, uint8_t nibble) {
+  // The first nibble of a byte, or of an instruction in 8-bit mode, is where
+  // a sender waits and pays its fixed cost.
+  if (!haveHighNibble) {
+    if (timing.waitsForExecution && readyTime > now) {
+      traffic.busMicros += readyTime - now;
+      now = readyTime;
+    }
+    traffic.busMicros += timing.sendMicros;
+    now += timing.sendMicros;
+  }
+  traffic.busMicros += timing.nibbleMicros;
+  now += timing.nibbleMicros;
+  traffic.nibbles++;
+
+  nibble &= 0x0F;
+  if (!fourBit) {
+    // Only the upper four data lines are wired; the lower ones read as 0.
+    execute(data, nibble << 4);
+  } else if (!haveHighNibble) {
+    highNibble = nibble;
+    haveHighNibble = true;
+  } else {
+    haveHighNibble = false;
+    execute(data, highNibble << 4 | nibble);
+  }
+}
+
+void HD44780::advance(double micros) {
+  now += micros;
+}
+
+void HD44780::execute(bool data, uint8_t value) {
+  if (data) {
+    writeData(value);
+  } else {
+    instruction(value);
+  }
+}
+
+void HD44780::instruction(uint8_t value) {
+  traffic.commands++;
+  double execution = EXECUTION_MICROS;
+  if (value & 0x80) {
+    addressCounter = value & 0x7F;
+    addressingCGRAM = false;
+  } else if (value & 0x40) {
+    addressCounter = value & 0x3F;
+    addressingCGRAM = true;
+  } else if (value & 0x20) {
+    fourBit = !(value & 0x10);
+    twoLines = value & 0x08;
+  } else if (value & 0x10) {
+    bool right = value & 0x04;
+    if (value & 0x08) {
+      shiftDisplay(!right);
+    } else {
+      moveAddressCounter(right);
+    }
+  } else if (value & 0x08) {
+    displayOn = value & 0x04;
+  } else if (value & 0x04) {
+    increment = value & 0x02;
+    shiftOnWrite = value & 0x01;
+  } else if (value & 0x02) {
+    addressCounter = 0;
+    addressingCGRAM = false;
+    displayShift = 0;
+    execution = CLEAR_MICROS;
+  } else if (value & 0x01) {
+    for (uint8_t &c : ddram) {
+      c = ' ';
+    }
+    addressCounter = 0;
+    addressingCGRAM = false;
+    increment = true;
+    displayShift = 0;
+    execution = CLEAR_MICROS;
+  }
+  readyTime = now + execution;
+  if (execution == CLEAR_MICROS) {
+    traffic.busMicros += timing.clearSleepMicros;
+    now += timing.clearSleepMicros;
+  }
+}
+
+void HD44780::writeData(uint8_t value) {
+  if (addressingCGRAM) {
+    traffic.cgramWrites++;
+    cgram[addressCounter & 0x3F] = value & 0x1F;
+  } else {
+    traffic.ddramWrites++;
+    ddram[addressCounter] = value;
+    if (shiftOnWrite) {
+      shiftDisplay(increment);
+    }
+  }
+  moveAddressCounter(increment);
+  readyTime = now + WRITE_EXECUTION_MICROS;
+}
+
+void HD44780::moveAddressCounter(bool forward) {
+  if (addressingCGRAM) {
+    addressCounter = (addressCounter + (forward ? 1 : -1)) & 0x3F;
+    return;
+  }
+  // In two-line mode the lines are 0x00 to 0x27 and 0x40 to 0x67, and the
+  // counter runs from the end of one to the start of the other.
+  uint8_t line = twoLines && addressCounter >= SECOND_LINE ? SECOND_LINE : 0;
+  uint8_t lineLength = twoLines ? LINE_LENGTH : 2 * LINE_LENGTH;
+  uint8_t offset = addressCounter - line;
+  if (forward) {
+    if (++offset == lineLength) {
+      offset = 0;
+      line = twoLines ? SECOND_LINE - line : 0;
+    }
+  } else {
+    if (offset-- == 0) {
+      offset = lineLength - 1;
+      line = twoLines ? SECOND_LINE - line : 0;
+    }
+  }
+  addressCounter = line + offset;
+}
+
+void HD44780::shiftDisplay(bool left) {
+  displayShift = (displayShift + (left ? 1 : LINE_LENGTH - 1)) % LINE_LENGTH;
+}
+
+uint8_t HD44780::getShownChar(uint8_t row, uint8_t col) const {
+  if (!displayOn) {
+    return ' ';
+  }
+  return ddram[row * SECOND_LINE + (col + displayShift) % LINE_LENGTH];
+}
+
+void HD44780::dump(FILE *file, bool pixels) const {
+  fprintf(file, "+----------------+\n");
+  for (uint8_t row = 0; row < NUM_ROWS; row++) {
+    fputc('|', file);
+    for (uint8_t col = 0; col < NUM_COLS; col++) {
+      putGlyph(file, getShownChar(row, col));
+    }
+    fputs("|\n", file);
+  }
+  fprintf(file, "+----------------+\n");
+  if (!pixels) {
+    return;
+  }
+  for (uint8_t row = 0; row < NUM_ROWS; row++) {
+    for (uint8_t y = 0; y < 8; y++) {
+      for (uint8_t col = 0; col < NUM_COLS; col++) {
+        uint8_t code = getShownChar(row, col);
+        for (uint8_t x = 0; x < 5; x++) {
+          bool on;
+          if (code < 0x10) {
+            on = getGlyph(code)[y] & (0x10 >> x);
+          } else if (code == 0xFF) {
+            on = true;
+          } else if (code != ' ' && y == 3 && x == 2) {
+            putGlyph(file, code);
+            continue;
+          } else {
+            on = false;
+          }
+          fputc(on ? '#' : '.', file);
+        }
+        fputc(' ', file);
+      }
+      fputc('\n', file);
+    }
+    fputc('\n', file);
+  }
+}
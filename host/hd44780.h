@@ -0,0 +1,124 @@
+#ifndef HD44780_H_
+#define HD44780_H_
+
+// A model of the HD44780 LCD controller as the sketch uses it: 4-bit bus,
+// writes only. It keeps DDRAM, CGRAM, the address counter, entry mode and
+// display shift, and counts the traffic on the bus and the time it takes.
+//
+// On the host, FastLCD (see ../Arduino-IJbema/fastlcd.h) is built with the
+// pin transport of hostlcd.cpp, which sends to the HD44780 attached to it,
+// so the sketch's FastLCD instructions, TextLayer, LCDBitmap, TetrisRenderer
+// and Quoter run against it unchanged.
+
+#include <stdint.h>
+#include <stdio.h>
+
+class FastLCD;
+
+/**
+ * What the sketch's side of the bus costs. Times are in microseconds.
+ */
+struct BusTiming {
+  char const *name;
+  // Per instruction or data byte sent, on top of its two nibbles.
+  double sendMicros;
+  double nibbleMicros;
+  // Whether the sender waits out each instruction's execution time before
+  // the next; LiquidCrystal doesn't, it sleeps after every nibble instead.
+  bool waitsForExecution;
+  // Extra sleep after clear and home.
+  double clearSleepMicros;
+};
+
+// FastLCD at 16 MHz: a micros() read and two masked port writes with an
+// enable pulse, estimated from its instruction count.
+extern BusTiming const FAST_LCD_TIMING;
+// The stock LiquidCrystal: digitalWrite() for every pin and a 100 us sleep
+// after every nibble.
+extern BusTiming const LIQUID_CRYSTAL_TIMING;
+
+/**
+ * Bus traffic, summed over some stretch of time.
+ */
+struct LCDTraffic {
+  unsigned long nibbles = 0;
+  unsigned long commands = 0;
+  unsigned long ddramWrites = 0;
+  unsigned long cgramWrites = 0;
+  // Time the sender spent sending, waits included.
+  double busMicros = 0;
+
+  unsigned long getBytes() const { return commands + ddramWrites + cgramWrites; }
+  LCDTraffic operator-(LCDTraffic const &other) const;
+};
+
+class HD44780 {
+  public:
+    static uint8_t const NUM_COLS = 16;
+    static uint8_t const NUM_ROWS = 2;
+
+    explicit HD44780(BusTiming const &timing = FAST_LCD_TIMING);
+
+    /**
+     * Makes FastLCD on the host send to this display.
+     */
+    void attach(FastLCD const &lcd);
+    static HD44780 &getAttached(FastLCD const &lcd);
+
+    /**
+     * A nibble clocked in on the falling edge of enable, RS as given.
+     */
+    void writeNibble(bool data, uint8_t nibble);
+
+    /**
+     * Lets time pass without traffic, like the rest of a frame.
+     */
+    void advance(double micros);
+
+    LCDTraffic const &getTraffic() const { return traffic; }
+    double getTime() const { return now; }
+
+    /**
+     * The character code shown at the given position, display shift
+     * included.
+     */
+    uint8_t getShownChar(uint8_t row, uint8_t col) const;
+    uint8_t const *getGlyph(uint8_t code) const { return cgram + 8 * (code & 0x07); }
+
+    /**
+     * Writes what the display shows, in UTF-8: the text, with the custom
+     * characters as circled digits and the full block as a block, and if
+     * asked for, the whole screen in pixels with text only hinted at.
+     */
+    void dump(FILE *file, bool pixels) const;
+
+  private:
+    BusTiming const &timing;
+
+    uint8_t ddram[128];
+    uint8_t cgram[64];
+    uint8_t addressCounter;
+    bool addressingCGRAM;
+    bool increment;
+    bool shiftOnWrite;
+    bool displayOn;
+    bool fourBit;
+    bool twoLines;
+    // Characters the display is shifted to the left, 0 to 39.
+    uint8_t displayShift;
+    // In 4-bit mode, the high nibble of a byte waiting for its low one.
+    bool haveHighNibble;
+    uint8_t highNibble;
+
+    double now;
+    double readyTime;
+    LCDTraffic traffic;
+
+    void execute(bool data, uint8_t value);
+    void instruction(uint8_t value);
+    void writeData(uint8_t value);
+    void moveAddressCounter(bool forward);
+    void shiftDisplay(bool left);
+};
+
+#endif
@@ -0,0 +1,41 @@
+// The host build of FastLCD's pin transport, in place of
+// ../Arduino-IJbema/fastlcdpins.cpp: rather than driving pins, it clocks its
+// nibbles into the HD44780 attached to it (see hd44780.h). The instructions
+// are those of ../Arduino-IJbema/fastlcd.cpp itself.
+
+#include "fastlcd.h"
+#include "hd44780.h"
+
+namespace {
+
+// The power-on reset, as on the AVR.
+double const POWER_ON_MICROS = 50000;
+
+}
+
+void FastLCD::beginPins() {
+  HD44780::getAttached(*this).advance(POWER_ON_MICROS);
+}
+
+void FastLCD::waitMicros(uint16_t duration) {
+  HD44780::getAttached(*this).advance(duration);
+}
+
+void FastLCD::writeNibble(uint8_t nibble) {
+  // Only begin() sends single nibbles, with RS low.
+  HD44780::getAttached(*this).writeNibble(false, nibble);
+}
+
+void FastLCD::writeByte(uint8_t value, bool data) {
+  HD44780 &display = HD44780::getAttached(*this);
+  display.writeNibble(data, value >> 4);
+  display.writeNibble(data, value & 0x0F);
+}
+
+// The model keeps the time, execution included.
+
+void FastLCD::setBusyFor(uint16_t) {
+}
+
+void FastLCD::waitUntilReady() {
+}
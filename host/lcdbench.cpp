@@ -0,0 +1,299 @@
+// Runs the sketch's display code against a model of the LCD and reports how
+// much bus traffic it makes and how long the sketch spends sending it: first
+// a game rendered frame by frame with TetrisRenderer, as TetrisGame does, then
+// quotes scrolled by the Quoter.
+//
+// Usage: lcdbench [-t fast|stock] [-b random|heuristic] [-s seed] [-f frames] [-q quotes] [-d] [-p] [log]
+//   -t timing  The sender's timing (default fast):
+//                fast   FastLCD.
+//                stock  The stock LiquidCrystal library, for comparison.
+//   -b buttons Who presses the buttons (default heuristic), as in farm:
+//                random     Random buttons; lines hardly ever clear.
+//                heuristic  The placement search, clearing lines.
+//   -s seed    Bag seed, and seed of the random buttons (default 1).
+//   -f frames  Stop the game after this many frames (default 20000).
+//   -q quotes  Quotes to show after the game (default 3).
+//   -d         Dump the screen after every frame that sent anything.
+//   -p         Dump in pixels too.
+//   log        Play the buttons of this input log (see inputlog.h) instead of
+//              random ones.
+
+#include "buttoninput.h"
+#include "fastlcd.h"
+#include "hd44780.h"
+#include "inputlog.h"
+#include "policy.h"
+#include "quoter.h"
+#include "tetris.h"
+#include "tetrisrenderer.h"
+#include "textlayer.h"
+#include "utils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+double const FRAME_MICROS = 1e6 / 60;
+// As in TetrisGame.
+uint8_t const LINE_FLASHES = 5;
+uint8_t const LINE_FLASH_FRAMES = LINE_CLEAR_FRAMES / LINE_FLASHES;
+
+/**
+ * Traffic of each step, like a frame or a scroll step of a quote, and what
+ * they come to.
+ */
+class StepStats {
+  public:
+    explicit StepStats(HD44780 const &display) : display(display), last(display.getTraffic()) {}
+
+    /**
+     * Ends a step; returns whether anything was sent during it.
+     */
+    bool endStep() {
+      LCDTraffic step = display.getTraffic() - last;
+      last = display.getTraffic();
+      steps++;
+      if (step.nibbles == 0) {
+        return false;
+      }
+      busMicros.push_back(step.busMicros);
+      bytes.push_back(step.getBytes());
+      return true;
+    }
+
+    unsigned long getSteps() const { return steps; }
+
+    void print(char const *name) const {
+      std::printf("%s: %lu steps, %zu with traffic\n", name, steps, bytes.size());
+      if (bytes.empty()) {
+        return;
+      }
+      printDistribution("bus us", busMicros);
+      std::vector<double> byteCounts(bytes.begin(), bytes.end());
+      printDistribution("bytes", byteCounts);
+    }
+
+  private:
+    HD44780 const &display;
+    LCDTraffic last;
+    unsigned long steps = 0;
+    std::vector<double> busMicros;
+    std::vector<unsigned long> bytes;
+
+    static void printDistribution(char const *name, std::vector<double> values) {
+      std::sort(values.begin(), values.end());
+      double sum = 0;
+      for (double value : values) {
+        sum += value;
+      }
+      auto percentile = [&](unsigned p) { return values[(values.size() - 1) * p / 100]; };
+      std::printf("  %-7s mean %8.1f  p50 %8.1f  p90 %8.1f  p99 %8.1f  max %8.1f\n",
+        name, sum / values.size(), percentile(50), percentile(90), percentile(99), values.back());
+    }
+};
+
+// Where the host's InterruptibleDelay ends a quote's steps.
+HD44780 *quoteDisplay = nullptr;
+StepStats *quoteStats = nullptr;
+bool dumpSteps = false;
+bool dumpPixels = false;
+
+void dumpStep(HD44780 const &display, char const *what, unsigned long step) {
+  std::printf("%s %lu:\n", what, step);
+  display.dump(stdout, dumpPixels);
+}
+
+void printTotals(LCDTraffic const &traffic) {
+  std::printf("total: %lu nibbles, %lu instructions, %lu DDRAM and %lu CGRAM writes, %.1f ms on the bus\n",
+    traffic.nibbles, traffic.commands, traffic.ddramWrites, traffic.cgramWrites, traffic.busMicros / 1000);
+}
+
+bool readFile(char const *path, std::string &text) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  text = contents.str();
+  return true;
+}
+
+void usage(char const *name) {
+  std::fprintf(stderr, "Usage: %s [-t fast|stock] [-b random|heuristic] [-s seed] [-f frames] [-q quotes] [-d] [-p] [log]\n", name);
+}
+
+}
+
+// The buttons are never read on the host, so these stand-ins only let the
+// Quoter be built. Its waits end a step.
+ButtonInput::ButtonInput(ButtonReader &buttonReader)
+  :
+    buttonReader(buttonReader),
+    watchedPins(0),
+    pressedPins(0),
+    changeTimes{0},
+    head(0),
+    tail(0)
+{
+}
+
+bool InterruptibleDelay::operator()(int millis) {
+  if (quoteStats->endStep() && dumpSteps) {
+    dumpStep(*quoteDisplay, "quote step", quoteStats->getSteps());
+  }
+  quoteDisplay->advance(millis * 1000.0);
+  return false;
+}
+
+int main(int argc, char **argv) {
+  BusTiming const *timing = &FAST_LCD_TIMING;
+  bool randomButtons = false;
+  uint32_t seed = 1;
+  unsigned long maxFrames = 20000;
+  unsigned quotes = 3;
+  int opt;
+  while ((opt = getopt(argc, argv, "t:b:s:f:q:dp")) != -1) {
+    switch (opt) {
+      case 't':
+        if (std::strcmp(optarg, "fast") == 0) {
+          timing = &FAST_LCD_TIMING;
+        } else if (std::strcmp(optarg, "stock") == 0) {
+          timing = &LIQUID_CRYSTAL_TIMING;
+        } else {
+          usage(argv[0]);
+          return 2;
+        }
+        break;
+      case 'b':
+        if (std::strcmp(optarg, "random") == 0) {
+          randomButtons = true;
+        } else if (std::strcmp(optarg, "heuristic") == 0) {
+          randomButtons = false;
+        } else {
+          usage(argv[0]);
+          return 2;
+        }
+        break;
+      case 's': seed = std::strtoul(optarg, nullptr, 10); break;
+      case 'f': maxFrames = std::strtoul(optarg, nullptr, 10); break;
+      case 'q': quotes = std::strtoul(optarg, nullptr, 10); break;
+      case 'd': dumpSteps = true; break;
+      case 'p': dumpPixels = true; break;
+      default:
+        usage(argv[0]);
+        return 2;
+    }
+  }
+  if (optind + 1 < argc) {
+    usage(argv[0]);
+    return 2;
+  }
+  std::string log;
+  if (optind < argc) {
+    if (!readFile(argv[optind], log)) {
+      std::fprintf(stderr, "%s: can't read %s\n", argv[0], argv[optind]);
+      return 1;
+    }
+    if (!InputReplayer(log.c_str()).isValid()) {
+      std::fprintf(stderr, "%s: no usable input log in %s\n", argv[0], argv[optind]);
+      return 1;
+    }
+  }
+
+  HD44780 display(*timing);
+  FastLCD lcd(12, 11, 5, 4, 3, 2);
+  display.attach(lcd);
+  lcd.begin(HD44780::NUM_COLS, HD44780::NUM_ROWS);
+  TextLayer text(lcd);
+  std::printf("%s timing\n", timing->name);
+
+  // The game, as TetrisGame::play() draws it.
+  {
+    bool replaying = !log.empty();
+    InputReplayer replayer(log.c_str());
+    Tetris tetris(replaying ? replayer.getNumVisibleRows() : 15, replaying ? replayer.getNumCols() : 10,
+      replaying ? replayer.getSeed() : seed);
+    TetrisRenderer renderer(lcd, text);
+    std::unique_ptr<Policy<Tetris>> policy;
+    if (randomButtons) {
+      policy.reset(new RandomPolicy<Tetris>(seed));
+    } else {
+      policy.reset(new HeuristicPolicy<Tetris>());
+    }
+    TetrisEvent events = TetrisEvent::NONE;
+    uint8_t flashPhase = 0;
+
+    StepStats frameStats(display);
+    renderer.begin();
+    frameStats.endStep();
+    unsigned long frame;
+    for (frame = 0; frame < maxFrames; frame++) {
+      display.advance(FRAME_MICROS);
+      TetrisButton buttons;
+      if (replaying) {
+        if (replayer.atEnd()) {
+          break;
+        }
+        buttons = replayer.next();
+      } else {
+        buttons = policy->next(tetris, events);
+      }
+
+      events = tetris.update(buttons);
+      if (events & (TetrisEvent::GAME_OVER | TetrisEvent::WON)) {
+        break;
+      }
+      if (events & TetrisEvent::LOCKED) {
+        flashPhase = LINE_FLASHES;
+      }
+      if (tetris.getClearingRows()) {
+        uint8_t phase = (tetris.getClearingFramesLeft() - 1) / LINE_FLASH_FRAMES;
+        if (phase != flashPhase) {
+          flashPhase = phase;
+          if (phase % 2 == 0) {
+            renderer.render(tetris, 0, tetris.getClearingRows());
+          } else {
+            renderer.render(tetris, tetris.getClearingRows(), 0);
+          }
+        }
+      } else if (events & TetrisEvent::CHANGED) {
+        renderer.render(tetris);
+      }
+      if (frameStats.endStep() && dumpSteps) {
+        dumpStep(display, "frame", frame);
+      }
+    }
+    std::printf("game of %lu frames, %u lines\n", frame, tetris.getLines());
+    frameStats.print("frames");
+    display.dump(stdout, dumpPixels);
+  }
+
+  // Quotes, as loop() shows them between games.
+  {
+    StepStats stepStats(display);
+    quoteDisplay = &display;
+    quoteStats = &stepStats;
+    ButtonReader buttonReader;
+    ButtonInput buttonInput(buttonReader);
+    InterruptibleDelay interruptibleDelay(buttonInput);
+    Quoter quoter(lcd, text, interruptibleDelay);
+    quoter.seed(seed);
+    for (unsigned i = 0; i < quotes; i++) {
+      quoter.showRandomQuote();
+    }
+    stepStats.print("quote steps");
+  }
+
+  printTotals(display.getTraffic());
+  return 0;
+}
@@ -0,0 +1,130 @@
+#ifndef HOST_POLICY_H_
+#define HOST_POLICY_H_
+
+// Who presses the buttons in the host-side tools that play frame by frame.
+
+#include "inputlog.h"
+#include "prng.h"
+#include "search.h"
+#include "tetris.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+
+/**
+ * Chooses the buttons held during each frame of one game.
+ */
+template<typename Game>
+class Policy {
+  public:
+    virtual ~Policy() {}
+
+    /**
+     * Called before every frame with what the previous frame's update()
+     * returned (NONE before the first).
+     */
+    virtual TetrisButton next(Game const &tetris, TetrisEvent events) = 0;
+};
+
+template<typename Game>
+class RandomPolicy : public Policy<Game> {
+  public:
+    explicit RandomPolicy(uint32_t seed) : random(seed), buttons(TetrisButton::NONE), holdFrames(0) {}
+
+    TetrisButton next(Game const &, TetrisEvent) override {
+      if (holdFrames == 0) {
+        // Hard drops would end every piece within a few frames, so they are
+        // rarer than the rest.
+        buttons = TetrisButton(random.next() & 0b11111);
+        if (random.below(16) == 0) {
+          buttons = buttons | TetrisButton::HARD_DROP;
+        }
+        holdFrames = 1 + random.below(30);
+      }
+      holdFrames--;
+      return buttons;
+    }
+
+  private:
+    Random random;
+    TetrisButton buttons;
+    unsigned holdFrames;
+};
+
+template<typename Game>
+class ScriptPolicy : public Policy<Game> {
+  public:
+    explicit ScriptPolicy(std::string const &script) : script(script), replayer(script.c_str()) {}
+
+    TetrisButton next(Game const &, TetrisEvent) override {
+      if (replayer.atEnd()) {
+        replayer = InputReplayer(script.c_str());
+      }
+      return replayer.next();
+    }
+
+  private:
+    std::string const &script;
+    InputReplayer replayer;
+};
+
+/**
+ * Picks a placement for each piece as it spawns and then plays the presses
+ * that get it there: one soft drop to leave the spawn row, the turns and the
+ * shifts, each followed by a frame with nothing held so the next press counts,
+ * and a hard drop.
+ */
+template<typename Game>
+class HeuristicPolicy : public Policy<Game> {
+  public:
+    HeuristicPolicy() : planned(false), step(0) {}
+
+    TetrisButton next(Game const &tetris, TetrisEvent events) override {
+      if (events & TetrisEvent::LOCKED) {
+        planned = false;
+      }
+      if (!tetris.isFalling()) {
+        return TetrisButton::NONE;
+      }
+      if (!planned) {
+        plan(tetris);
+        planned = true;
+      }
+      return step < presses.size() ? presses[step++] : TetrisButton::HARD_DROP;
+    }
+
+  private:
+    bool planned;
+    size_t step;
+    std::vector<TetrisButton> presses;
+
+    void plan(Game const &tetris) {
+      Placement best = {0, 0};
+      double bestValue = TOPPED_OUT * 2;
+      forEachPlacement(tetris, [&](Game const &placed, Placement placement) {
+        double value = LINES_WEIGHT * (placed.getLines() - tetris.getLines()) + evaluate(placed);
+        if (value > bestValue) {
+          bestValue = value;
+          best = placement;
+        }
+      });
+
+      presses.clear();
+      step = 0;
+      press(TetrisButton::SOFT_DROP, 1);
+      press(best.turns > 0 ? TetrisButton::ROTATE_RIGHT : TetrisButton::ROTATE_LEFT, std::abs(best.turns));
+      press(best.shifts > 0 ? TetrisButton::MOVE_RIGHT : TetrisButton::MOVE_LEFT, std::abs(best.shifts));
+      presses.push_back(TetrisButton::HARD_DROP);
+    }
+
+    void press(TetrisButton button, unsigned times) {
+      for (unsigned i = 0; i < times; i++) {
+        presses.push_back(button);
+        presses.push_back(TetrisButton::NONE);
+      }
+    }
+};
+
+#endif
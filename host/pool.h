@@ -0,0 +1,151 @@
+#ifndef HOST_POOL_H_
+#define HOST_POOL_H_
+
+// A fixed set of worker threads, each with its own queue of tasks. A worker
+// takes its newest task first and, once its own queue is empty, steals the
+// oldest task of another worker, so uneven tasks (short and long games) still
+// keep every thread busy without a single shared queue to fight over.
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+  public:
+    /**
+     * Tasks are passed the index of the worker running them, so they can keep
+     * per-worker results without locking.
+     */
+    typedef std::function<void(unsigned worker)> Task;
+
+    explicit WorkStealingPool(unsigned numWorkers) :
+      queued(0),
+      nextQueue(0),
+      pending(0),
+      stopping(false)
+    {
+      for (unsigned i = 0; i < numWorkers; i++) {
+        queues.emplace_back(new Queue);
+      }
+      for (unsigned i = 0; i < numWorkers; i++) {
+        threads.emplace_back([this, i]() { run(i); });
+      }
+    }
+
+    ~WorkStealingPool() {
+      wait();
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+      }
+      workAvailable.notify_all();
+      for (std::thread &thread : threads) {
+        thread.join();
+      }
+    }
+
+    WorkStealingPool(WorkStealingPool const &) = delete;
+    WorkStealingPool &operator=(WorkStealingPool const &) = delete;
+
+    unsigned getNumWorkers() const { return queues.size(); }
+
+    /**
+     * Deals tasks to the workers' queues in turn.
+     */
+    void submit(Task task) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        pending++;
+      }
+      Queue &queue = *queues[nextQueue++ % queues.size()];
+      {
+        // Counted before it can be taken, so take() never brings queued
+        // below zero.
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queued++;
+        queue.tasks.push_back(std::move(task));
+      }
+      {
+        // Taken so a worker can't miss the notification between checking
+        // queued and going to sleep.
+        std::lock_guard<std::mutex> lock(mutex);
+      }
+      workAvailable.notify_one();
+    }
+
+    /**
+     * Returns once every submitted task has finished.
+     */
+    void wait() {
+      std::unique_lock<std::mutex> lock(mutex);
+      allDone.wait(lock, [this]() { return pending == 0; });
+    }
+
+  private:
+    struct Queue {
+      std::mutex mutex;
+      std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> threads;
+    std::atomic<unsigned> queued;
+    std::atomic<unsigned> nextQueue;
+
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable allDone;
+    unsigned pending;
+    bool stopping;
+
+    bool take(unsigned worker, Task &task) {
+      {
+        Queue &own = *queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+          task = std::move(own.tasks.back());
+          own.tasks.pop_back();
+          queued--;
+          return true;
+        }
+      }
+      for (unsigned i = 1; i < queues.size(); i++) {
+        Queue &victim = *queues[(worker + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+          task = std::move(victim.tasks.front());
+          victim.tasks.pop_front();
+          queued--;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void run(unsigned worker) {
+      Task task;
+      while (true) {
+        if (take(worker, task)) {
+          task(worker);
+          task = nullptr;
+          std::lock_guard<std::mutex> lock(mutex);
+          if (--pending == 0) {
+            allDone.notify_all();
+          }
+          continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        workAvailable.wait(lock, [this]() { return stopping || queued > 0; });
+        if (stopping && queued == 0) {
+          return;
+        }
+      }
+    }
+};
+
+#endif
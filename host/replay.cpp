@@ -0,0 +1,124 @@
+// Replays input logs recorded with RECORD_INPUT (see inputlog.h) against the
+// game logic, without a display and as fast as the host allows.
+//
+// Usage: replay [-n repeats] [-q] log...
+//   -n repeats  Play every log this many times, for a stable benchmark.
+//   -q          Don't print the final board.
+//
+// A log can be a complete serial monitor capture; the text around it is ignored.
+
+#include "inputlog.h"
+#include "tetris.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+
+namespace {
+
+// Plays the log from start to end, or until the game is over.
+Tetris replay(char const *log, unsigned long &frames, TetrisEvent &end) {
+  InputReplayer replayer(log);
+  Tetris tetris(replayer.getNumVisibleRows(), replayer.getNumCols(), replayer.getSeed());
+
+  frames = 0;
+  end = TetrisEvent::NONE;
+  while (!replayer.atEnd()) {
+    TetrisEvent events = tetris.update(replayer.next());
+    frames++;
+    if (events & (TetrisEvent::GAME_OVER | TetrisEvent::WON)) {
+      end = events;
+      break;
+    }
+  }
+  return tetris;
+}
+
+void printBoard(Tetris const &tetris) {
+  for (uint8_t row = tetris.getNumRows(); row > 0; row--) {
+    std::string line;
+    for (uint8_t col = 0; col < tetris.getNumCols(); col++) {
+      line += tetris.getPixel(row - 1, col) ? '#' : '.';
+    }
+    std::printf("  %s\n", line.c_str());
+  }
+}
+
+char const *describeEnd(TetrisEvent end) {
+  if (end & TetrisEvent::GAME_OVER) {
+    return "game over";
+  } else if (end & TetrisEvent::WON) {
+    return "won";
+  } else {
+    return "log ended";
+  }
+}
+
+}
+
+int main(int argc, char **argv) {
+  unsigned long repeats = 1;
+  bool quiet = false;
+  int opt;
+  while ((opt = getopt(argc, argv, "n:q")) != -1) {
+    switch (opt) {
+      case 'n':
+        repeats = std::strtoul(optarg, nullptr, 10);
+        break;
+      case 'q':
+        quiet = true;
+        break;
+      default:
+        std::fprintf(stderr, "Usage: %s [-n repeats] [-q] log...\n", argv[0]);
+        return 2;
+    }
+  }
+  if (optind >= argc || repeats == 0) {
+    std::fprintf(stderr, "Usage: %s [-n repeats] [-q] log...\n", argv[0]);
+    return 2;
+  }
+
+  int status = 0;
+  for (int i = optind; i < argc; i++) {
+    std::ifstream file(argv[i]);
+    if (!file) {
+      std::fprintf(stderr, "%s: cannot open\n", argv[i]);
+      status = 1;
+      continue;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::string log = contents.str();
+
+    if (!InputReplayer(log.c_str()).isValid()) {
+      std::fprintf(stderr, "%s: no usable input log found\n", argv[i]);
+      status = 1;
+      continue;
+    }
+
+    unsigned long frames;
+    TetrisEvent end;
+    Tetris tetris = replay(log.c_str(), frames, end);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long r = 1; r < repeats; r++) {
+      replay(log.c_str(), frames, end);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%s: %s after %lu frames, score %u, level %u, lines %u\n",
+        argv[i], describeEnd(end), frames, tetris.getScore(), tetris.getLevel(), tetris.getLines());
+    if (repeats > 1) {
+      std::printf("  %lu replays in %.3f s, %.0f frames/s (%.0fx real time)\n",
+          repeats - 1, seconds, (repeats - 1) * frames / seconds, (repeats - 1) * frames / seconds / 60);
+    }
+    if (!quiet) {
+      printBoard(tetris);
+    }
+  }
+  return status;
+}
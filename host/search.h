@@ -0,0 +1,121 @@
+#ifndef HOST_SEARCH_H_
+#define HOST_SEARCH_H_
+
+// Placement search shared by the host-side players.
+
+#include "tetris.h"
+
+#include <cstdint>
+#include <cstdlib>
+
+// How to get the falling piece to where it should land: turns right (or left
+// if negative), then shifts right (or left), then a hard drop.
+struct Placement {
+  int8_t turns;
+  int8_t shifts;
+};
+
+// https://codemyroad.wordpress.com/2013/04/14/tetris-ai-the-near-perfect-player/
+double const AGGREGATE_HEIGHT_WEIGHT = -0.510066;
+double const LINES_WEIGHT = 0.760666;
+double const HOLES_WEIGHT = -0.35663;
+double const BUMPINESS_WEIGHT = -0.184483;
+
+double const TOPPED_OUT = -1e9;
+
+// getRow() reaches two hidden rows above the visible ones.
+template<typename Game>
+uint8_t getNumBoardRows(Game const &tetris) {
+  return tetris.getNumRows() + 2;
+}
+
+template<typename Game>
+void apply(Game &tetris, Placement placement) {
+  tetris.lower();
+  for (int8_t i = 0; i < std::abs(placement.turns); i++) {
+    tetris.turn(placement.turns > 0 ? 1 : -1);
+  }
+  for (int8_t i = 0; i < std::abs(placement.shifts); i++) {
+    tetris.shift(placement.shifts > 0 ? 1 : -1);
+  }
+  tetris.drop();
+}
+
+/**
+ * Calls visit(placed, placement) for every place the falling piece can be
+ * dropped into with turns and shifts alone, where placed is a copy of the game
+ * after the drop.
+ */
+template<typename Game, typename Visit>
+void forEachPlacement(Game const &tetris, Visit visit) {
+  int8_t const TURNS[] = {0, 1, 2, -1};
+  for (int8_t turns : TURNS) {
+    Game turned = tetris;
+    turned.lower();
+    bool reachable = true;
+    for (int8_t i = 0; i < std::abs(turns); i++) {
+      reachable = reachable && turned.turn(turns > 0 ? 1 : -1);
+    }
+    if (!reachable) {
+      continue;
+    }
+
+    for (int8_t direction = -1; direction <= 1; direction += 2) {
+      Game shifted = turned;
+      int8_t shifts = 0;
+      // The unshifted placement is only visited while going left.
+      if (direction > 0) {
+        if (!shifted.shift(direction)) {
+          continue;
+        }
+        shifts = direction;
+      }
+      while (true) {
+        Game placed = shifted;
+        placed.drop();
+        visit(placed, Placement{turns, shifts});
+        if (!shifted.shift(direction)) {
+          break;
+        }
+        shifts += direction;
+      }
+    }
+  }
+}
+
+/**
+ * Scores the locked blocks on the board; higher is better.
+ */
+template<typename Game>
+double evaluate(Game const &tetris) {
+  typedef typename Game::Row Row;
+  uint8_t numCols = tetris.getNumCols();
+  // Columns 0 and 1 and the last two are outside and wall.
+  Row field = ((Row(1) << (numCols - 4)) - 1) << 2;
+
+  unsigned aggregateHeight = 0;
+  unsigned bumpiness = 0;
+  for (uint8_t col = 2; col < numCols - 2; col++) {
+    uint8_t height = tetris.getHeight(col);
+    if (height >= tetris.getNumRows()) {
+      return TOPPED_OUT;
+    }
+    aggregateHeight += height;
+    if (col > 2) {
+      bumpiness += std::abs(height - tetris.getHeight(col - 1));
+    }
+  }
+
+  // An empty cell is a hole if any block is above it.
+  unsigned holes = 0;
+  Row covered = 0;
+  for (uint8_t row = getNumBoardRows(tetris) - 1; row >= 1; row--) {
+    Row blocks = tetris.getRow(row) & field;
+    holes += __builtin_popcountll(covered & ~blocks & field);
+    covered |= blocks;
+  }
+
+  return AGGREGATE_HEIGHT_WEIGHT * aggregateHeight + HOLES_WEIGHT * holes + BUMPINESS_WEIGHT * bumpiness;
+}
+
+#endif
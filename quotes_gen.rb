@@ -2,19 +2,49 @@
 
 require 'csv'
 
+# Usage: quotes_gen.rb [--huffman] < quotes.txt > quotes.cpp
+#
 # Compression scheme: the bytes are converted to a string of bits, typically in groups of 5.
 # 00000: space
 # 00001-11010: a-z or A-Z (initially caps are off)
 # 11011: caps on
 # 11100: caps off
-# 11101: reserved
+# 11101: followed by 5 bits, a word from the dictionary
 # 11110: followed by an 8-bit character
 # 11111: end of quote
+#
+# With --huffman, every character, and the end of a quote as '\0', gets a
+# code of its own instead, from a static Huffman code built over the whole
+# corpus. The code is canonical, so the decoder only needs the number of
+# codes of each length and the characters in order of code.
+#
+# Both codes can refer to a dictionary of words and phrases that come up
+# over and over. The generator picks them greedily, each time the string
+# that saves the most bits in all quotes together, given its place in the
+# dictionary. In the text of the quotes, dictionary word i stands in as the
+# control character i + 1; with --huffman those get codes of their own.
+
+HUFFMAN = ARGV.include?('--huffman')
+# The decoder assembles codes in 16 bits.
+MAX_HUFFMAN_LENGTH = 16
+# Codes up to this long are looked up in a table; as in decompress.h.
+HUFFMAN_LOOKUP_BITS = 6
+# The quotes are one stream of bits, and the index has where every group of
+# this many quotes starts, as a byte offset; the quotes within a group are
+# found by reading past the ones before. Each group starts on a byte.
+QUOTES_PER_INDEX = 8
+# Word numbers have 5 bits in the 5-bit code, and the control characters
+# run out at 31 anyway.
+MAX_WORDS = 31
+MIN_WORD_LENGTH = 2
+MAX_WORD_LENGTH = 16
+# How many of the words that look best are tried out each time.
+WORD_CANDIDATES = 8
 
 SPACE = [0,0,0,0,0]
 CAPS_ON = [1,1,0,1,1]
 CAPS_OFF = [1,1,1,0,0]
-RESERVED = [1,1,1,0,1]
+WORD = [1,1,1,0,1]
 ESCAPE = [1,1,1,1,0]
 EOM = [1,1,1,1,1]
 
@@ -67,19 +97,199 @@ def compress(s)
       bits += to_bits(n, 5)
     elsif c == ' '
       bits += SPACE
+    elsif c.ord <= MAX_WORDS
+      bits += WORD
+      bits += to_bits(c.ord - 1, 5)
     else
       bits += ESCAPE
       bits += to_bits(c.ord, 8)
     end
   end
   bits += EOM
-  return to_bytes(bits)
+  return bits
+end
+
+# Returns the length of each character's code.
+def huffman_lengths(frequencies)
+  return {frequencies.keys.first => 1} if frequencies.length == 1
+  # Trees as [weight, order, characters]; the order keeps the result the
+  # same from run to run.
+  trees = frequencies.sort.each_with_index.map {|(c, weight), i| [weight, i, [c]]}
+  lengths = Hash.new(0)
+  order = trees.length
+  while trees.length > 1
+    trees.sort!
+    a = trees.shift
+    b = trees.shift
+    (a[2] + b[2]).each {|c| lengths[c] += 1}
+    trees << [a[0] + b[0], order, a[2] + b[2]]
+    order += 1
+  end
+  return lengths
+end
+
+# Returns the characters in order of code, the number of codes of each
+# length from 1 up, and each character's code as bits.
+def canonical_code(lengths)
+  symbols = lengths.keys.sort_by {|c| [lengths[c], c.ord]}
+  max_length = lengths.values.max
+  raise "Huffman code of #{max_length} bits" if max_length > MAX_HUFFMAN_LENGTH
+  counts = Array.new(max_length, 0)
+  symbols.each {|c| counts[lengths[c] - 1] += 1}
+  codes = {}
+  code = 0
+  length = lengths[symbols.first]
+  symbols.each do |c|
+    code <<= lengths[c] - length
+    length = lengths[c]
+    codes[c] = to_bits(code, length)
+    code += 1
+  end
+  return symbols, counts, codes
+end
+
+# For every value of HUFFMAN_LOOKUP_BITS bits, the length of the code they
+# start with and its character, or a length of 0 if the code is longer.
+def huffman_lookup(codes)
+  lookup = Array.new(1 << HUFFMAN_LOOKUP_BITS) { [0, 0] }
+  codes.each do |c, bits|
+    next if bits.length > HUFFMAN_LOOKUP_BITS
+    free = HUFFMAN_LOOKUP_BITS - bits.length
+    first = (bits + [0] * free).inject(0) {|n, bit| 2 * n + bit}
+    (first...first + (1 << free)).each {|i| lookup[i] = [bits.length, c.ord]}
+  end
+  return lookup
+end
+
+def huffman_compress(s, codes)
+  bits = []
+  (s + "\0").each_char {|c| bits += codes[c]}
+  return bits
+end
+
+# Puts the coded quotes one after the other, each group of QUOTES_PER_INDEX
+# starting on a byte. Returns the bytes and where every group but the first
+# starts.
+def pack(coded_quotes)
+  bytes = []
+  index = []
+  coded_quotes.each_slice(QUOTES_PER_INDEX) do |group|
+    index << bytes.length
+    bytes += to_bytes(group.flatten)
+  end
+  index.shift
+  raise "Over 64 KiB of quotes" if bytes.length > 0x10000
+  # The decoder may read a byte past the end.
+  bytes << 0
+  return bytes, index
+end
+
+def packed_size(coded_quotes)
+  bytes, index = pack(coded_quotes)
+  return bytes.length + 2 * index.length
+end
+
+def word_symbol(i)
+  return (i + 1).chr
+end
+
+def huffman_code(lines)
+  frequencies = Hash.new(0)
+  lines.each do |line|
+    (line + "\0").each_char {|c| frequencies[c] += 1}
+  end
+  return canonical_code(huffman_lengths(frequencies))
+end
+
+def huffman_size(lines)
+  symbols, counts, codes = huffman_code(lines)
+  return counts.length + symbols.length + 2 * (1 << HUFFMAN_LOOKUP_BITS) + packed_size(lines.map {|line| huffman_compress(line, codes)})
+end
+
+def dictionary_size(words)
+  # Every word with its '\0' and its offset in the table.
+  return words.sum {|word| word.length + 3}
+end
+
+# The size of the quotes in the code that is generated, tables included.
+def coded_size(lines, words)
+  size = HUFFMAN ? huffman_size(lines) : packed_size(lines.map {|line| compress(line)})
+  return size + dictionary_size(words)
+end
+
+# Bits a character or a word takes, roughly.
+def estimated_bits(frequency, total, word)
+  if HUFFMAN
+    return Math.log2(total.to_f / frequency)
+  else
+    return word ? 10 : 5
+  end
+end
+
+# Picks the dictionary and puts it into the lines. Returns the words.
+def pick_words(lines)
+  words = []
+  size = coded_size(lines, words)
+  while words.length < MAX_WORDS
+    frequencies = Hash.new(0)
+    lines.each {|line| (line + "\0").each_char {|c| frequencies[c] += 1}}
+    total = frequencies.values.sum
+
+    counts = Hash.new(0)
+    lines.each do |line|
+      (0...line.length).each do |i|
+        # Words don't contain words.
+        next if line[i].ord <= MAX_WORDS
+        (MIN_WORD_LENGTH..MAX_WORD_LENGTH).each do |length|
+          break if i + length > line.length || line[i + length - 1].ord <= MAX_WORDS
+          counts[line[i, length]] += 1
+        end
+      end
+    end
+
+    # The estimates leave out that the characters of a word get rarer, so
+    # the most promising words are tried for real.
+    candidates = []
+    counts.each do |word, count|
+      next if count < 2
+      spelled = word.each_char.sum {|c| estimated_bits(frequencies[c], total, false)}
+      saving = count * (spelled - estimated_bits(count, total, true)) - 8 * (word.length + 3)
+      candidates << [-saving, word] if saving > 0
+    end
+    symbol = word_symbol(words.length)
+    best = nil
+    best_size = size
+    candidates.sort.first(WORD_CANDIDATES).each do |saving, word|
+      candidate_size = coded_size(lines.map {|line| line.gsub(word, symbol)}, words + [word])
+      if candidate_size < best_size
+        best = word
+        best_size = candidate_size
+      end
+    end
+    break if best.nil?
+
+    lines.each {|line| line.gsub!(best, symbol)}
+    words << best
+    size = best_size
+  end
+  return words
 end
 
 def c_string(s)
   return '{' + s.split(//).map(&:ord).join(',') + '}'
 end
 
+lines = STDIN.readlines.map(&:chomp)
+lines.each do |line|
+  line.each_char {|c| raise "Can't code #{c.inspect}" if c.ord > 0xFF || c.ord <= MAX_WORDS}
+end
+uncompressed_size = lines.sum(&:length)
+plain_compressed_size = packed_size(lines.map {|line| compress(line)})
+plain_huffman_size = huffman_size(lines)
+
+words = pick_words(lines)
+symbols, counts, codes = huffman_code(lines)
+
 puts '// AUTOGENERATED. DO NOT EDIT. INVOKE \'make\' TO REGENERATE.'
 puts ''
 puts '#include "quotes.h"'
@@ -87,29 +297,58 @@ puts ''
 puts '#include <avr/pgmspace.h>'
 puts ''
 
-count = 0
-uncompressed_size = 0
-compressed_size = 0
-STDIN.each do |line|
-  line.chomp!
-  compressed = compress(line)
+compressed = lines.map {|line| compress(line)}
+huffman_compressed = lines.map {|line| huffman_compress(line, codes)}
+compressed_size = dictionary_size(words) + packed_size(compressed)
+huffman_size = dictionary_size(words) + counts.length + symbols.length + 2 * (1 << HUFFMAN_LOOKUP_BITS) + packed_size(huffman_compressed)
 
-  uncompressed_size += line.length
-  compressed_size += compressed.length
-
-  chars = compressed.map{|c| "(char)#{c}"}.join(", ")
-  puts "static char const QUOTE_#{count}[] PROGMEM = {#{chars}};"
-  count += 1
+bytes, index = pack(HUFFMAN ? huffman_compressed : compressed)
+puts 'char const QUOTE_DATA[] PROGMEM = {'
+bytes.each_slice(16) do |slice|
+  puts '  ' + slice.map {|b| "(char)#{b}"}.join(', ') + ','
 end
+puts '};'
+puts ''
+puts "uint16_t const QUOTE_INDEX[] PROGMEM = {#{index.join(', ')}};"
+puts "uint8_t const QUOTES_PER_INDEX = #{QUOTES_PER_INDEX};"
+puts "int const NUM_QUOTES = #{lines.length};"
 puts ''
 
-print 'char const *const QUOTES[] PROGMEM = { '
-count.times do |i|
-  print "QUOTE_#{i}, "
+if words.empty?
+  puts 'Dictionary const *const QUOTE_DICTIONARY = nullptr;'
+else
+  offsets = []
+  offset = 0
+  words.each do |word|
+    offsets << offset
+    offset += word.length + 1
+  end
+  text = words.map {|word| (word + "\0").each_char.map {|c| "(char)#{c.ord}"}}.flatten
+  puts "// #{words.map(&:inspect).join(' ')}"
+  puts "static uint16_t const WORD_OFFSETS[] PROGMEM = {#{offsets.join(', ')}};"
+  puts "static char const WORD_TEXT[] PROGMEM = {#{text.join(', ')}};"
+  puts ''
+  puts 'static Dictionary const DICTIONARY = {WORD_OFFSETS, WORD_TEXT};'
+  puts 'Dictionary const *const QUOTE_DICTIONARY = &DICTIONARY;'
 end
-puts '};'
 puts ''
 
-puts "int const NUM_QUOTES = #{count};"
+if HUFFMAN
+  puts "static uint8_t const CODE_COUNTS[] PROGMEM = {#{counts.join(', ')}};"
+  puts "static char const CODE_SYMBOLS[] PROGMEM = {#{symbols.map {|c| "(char)#{c.ord}"}.join(', ')}};"
+  puts 'static uint8_t const CODE_LOOKUP[] PROGMEM = {'
+  huffman_lookup(codes).each_slice(8) do |slice|
+    puts '  ' + slice.map {|length, c| "#{length}, #{c}"}.join(', ') + ','
+  end
+  puts '};'
+  puts ''
+  puts 'static HuffmanCode const CODE = {CODE_COUNTS, CODE_SYMBOLS, CODE_LOOKUP, sizeof(CODE_COUNTS)};'
+  puts 'HuffmanCode const *const QUOTE_CODE = &CODE;'
+else
+  puts 'HuffmanCode const *const QUOTE_CODE = nullptr;'
+end
 
-STDERR.puts "Uncompressed: #{uncompressed_size}\nCompressed:   #{compressed_size}"
+STDERR.puts "Uncompressed: #{uncompressed_size}"
+STDERR.puts "Dictionary:   #{words.length} words, #{dictionary_size(words)} bytes"
+STDERR.puts "Compressed:   #{compressed_size}, #{plain_compressed_size} without the dictionary"
+STDERR.puts "Huffman:      #{huffman_size}, #{plain_huffman_size} without the dictionary (code tables included)"